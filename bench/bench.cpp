@@ -0,0 +1,290 @@
+
+// the benchmark counts allocations itself, which the instrumented build would clash with
+#undef CRYPTOPALS_INSTRUMENT
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "../solutions/common/aes.h"
+#include "../solutions/common/batch.h"
+#include "../solutions/common/blocks.h"
+#include "../solutions/common/bytes.h"
+#include "../solutions/common/encoding.h"
+#include "../solutions/common/ngram.h"
+#include "../solutions/common/plaintext.h"
+#include "../solutions/common/random.h"
+#include "../solutions/common/size.h"
+#include "../solutions/common/xor.h"
+
+#define MIN_SIZE 64
+#define SIZE_STEP 4
+#define DEFAULT_MAX_SIZE (16ul << 20)
+#define DEFAULT_MIN_TIME 0.2
+
+// every allocation made by the process is counted so kernels can report allocations per op
+static std::atomic<uint64_t> num_allocations(0);
+
+// counts the allocation and makes it; the replacements below all come through here
+static void* counted_allocate(size_t size, size_t alignment)
+{
+  num_allocations.fetch_add(1, std::memory_order_relaxed);
+  void* p = alignment ? std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)
+    : std::malloc(size ? size : 1);
+  if (p == NULL)
+    throw std::bad_alloc();
+  return p;
+}
+
+// kept out of line so gcc pairs each new with a delete, not an inlined malloc or free with
+// its counterpart; the array forms forward to these by default
+__attribute__((noinline)) void* operator new(size_t size) { return counted_allocate(size, 0); }
+__attribute__((noinline)) void* operator new(size_t size, std::align_val_t align) { return counted_allocate(size, (size_t) align); }
+__attribute__((noinline)) void operator delete(void* p) noexcept { std::free(p); }
+__attribute__((noinline)) void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept { std::free(p); }
+__attribute__((noinline)) void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+
+// results are folded into the sink so the compiler cannot drop the work
+static volatile uint64_t sink;
+
+// a kernel prepares its inputs for a size and returns the operation to time
+typedef std::function<std::function<void()>(size_t size)> KERNEL_SETUP;
+
+struct Kernel {
+  std::string name;
+  KERNEL_SETUP setup;
+  // largest size worth running; slow kernels are capped so a full run stays short
+  size_t max_size;
+};
+
+struct Result {
+  std::string name;
+  size_t size;
+  size_t iterations;
+  double ns_per_op;
+  double mb_per_s;
+  double allocs_per_op;
+};
+
+// time a kernel at one size
+Result run_kernel(const Kernel& kernel, size_t size, double min_time);
+
+// print results as a JSON array with one result per line
+void print_json(const std::vector<Result>& results);
+
+
+int main(int argc, char* argv[])
+{
+  size_t max_size = DEFAULT_MAX_SIZE;
+  double min_time = DEFAULT_MIN_TIME;
+  std::string filter;
+  std::string wordlist_file = "solutions/3/wordlist.txt";
+
+  int opt;
+  while ((opt = getopt(argc, argv, "m:k:t:w:")) != -1) {
+    switch (opt) {
+    case 'm': max_size = parse_size(optarg); break;
+    case 'k': filter = optarg; break;
+    case 't': min_time = std::stod(optarg); break;
+    case 'w': wordlist_file = optarg; break;
+    default:
+      std::cerr << "usage: " << argv[0] << " [-m max_size] [-k kernel_filter] [-t min_seconds] [-w wordlist]" << std::endl;
+      return 1;
+    }
+  }
+
+  std::set<std::string> wordlist = read_wordlist(wordlist_file);
+  std::vector<std::string> words(wordlist.begin(), wordlist.end());
+  const byte aes_key[AES_KEY_SIZE] = {
+    'Y', 'E', 'L', 'L', 'O', 'W', ' ', 'S',
+    'U', 'B', 'M', 'A', 'R', 'I', 'N', 'E'};
+
+  // kernels own their inputs through shared_ptr captures so each size is built once
+  std::vector<Kernel> kernels = {
+    {"hex_decode", [](size_t size) {
+      auto hex = std::make_shared<std::string>(bytes_to_hex(random_bytes(size, 1)));
+      auto out = std::make_shared<Bytes>();
+      return [hex, out] { hex_decode(*hex, *out); sink += (*out)[0]; };
+    }, SIZE_MAX},
+    {"hex_encode", [](size_t size) {
+      auto bytes = std::make_shared<Bytes>(random_bytes(size, 2));
+      return [bytes] { sink += bytes_to_hex(*bytes)[0]; };
+    }, SIZE_MAX},
+    {"base64_encode", [](size_t size) {
+      auto bytes = std::make_shared<Bytes>(random_bytes(size, 3));
+      return [bytes] { sink += bytes_to_base64(*bytes)[0]; };
+    }, SIZE_MAX},
+    {"base64_decode", [](size_t size) {
+      auto base64 = std::make_shared<std::string>(bytes_to_base64(random_bytes(size, 4)));
+      auto out = std::make_shared<Bytes>();
+      return [base64, out] { base64_decode(*base64, *out); sink += (*out)[0]; };
+    }, SIZE_MAX},
+    {"b64_decode_evp", [](size_t size) {
+      auto base64 = std::make_shared<secure_string>();
+      std::string encoded = bytes_to_base64(random_bytes(size, 5));
+      base64->assign(encoded.begin(), encoded.end());
+      auto out = std::make_shared<secure_string>();
+      return [base64, out] { b64_decode(*base64, *out); sink += (*out)[0]; };
+    }, SIZE_MAX},
+    {"fixed_xor", [](size_t size) {
+      auto a = std::make_shared<Bytes>(random_bytes(size, 6));
+      auto b = std::make_shared<Bytes>(random_bytes(size, 7));
+      return [a, b] { sink += fixed_xor(*a, *b)[0]; };
+    }, SIZE_MAX},
+    {"repeating_key_xor", [](size_t size) {
+      auto text = std::make_shared<Bytes>(random_bytes(size, 8));
+      auto key = std::make_shared<Bytes>(str_to_bytes("ICE"));
+      return [text, key] { sink += repeating_key_xor(*text, *key)[0]; };
+    }, SIZE_MAX},
+    {"single_byte_xor", [](size_t size) {
+      auto text = std::make_shared<Bytes>(random_bytes(size, 9));
+      auto out = std::make_shared<Bytes>(size);
+      return [text, out] { single_byte_xor(*text, 0x5a, *out); sink += (*out)[0]; };
+    }, SIZE_MAX},
+    {"rank_single_byte_keys", [&wordlist, &words](size_t size) {
+      Bytes text = str_to_bytes(random_text(words, size, 10));
+      auto encrypted = std::make_shared<Bytes>(text.size());
+      single_byte_xor(text, 'X', *encrypted);
+      return [&wordlist, encrypted] { sink += rank_single_byte_keys(wordlist, *encrypted).size(); };
+    }, 256ul << 10},
+    {"rank_single_byte_keys_ngram", [&words](size_t size) {
+      Bytes text = str_to_bytes(random_text(words, size, 10));
+      auto encrypted = std::make_shared<Bytes>(text.size());
+      single_byte_xor(text, 'X', *encrypted);
+      return [encrypted] { sink += rank_single_byte_keys(*encrypted).size(); };
+    }, 256ul << 10},
+    {"single_byte_xor_batch", [&words](size_t size) {
+      // size bytes spread over a full batch of lines, one english line among random ones
+      size_t length = std::max<size_t>(1, size / BATCH_LANES);
+      auto batch = std::make_shared<SingleByteXorBatch>();
+      for (size_t lane = 0; lane < BATCH_LANES; lane++) {
+	if (lane == BATCH_LANES / 2) {
+	  Bytes text = str_to_bytes(random_text(words, length, 19));
+	  Bytes encrypted(length);
+	  single_byte_xor(text, 'X', encrypted);
+	  batch->add(encrypted);
+	} else {
+	  batch->add(random_bytes(length, 20 + lane));
+	}
+      }
+      return [batch] { sink += batch->crack()[BATCH_LANES / 2].key; };
+    }, 4ul << 20},
+    {"ngram_score", [&words](size_t size) {
+      auto text = std::make_shared<Bytes>(str_to_bytes(random_text(words, size, 18)));
+      return [text] { sink += ngram_score(*text) < NGRAM_ENGLISH_THRESHOLD; };
+    }, SIZE_MAX},
+    {"hamming_distance", [](size_t size) {
+      auto a = std::make_shared<Bytes>(random_bytes(size, 11));
+      auto b = std::make_shared<Bytes>(random_bytes(size, 12));
+      return [a, b] { sink += hamming_distance(*a, *b); };
+    }, SIZE_MAX},
+    {"evaluate_key_lengths", [&words](size_t size) {
+      auto encrypted = std::make_shared<Bytes>(
+        repeating_key_xor(str_to_bytes(random_text(words, size, 13)), str_to_bytes("Terminator X")));
+      return [encrypted] { sink += evaluate_key_lengths(*encrypted).size(); };
+    }, SIZE_MAX},
+    {"aes_ecb_encrypt", [aes_key](size_t size) {
+      Bytes bytes = random_bytes(size, 14);
+      auto ptext = std::make_shared<secure_string>((const char*) bytes.data(), bytes.size());
+      auto ctext = std::make_shared<secure_string>();
+      return [aes_key, ptext, ctext] { aes_encrypt(aes_key, *ptext, *ctext); sink += (*ctext)[0]; };
+    }, SIZE_MAX},
+    {"aes_ecb_decrypt", [aes_key](size_t size) {
+      Bytes bytes = random_bytes(size, 15);
+      secure_string ptext((const char*) bytes.data(), bytes.size());
+      auto ctext = std::make_shared<secure_string>();
+      aes_encrypt(aes_key, ptext, *ctext);
+      auto rtext = std::make_shared<secure_string>();
+      return [aes_key, ctext, rtext] { aes_decrypt(aes_key, *ctext, *rtext); sink += (*rtext)[0]; };
+    }, SIZE_MAX},
+    {"aes_ecb_decrypt_in_place", [aes_key](size_t size) {
+      // unpadded, so decrypting the same buffer again never fails a padding check
+      auto text = std::make_shared<Bytes>(random_bytes(size - size % AES_BLOCK_SIZE, 18));
+      return [aes_key, text] { sink += aes_decrypt(aes_key, *text, *text, false); };
+    }, SIZE_MAX},
+    {"count_duplicate_blocks", [](size_t size) {
+      // a quarter of the blocks repeat, like an ECB line in challenge 8
+      auto bytes = std::make_shared<Bytes>(random_bytes(size, 16));
+      for (size_t i = 0; i + 2 * AES_BLOCK_SIZE <= size; i += 8 * AES_BLOCK_SIZE) {
+        memcpy(bytes->data() + i + AES_BLOCK_SIZE, bytes->data() + i, AES_BLOCK_SIZE);
+      }
+      auto blocks = std::make_shared<std::vector<BLOCK> >();
+      return [bytes, blocks] { sink += count_duplicate_blocks(*bytes, *blocks); };
+    }, SIZE_MAX},
+    {"pkcs7_pad", [](size_t size) {
+      auto text = std::make_shared<Bytes>(random_bytes(size, 17));
+      text->reserve(size + AES_BLOCK_SIZE);
+      return [text, size] { text->resize(size); pkcs7_pad(*text, AES_BLOCK_SIZE); sink += text->size(); };
+    }, SIZE_MAX},
+  };
+
+  std::vector<Result> results;
+  for (auto& kernel : kernels) {
+    if (!filter.empty() && kernel.name.find(filter) == std::string::npos) {
+      continue;
+    }
+
+    size_t limit = std::min(max_size, kernel.max_size);
+    for (size_t size = MIN_SIZE; size <= limit; size *= SIZE_STEP) {
+      results.push_back(run_kernel(kernel, size, min_time));
+      std::cerr << kernel.name << " " << size << ": " << results.back().mb_per_s << " MB/s" << std::endl;
+    }
+  }
+
+  print_json(results);
+
+  return 0;
+}
+
+Result run_kernel(const Kernel& kernel, size_t size, double min_time)
+{
+  std::function<void()> op = kernel.setup(size);
+
+  // one warm up run decides how many iterations fill min_time
+  auto start = std::chrono::steady_clock::now();
+  op();
+  std::chrono::duration<double> warm_up = std::chrono::steady_clock::now() - start;
+  size_t iterations = std::max<size_t>(1, min_time / std::max(warm_up.count(), 1e-9));
+
+  uint64_t allocations_before = num_allocations.load();
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; i++) {
+    op();
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  uint64_t allocations = num_allocations.load() - allocations_before;
+
+  Result result;
+  result.name = kernel.name;
+  result.size = size;
+  result.iterations = iterations;
+  result.ns_per_op = elapsed.count() * 1e9 / iterations;
+  result.mb_per_s = (double) size * iterations / elapsed.count() / 1e6;
+  result.allocs_per_op = (double) allocations / iterations;
+  return result;
+}
+
+void print_json(const std::vector<Result>& results)
+{
+  std::cout << "[" << std::endl;
+  for (size_t i = 0; i < results.size(); i++) {
+    const Result& r = results[i];
+    std::cout << "  {\"kernel\": \"" << r.name << "\", \"size\": " << r.size
+	      << ", \"iterations\": " << r.iterations
+	      << ", \"ns_per_op\": " << r.ns_per_op
+	      << ", \"mb_per_s\": " << r.mb_per_s
+	      << ", \"allocs_per_op\": " << r.allocs_per_op << "}"
+	      << (i + 1 < results.size() ? "," : "") << std::endl;
+  }
+  std::cout << "]" << std::endl;
+}
@@ -0,0 +1,133 @@
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../solutions/common/bytes.h"
+#include "../solutions/common/corpus.h"
+#include "../solutions/common/encoding.h"
+#include "../solutions/common/input.h"
+#include "../solutions/common/output.h"
+
+// pack hex or base64 lines from stdin into a binary corpus; blank lines are skipped
+void import_corpus(const std::string& output_file, bool base64);
+
+// write the records of a binary corpus as hex or base64 lines
+void export_corpus(const std::string& input_file, bool base64);
+
+// print the record count and size of a binary corpus
+void corpus_info(const std::string& input_file);
+
+void usage(const char* program);
+
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2) {
+    usage(argv[0]);
+    return 1;
+  }
+  std::string command = argv[1];
+  optind = 2;
+
+  bool base64 = false;
+  int opt;
+  while ((opt = getopt(argc, argv, "b")) != -1) {
+    switch (opt) {
+    case 'b': base64 = true; break;
+    default:
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (optind + 1 != argc) {
+    usage(argv[0]);
+    return 1;
+  }
+  std::string file = argv[optind];
+
+  if (command == "import") {
+    import_corpus(file, base64);
+  } else if (command == "export") {
+    export_corpus(file, base64);
+  } else if (command == "info") {
+    corpus_info(file);
+  } else {
+    usage(argv[0]);
+    return 1;
+  }
+
+  return 0;
+}
+
+void import_corpus(const std::string& output_file, bool base64)
+{
+  int fd = open(output_file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd == -1) {
+    throw std::invalid_argument("unable to open output file");
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  Input input;
+  std::string scratch;
+  std::string_view line;
+  Bytes record;
+  size_t line_num = 0;
+  {
+    CorpusWriter writer(fd);
+    while (input.next_line(line)) {
+      line_num++;
+      std::string_view encoded = strip_whitespace(line, scratch);
+      if (encoded.empty()) {
+	continue;
+      }
+      if (!(base64 ? base64_decode(encoded, record) : hex_decode(encoded, record))) {
+	throw std::invalid_argument("bad encoding on line " + std::to_string(line_num));
+      }
+      writer.add(record);
+    }
+    writer.finish();
+    std::cerr << writer.size() << " records";
+  }
+  off_t size = lseek(fd, 0, SEEK_END);
+  close(fd);
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  std::cerr << ", " << size << " bytes in " << elapsed.count() << " s" << std::endl;
+}
+
+void export_corpus(const std::string& input_file, bool base64)
+{
+  CorpusReader corpus(input_file);
+  Output out;
+  for (size_t i = 0; i < corpus.size(); i++) {
+    if (base64) {
+      out.write_base64(corpus.record(i));
+    } else {
+      out.write_hex(corpus.record(i));
+    }
+    out.put('\n');
+  }
+}
+
+void corpus_info(const std::string& input_file)
+{
+  CorpusReader corpus(input_file);
+  size_t record_bytes = 0;
+  for (size_t i = 0; i < corpus.size(); i++) {
+    record_bytes += corpus.record(i).size();
+  }
+  std::cout << corpus.size() << " records, " << record_bytes << " ciphertext bytes, "
+	    << corpus.bytes() << " bytes on disk" << std::endl;
+}
+
+void usage(const char* program)
+{
+  std::cerr << "usage: " << program << " import [-b] corpus.bin < lines.txt\n"
+	    << "       " << program << " export [-b] corpus.bin > lines.txt\n"
+	    << "       " << program << " info corpus.bin" << std::endl;
+}
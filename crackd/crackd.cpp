@@ -0,0 +1,462 @@
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "../solutions/common/blocks.h"
+#include "../solutions/common/bytes.h"
+#include "../solutions/common/encoding.h"
+#include "../solutions/common/instrument.h"
+#include "../solutions/common/plaintext.h"
+
+#define DEFAULT_SOCKET "/tmp/crackd.sock"
+#define DEFAULT_TOP_K 5
+#define NUM_KEYSIZE_CANDIDATES 5
+// requests read from one connection and not yet answered before the reader stops reading
+#define MAX_IN_FLIGHT 256
+// longest request line; the rest of a longer one is discarded and the request answered with an error
+#define MAX_REQUEST_SIZE (16ul << 20)
+#define READ_SIZE (64ul << 10)
+
+// fixed set of worker threads that run queued jobs in order
+class ThreadPool {
+public:
+  explicit ThreadPool(unsigned num_threads);
+  void submit(std::function<void()> job);
+
+private:
+  void run();
+
+  std::mutex mutex;
+  std::condition_variable not_empty;
+  std::deque<std::function<void()> > jobs;
+  std::vector<std::thread> workers;
+};
+
+// one client. Workers queue their answers and the connection's own writer thread sends them,
+// so a client that stops reading holds up only itself. The reader, the writer and jobs hold
+// references, and the socket is closed once the client has stopped sending and every answer
+// is written.
+class Connection {
+public:
+  explicit Connection(int fd) : fd(fd) {}
+  ~Connection() { close(fd); }
+
+  // wait for room for one more request in flight
+  void begin_request();
+  // queue one answer line for the writer; never waits on the socket
+  void answer(std::string line);
+  // the client has stopped sending
+  void end_requests();
+  // write queued answers and release their slots until every request is answered
+  void write_answers();
+
+  int fd;
+
+private:
+  std::mutex mutex;
+  std::condition_variable slot_free;
+  std::condition_variable answer_ready;
+  // requests read and not yet written back
+  size_t in_flight = 0;
+  std::deque<std::string> answers;
+  bool requests_ended = false;
+};
+
+// everything the workers keep loaded between requests
+struct Models {
+  std::set<std::string> wordlist;
+};
+
+// accept clients on a Unix socket and answer their requests on the pool
+void serve(const std::string& socket_path, unsigned num_threads, const std::string& wordlist_file);
+
+// read request lines from a client and queue each one on the pool
+void read_requests(std::shared_ptr<Connection> connection, ThreadPool& pool, const Models& models);
+
+// answer one request line: "ID OP HEX [TOP_K]"
+std::string handle_request(const std::string& line, const Models& models);
+
+// send request lines from stdin to the daemon and print the answers as they arrive; false if
+// a request could not be sent
+bool send_requests(const std::string& socket_path);
+
+// write all of data to fd
+void write_all(int fd, const char* data, size_t size);
+
+void usage(const char* program);
+
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2) {
+    usage(argv[0]);
+    return 1;
+  }
+  std::string command = argv[1];
+  optind = 2;
+
+  std::string socket_path = DEFAULT_SOCKET;
+  std::string wordlist_file = "solutions/3/wordlist.txt";
+  unsigned num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+  int opt;
+  while ((opt = getopt(argc, argv, "s:t:w:")) != -1) {
+    switch (opt) {
+    case 's': socket_path = optarg; break;
+    case 't': num_threads = std::max(1ul, std::stoul(optarg)); break;
+    case 'w': wordlist_file = optarg; break;
+    default:
+      usage(argv[0]);
+      return 1;
+    }
+  }
+
+  // a client that hangs up early must not take the daemon down with it
+  signal(SIGPIPE, SIG_IGN);
+
+  if (command == "serve") {
+    serve(socket_path, num_threads, wordlist_file);
+  } else if (command == "send") {
+    if (!send_requests(socket_path)) {
+      return 1;
+    }
+  } else {
+    usage(argv[0]);
+    return 1;
+  }
+
+  return 0;
+}
+
+ThreadPool::ThreadPool(unsigned num_threads)
+{
+  for (unsigned i = 0; i < num_threads; i++) {
+    workers.emplace_back(&ThreadPool::run, this);
+  }
+}
+
+void ThreadPool::submit(std::function<void()> job)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    jobs.push_back(std::move(job));
+  }
+  not_empty.notify_one();
+}
+
+void ThreadPool::run()
+{
+  for (;;) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      not_empty.wait(lock, [this] { return !jobs.empty(); });
+      job = std::move(jobs.front());
+      jobs.pop_front();
+    }
+    job();
+  }
+}
+
+void Connection::begin_request()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  slot_free.wait(lock, [this] { return in_flight < MAX_IN_FLIGHT; });
+  in_flight++;
+}
+
+void Connection::answer(std::string line)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    answers.push_back(std::move(line));
+  }
+  answer_ready.notify_one();
+}
+
+void Connection::end_requests()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    requests_ended = true;
+  }
+  answer_ready.notify_one();
+}
+
+void Connection::write_answers()
+{
+  bool connected = true;
+  std::deque<std::string> batch;
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      in_flight -= batch.size();
+      slot_free.notify_one();
+      answer_ready.wait(lock, [this] { return !answers.empty() || (requests_ended && in_flight == 0); });
+      if (answers.empty()) {
+	return;
+      }
+      batch.clear();
+      batch.swap(answers);
+    }
+
+    // written outside the lock, so workers keep queueing while the client is slow
+    std::string lines;
+    for (auto& line : batch) {
+      lines += line;
+    }
+    if (connected) {
+      try {
+	write_all(fd, lines.data(), lines.size());
+      } catch (const std::runtime_error&) {
+	// the client went away; its remaining answers are dropped
+	connected = false;
+      }
+    }
+  }
+}
+
+void serve(const std::string& socket_path, unsigned num_threads, const std::string& wordlist_file)
+{
+  Models models;
+  models.wordlist = read_wordlist(wordlist_file);
+  ThreadPool pool(num_threads);
+
+  int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listener == -1) {
+    throw std::runtime_error("unable to create socket");
+  }
+  sockaddr_un address = {};
+  address.sun_family = AF_UNIX;
+  if (socket_path.size() >= sizeof(address.sun_path)) {
+    throw std::invalid_argument("socket path is too long");
+  }
+  strcpy(address.sun_path, socket_path.c_str());
+
+  // a socket file left by an earlier daemon would make bind fail
+  unlink(socket_path.c_str());
+  if (bind(listener, (sockaddr*) &address, sizeof(address)) == -1 || listen(listener, SOMAXCONN) == -1) {
+    throw std::runtime_error("unable to listen on " + socket_path);
+  }
+  std::cerr << "listening on " << socket_path << " with " << num_threads << " threads, "
+	    << models.wordlist.size() << " words" << std::endl;
+
+  for (;;) {
+    int fd = accept(listener, NULL, NULL);
+    if (fd == -1) {
+      if (errno == EINTR || errno == ECONNABORTED) {
+	continue;
+      }
+      throw std::runtime_error("accept failed");
+    }
+    auto connection = std::make_shared<Connection>(fd);
+    std::thread(read_requests, connection, std::ref(pool), std::cref(models)).detach();
+    std::thread(&Connection::write_answers, connection).detach();
+  }
+}
+
+void read_requests(std::shared_ptr<Connection> connection, ThreadPool& pool, const Models& models)
+{
+  std::string pending;
+  // true while skipping the rest of a line longer than MAX_REQUEST_SIZE
+  bool discarding = false;
+  std::vector<char> buffer(READ_SIZE);
+  auto submit = [&](const std::string& line) {
+    connection->begin_request();
+    pool.submit([connection, line, &models] {
+      INSTRUMENT_COUNT("requests", 1);
+      connection->answer(handle_request(line, models));
+    });
+  };
+  for (;;) {
+    ssize_t n = read(connection->fd, buffer.data(), buffer.size());
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      break;
+    }
+    pending.append(buffer.data(), n);
+
+    // queue every complete line; the rest waits for the next read
+    size_t start = 0;
+    size_t newline;
+    while ((newline = pending.find('\n', start)) != std::string::npos) {
+      if (discarding) {
+	discarding = false;
+	start = newline + 1;
+	continue;
+      }
+      std::string line = pending.substr(start, newline - start);
+      start = newline + 1;
+      if (!line.empty()) {
+	submit(line);
+      }
+    }
+    pending.erase(0, start);
+
+    // a line that is still too long is answered now and the rest of it dropped as it arrives
+    if (!discarding && pending.size() > MAX_REQUEST_SIZE) {
+      size_t space = pending.find(' ');
+      std::string id = space == std::string::npos ? "-" : pending.substr(0, space);
+      connection->begin_request();
+      connection->answer(id + " error request is too long\n");
+      discarding = true;
+    }
+    if (discarding) {
+      pending.clear();
+    }
+  }
+  // a last request the client did not end with a newline is still answered
+  if (!discarding && !pending.empty()) {
+    submit(pending);
+  }
+  // the connection closes once the writer has sent the last answer and every job has let go
+  connection->end_requests();
+}
+
+std::string handle_request(const std::string& line, const Models& models)
+{
+  std::istringstream fields(line);
+  std::string id, op, hex;
+  size_t top_k = DEFAULT_TOP_K;
+  fields >> id >> op >> hex;
+  if (fields >> top_k) {
+    top_k = std::max<size_t>(1, top_k);
+  }
+
+  std::ostringstream answer;
+  answer << id;
+  try {
+    Bytes ciphertext;
+    if (hex.empty() || !hex_decode(hex, ciphertext)) {
+      throw std::invalid_argument("expected ID OP HEX [TOP_K]");
+    }
+
+    char score[32];
+    if (op == "sbx" || op == "sbxw") {
+      // keys ranked by the n-gram model, or by the share of words found in the wordlist
+      std::vector<KeyScore> keys = op == "sbx" ? rank_single_byte_keys(ciphertext, top_k)
+	: rank_single_byte_keys(models.wordlist, ciphertext, top_k);
+      answer << " ok";
+      for (auto& key : keys) {
+	snprintf(score, sizeof(score), "%.4f", key.score);
+	answer << " " << bytes_to_hex(ByteSpan(&key.key, 1)) << ":" << score;
+      }
+    } else if (op == "rxor") {
+      std::vector<RepeatingKey> keys = rank_repeating_keys(ciphertext, NUM_KEYSIZE_CANDIDATES);
+      answer << " ok";
+      for (size_t i = 0; i < keys.size() && i < top_k; i++) {
+	snprintf(score, sizeof(score), "%.4f", keys[i].score);
+	answer << " " << bytes_to_hex(keys[i].key) << ":" << score;
+      }
+    } else if (op == "ecb") {
+      std::vector<BLOCK> blocks;
+      answer << " ok " << count_duplicate_blocks(ciphertext, blocks) << "/" << ciphertext.size() / AES_BLOCK_SIZE;
+    } else {
+      throw std::invalid_argument("unknown operation " + op);
+    }
+  } catch (const std::exception& e) {
+    answer.str("");
+    answer << id << " error " << e.what();
+  }
+  answer << "\n";
+  return answer.str();
+}
+
+bool send_requests(const std::string& socket_path)
+{
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  sockaddr_un address = {};
+  address.sun_family = AF_UNIX;
+  if (socket_path.size() >= sizeof(address.sun_path)) {
+    throw std::invalid_argument("socket path is too long");
+  }
+  strcpy(address.sun_path, socket_path.c_str());
+  if (fd == -1 || connect(fd, (sockaddr*) &address, sizeof(address)) == -1) {
+    throw std::runtime_error("unable to connect to " + socket_path);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+
+  // requests go out while answers come back, so any number can be in flight; a failed
+  // write ends the requests and is reported once the answers to those sent are in
+  std::string send_error;
+  std::thread sender([fd, &send_error] {
+    std::vector<char> buffer(READ_SIZE);
+    ssize_t n;
+    try {
+      while ((n = read(STDIN_FILENO, buffer.data(), buffer.size())) > 0) {
+	write_all(fd, buffer.data(), n);
+      }
+    } catch (const std::exception& e) {
+      send_error = e.what();
+    }
+    shutdown(fd, SHUT_WR);
+  });
+
+  std::vector<char> buffer(READ_SIZE);
+  size_t num_answers = 0;
+  ssize_t n;
+  while ((n = read(fd, buffer.data(), buffer.size())) > 0) {
+    num_answers += std::count(buffer.begin(), buffer.begin() + n, '\n');
+    write_all(STDOUT_FILENO, buffer.data(), n);
+  }
+  sender.join();
+  close(fd);
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  std::cerr << num_answers << " answers in " << elapsed.count() << " s ("
+	    << num_answers / elapsed.count() << " requests/s)" << std::endl;
+  if (!send_error.empty()) {
+    std::cerr << "unable to send every request: " << send_error << std::endl;
+    return false;
+  }
+  return true;
+}
+
+void write_all(int fd, const char* data, size_t size)
+{
+  size_t offset = 0;
+  while (offset < size) {
+    ssize_t n = write(fd, data + offset, size - offset);
+    if (n < 0) {
+      if (errno == EINTR) {
+	continue;
+      }
+      throw std::runtime_error(std::string("write failed: ") + strerror(errno));
+    }
+    offset += n;
+  }
+}
+
+void usage(const char* program)
+{
+  std::cerr << "usage: " << program << " serve [-s socket] [-t threads] [-w wordlist]\n"
+	    << "       " << program << " send [-s socket] < requests.txt\n"
+	    << "requests, one per line, answered in the order they finish:\n"
+	    << "  ID sbx HEX [TOP_K]    single byte xor keys ranked by the n-gram model\n"
+	    << "  ID sbxw HEX [TOP_K]   single byte xor keys ranked by wordlist hits\n"
+	    << "  ID rxor HEX [TOP_K]   repeating xor keys from the likeliest keysizes\n"
+	    << "  ID ecb HEX            repeated 16 byte blocks out of all blocks\n"
+	    << "answers: ID ok KEY:SCORE ..., ID ok DUPLICATES/BLOCKS, or ID error MESSAGE" << std::endl;
+}
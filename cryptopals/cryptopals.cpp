@@ -0,0 +1,704 @@
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <openssl/evp.h>
+#include <unistd.h>
+
+#include "../solutions/common/aes.h"
+#include "../solutions/common/blocks.h"
+#include "../solutions/common/bytes.h"
+#include "../solutions/common/encoding.h"
+#include "../solutions/common/ngram.h"
+#include "../solutions/common/plaintext.h"
+#include "../solutions/common/xor.h"
+
+#define CHUNK_SIZE (1ul << 20)
+#define CHANNEL_CAPACITY 4
+#define NUM_KEYSIZE_CANDIDATES 5
+
+// hands a stage's output chunk to the next stage
+typedef std::function<void(Bytes&& chunk)> EMIT;
+
+// thrown through a stage when a later stage has stopped reading
+struct PipelineClosed {};
+
+// one step of a pipeline; stages see their input as a stream of chunks of any size
+class Stage {
+public:
+  virtual ~Stage() {}
+  // transform a chunk, emitting zero or more output chunks; in place where possible
+  virtual void process(Bytes&& chunk, const EMIT& emit) = 0;
+  // emit whatever was held back once the input has ended
+  virtual void finish(const EMIT&) {}
+};
+
+// bounded queue of chunks between two stages, so a fast producer cannot run ahead
+class Channel {
+public:
+  // block while the channel is full; returns false if the consumer has gone away
+  bool push(Bytes&& chunk);
+  // block until a chunk arrives; returns false once the channel is closed and drained
+  bool pop(Bytes& chunk);
+  void close();
+
+private:
+  std::mutex mutex;
+  std::condition_variable not_empty;
+  std::condition_variable not_full;
+  std::deque<Bytes> chunks;
+  bool closed = false;
+};
+
+// build a stage from its name and arguments
+std::unique_ptr<Stage> make_stage(const std::vector<std::string>& args);
+
+// split a pipeline into stages at "|" tokens
+std::vector<std::vector<std::string> > parse_pipeline(const std::vector<std::string>& tokens);
+
+// split a single argument into tokens on whitespace, honouring single and double quotes
+std::vector<std::string> tokenize(const std::string& line);
+
+// read stdin through the stages on one thread each and write the result to stdout
+void run_pipeline(std::vector<std::unique_ptr<Stage> >& stages);
+
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2) {
+    std::cerr << "usage: " << argv[0] << " stage [args] ['|' stage [args] ...]\n"
+	      << "  or:  " << argv[0] << " 'stage [args] | stage [args] ...'\n"
+	      << "stages:\n"
+	      << "  hex, hexd             hex encode, decode\n"
+	      << "  b64, b64d             base64 encode, decode\n"
+	      << "  xor HEX               fixed xor with an equal length buffer\n"
+	      << "  rxor KEY              repeating key xor\n"
+	      << "  crack-sbx             break single byte xor\n"
+	      << "  crack-rxor            break repeating key xor\n"
+	      << "  aes-ecb, aes-ecb-d KEY  AES-128-ECB encrypt, decrypt, without padding\n"
+	      << "  pad, unpad [SIZE]     add, check and strip PKCS#7 padding (default 16)\n"
+	      << "  detect-ecb            count repeated 16 byte blocks" << std::endl;
+    return 1;
+  }
+
+  // a whole pipeline may be passed as one quoted argument
+  std::vector<std::string> tokens;
+  if (argc == 2) {
+    tokens = tokenize(argv[1]);
+  } else {
+    tokens.assign(argv + 1, argv + argc);
+  }
+
+  std::vector<std::unique_ptr<Stage> > stages;
+  for (auto& args : parse_pipeline(tokens)) {
+    stages.push_back(make_stage(args));
+  }
+
+  run_pipeline(stages);
+
+  return 0;
+}
+
+bool Channel::push(Bytes&& chunk)
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  not_full.wait(lock, [this] { return closed || chunks.size() < CHANNEL_CAPACITY; });
+  if (closed) {
+    return false;
+  }
+  chunks.push_back(std::move(chunk));
+  not_empty.notify_one();
+  return true;
+}
+
+bool Channel::pop(Bytes& chunk)
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  not_empty.wait(lock, [this] { return closed || !chunks.empty(); });
+  if (chunks.empty()) {
+    return false;
+  }
+  chunk = std::move(chunks.front());
+  chunks.pop_front();
+  not_full.notify_one();
+  return true;
+}
+
+void Channel::close()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  closed = true;
+  not_empty.notify_all();
+  not_full.notify_all();
+}
+
+class HexEncode : public Stage {
+public:
+  void process(Bytes&& chunk, const EMIT& emit) override {
+    Bytes out(chunk.size() * 2);
+    hex_encode(chunk, (char*) out.data());
+    emit(std::move(out));
+  }
+  void finish(const EMIT& emit) override { emit(str_to_bytes("\n")); }
+};
+
+class HexDecode : public Stage {
+public:
+  void process(Bytes&& chunk, const EMIT& emit) override {
+    // decode in place; whitespace is skipped and a digit may carry over to the next chunk
+    size_t n = 0;
+    for (byte ch : chunk) {
+      if (isspace(ch)) {
+	continue;
+      }
+      byte value = hex_to_bin(ch);
+      if (have_upper) {
+	chunk[n++] = (upper << NUM_HEX_BITS) | value;
+      } else {
+	upper = value;
+      }
+      have_upper = !have_upper;
+    }
+    chunk.resize(n);
+    emit(std::move(chunk));
+  }
+  void finish(const EMIT&) override {
+    if (have_upper) {
+      throw std::invalid_argument("odd number of hex digits");
+    }
+  }
+
+private:
+  byte upper = 0;
+  bool have_upper = false;
+};
+
+class Base64Encode : public Stage {
+public:
+  void process(Bytes&& chunk, const EMIT& emit) override {
+    Bytes out(base64_encoded_size(carry.size() + chunk.size()));
+    char* p = (char*) out.data();
+    size_t i = 0;
+
+    // complete the chunk left over from last time first
+    while (!carry.empty() && carry.size() < BYTES_IN_BASE64_CHUNK && i < chunk.size()) {
+      carry.push_back(chunk[i++]);
+    }
+    if (carry.size() == BYTES_IN_BASE64_CHUNK) {
+      chunk_to_base64(carry.data(), BYTES_IN_BASE64_CHUNK, p);
+      p += BASE64_CHARS_IN_CHUNK;
+      carry.clear();
+    }
+
+    size_t whole = (chunk.size() - i) / BYTES_IN_BASE64_CHUNK * BYTES_IN_BASE64_CHUNK;
+    base64_encode(chunk.subspan(i, whole), p);
+    p += whole / BYTES_IN_BASE64_CHUNK * BASE64_CHARS_IN_CHUNK;
+    carry.append(chunk.subspan(i + whole));
+
+    out.resize(p - (char*) out.data());
+    emit(std::move(out));
+  }
+  void finish(const EMIT& emit) override {
+    Bytes out(base64_encoded_size(carry.size()));
+    base64_encode(carry, (char*) out.data());
+    out.push_back('\n');
+    emit(std::move(out));
+  }
+
+private:
+  Bytes carry;
+};
+
+class Base64Decode : public Stage {
+public:
+  void process(Bytes&& chunk, const EMIT& emit) override {
+    // a quad the last chunk left unfinished is finished first and emitted on its own, since
+    // its bytes would otherwise be written over characters of this chunk not read yet
+    size_t i = 0;
+    if (num_chars > 0) {
+      byte head[BYTES_IN_BASE64_CHUNK];
+      size_t head_size = 0;
+      while (i < chunk.size() && num_chars > 0) {
+	head_size = add(chunk[i++], head);
+      }
+      emit(Bytes(ByteSpan(head, head_size)));
+    }
+
+    // decode the rest in place; output never overtakes input since 4 characters become 3 bytes
+    size_t n = 0;
+    for (; i < chunk.size(); i++) {
+      n += add(chunk[i], chunk.data() + n);
+    }
+    chunk.resize(n);
+    emit(std::move(chunk));
+  }
+  void finish(const EMIT&) override {
+    if (num_chars != 0) {
+      throw std::invalid_argument("truncated base64 input");
+    }
+  }
+
+private:
+  // take one character, and once it completes a quad write the quad's bytes to out; returns
+  // the number of bytes written
+  size_t add(byte ch, byte* out) {
+    if (isspace(ch)) {
+      return 0;
+    }
+    if (padding > 0) {
+      throw std::invalid_argument("base64 data after padding");
+    }
+    quad[num_chars++] = ch;
+    if (num_chars < BASE64_CHARS_IN_CHUNK) {
+      return 0;
+    }
+    uint32_t bits = 0;
+    for (int i = 0; i < BASE64_CHARS_IN_CHUNK; i++) {
+      bits = (bits << NUM_BASE64_BITS) | base64_char_to_bits(quad[i]);
+    }
+    padding = (quad[3] == '=') + (quad[2] == '=');
+    for (int i = 0; i < BYTES_IN_BASE64_CHUNK - padding; i++) {
+      out[i] = bits >> (8 * (BYTES_IN_BASE64_CHUNK - 1 - i));
+    }
+    num_chars = 0;
+    return BYTES_IN_BASE64_CHUNK - padding;
+  }
+
+  char quad[BASE64_CHARS_IN_CHUNK];
+  int num_chars = 0;
+  int padding = 0;
+};
+
+class FixedXor : public Stage {
+public:
+  explicit FixedXor(const std::string& hex) : key(hex_str_to_bytes(hex)) {}
+  void process(Bytes&& chunk, const EMIT& emit) override {
+    if (pos + chunk.size() > key.size()) {
+      throw std::invalid_argument("input is longer than the xor buffer");
+    }
+    for (size_t i = 0; i < chunk.size(); i++) {
+      chunk[i] ^= key[pos++];
+    }
+    emit(std::move(chunk));
+  }
+  void finish(const EMIT&) override {
+    if (pos != key.size()) {
+      throw std::invalid_argument("input is shorter than the xor buffer");
+    }
+  }
+
+private:
+  Bytes key;
+  size_t pos = 0;
+};
+
+class RepeatingKeyXor : public Stage {
+public:
+  explicit RepeatingKeyXor(const std::string& key) : key(str_to_bytes(key)) {
+    if (key.empty()) {
+      throw std::invalid_argument("key must not be empty");
+    }
+  }
+  void process(Bytes&& chunk, const EMIT& emit) override {
+    // the key position carries across chunks
+    for (size_t i = 0; i < chunk.size(); i++) {
+      chunk[i] ^= key[key_pos];
+      if (++key_pos == key.size()) {
+	key_pos = 0;
+      }
+    }
+    emit(std::move(chunk));
+  }
+
+private:
+  Bytes key;
+  size_t key_pos = 0;
+};
+
+// stages that need the whole input before they can answer
+class Buffered : public Stage {
+public:
+  void process(Bytes&& chunk, const EMIT&) override {
+    if (input.empty()) {
+      input = std::move(chunk);
+    } else {
+      input.append(chunk);
+    }
+  }
+
+protected:
+  Bytes input;
+};
+
+class CrackSingleByteXor : public Buffered {
+public:
+  void finish(const EMIT& emit) override {
+    std::vector<KeyScore> keys = rank_single_byte_keys(input);
+    if (keys.empty()) {
+      throw std::runtime_error("no reasonable plaintext found");
+    }
+    std::cerr << "key " << bytes_to_hex(ByteSpan(&keys[0].key, 1)) << std::endl;
+    Bytes plaintext(input.size());
+    single_byte_xor(input, keys[0].key, plaintext);
+    emit(std::move(plaintext));
+  }
+};
+
+class CrackRepeatingKeyXor : public Buffered {
+public:
+  void finish(const EMIT& emit) override {
+    // the hamming distance over four blocks is noisy, so the best few keysizes are each
+    // broken and the key whose decryption looks most like english wins
+    std::vector<RepeatingKey> keys = rank_repeating_keys(input, NUM_KEYSIZE_CANDIDATES);
+    Bytes& key = keys[0].key;
+    std::cerr << "keylength " << key.size() << " key " << bytes_to_hex(key) << std::endl;
+
+    emit(repeating_key_xor(input, key));
+  }
+};
+
+class AesEcb : public Stage {
+public:
+  AesEcb(const std::string& key, bool encrypt) : ctx(EVP_CIPHER_CTX_new(), ::EVP_CIPHER_CTX_free) {
+    if (key.size() != AES_KEY_SIZE) {
+      throw std::invalid_argument("AES-128 key must be 16 bytes");
+    }
+    if (EVP_CipherInit_ex(ctx.get(), EVP_aes_128_ecb(), NULL, (const byte*) key.data(), NULL, encrypt) != 1)
+      throw std::runtime_error("EVP_CipherInit_ex failed");
+    // padding is left to the pad and unpad stages
+    EVP_CIPHER_CTX_set_padding(ctx.get(), 0);
+  }
+  void process(Bytes&& chunk, const EMIT& emit) override {
+    size_t total = tail_size + chunk.size();
+    size_t whole = total - total % AES_BLOCK_SIZE;
+    if (whole == 0) {
+      memcpy(tail + tail_size, chunk.data(), chunk.size());
+      tail_size = total;
+      return;
+    }
+
+    // the whole blocks are ciphered in place in the chunk; only a partial block is carried
+    // over, and a carried one is moved in front of the chunk to start its first block
+    byte next_tail[AES_BLOCK_SIZE];
+    size_t next_size = total - whole;
+    memcpy(next_tail, chunk.end() - next_size, next_size);
+    if (tail_size > 0) {
+      size_t size = chunk.size();
+      chunk.reserve(total);
+      chunk.resize(total);
+      memmove(chunk.data() + tail_size, chunk.data(), size);
+      memcpy(chunk.data(), tail, tail_size);
+    }
+    chunk.resize(whole);
+    memcpy(tail, next_tail, next_size);
+    tail_size = next_size;
+
+    // with padding off and whole blocks in, every update ciphers all it is given
+    for (size_t i = 0; i < whole; i += AES_UPDATE_CHUNK) {
+      int chunk_len = std::min(AES_UPDATE_CHUNK, whole - i);
+      int out_len = 0;
+      if (EVP_CipherUpdate(ctx.get(), chunk.data() + i, &out_len, chunk.data() + i, chunk_len) != 1
+	  || out_len != chunk_len)
+	throw std::runtime_error("EVP_CipherUpdate failed");
+    }
+    emit(std::move(chunk));
+  }
+  void finish(const EMIT&) override {
+    if (tail_size != 0)
+      throw std::invalid_argument("input is not a whole number of blocks");
+  }
+
+private:
+  EVP_CIPHER_CTX_free_ptr ctx;
+  // input after the last whole block
+  byte tail[AES_BLOCK_SIZE];
+  size_t tail_size = 0;
+};
+
+class Pad : public Stage {
+public:
+  explicit Pad(size_t block_size) : block_size(block_size) {
+    if (block_size == 0 || block_size > 255) {
+      throw std::invalid_argument("block size must be between 1 and 255");
+    }
+  }
+  void process(Bytes&& chunk, const EMIT& emit) override {
+    total += chunk.size();
+    emit(std::move(chunk));
+  }
+  void finish(const EMIT& emit) override {
+    // only the length of the final partial block decides the padding
+    Bytes tail(total % block_size);
+    pkcs7_pad(tail, block_size);
+    Bytes padding;
+    padding.append(tail.subspan(total % block_size));
+    emit(std::move(padding));
+  }
+
+private:
+  size_t block_size;
+  size_t total = 0;
+};
+
+class Unpad : public Stage {
+public:
+  explicit Unpad(size_t block_size) : block_size(block_size) {
+    if (block_size == 0 || block_size > 255) {
+      throw std::invalid_argument("block size must be between 1 and 255");
+    }
+  }
+  void process(Bytes&& chunk, const EMIT& emit) override {
+    // hold back the last block_size bytes, which may turn out to be the padding
+    if (chunk.size() >= block_size) {
+      emit(std::move(tail));
+      tail = Bytes();
+      tail.append(chunk.subspan(chunk.size() - block_size));
+      chunk.resize(chunk.size() - block_size);
+      emit(std::move(chunk));
+    } else {
+      tail.append(chunk);
+      if (tail.size() > block_size) {
+	Bytes rest;
+	rest.append(tail.subspan(tail.size() - block_size));
+	tail.resize(tail.size() - block_size);
+	emit(std::move(tail));
+	tail = std::move(rest);
+      }
+    }
+  }
+  void finish(const EMIT& emit) override {
+    if (tail.size() != block_size || !valid_pkcs7(tail.data(), tail.size())) {
+      throw std::invalid_argument("bad PKCS#7 padding");
+    }
+    tail.resize(tail.size() - tail[tail.size() - 1]);
+    emit(std::move(tail));
+  }
+
+private:
+  size_t block_size;
+  Bytes tail;
+};
+
+class DetectEcb : public Buffered {
+public:
+  void finish(const EMIT& emit) override {
+    std::vector<BLOCK> blocks;
+    unsigned duplicates = count_duplicate_blocks(input, blocks);
+    std::string report = std::to_string(duplicates) + "/" + std::to_string(input.size() / AES_BLOCK_SIZE)
+      + " duplicate blocks (" + (duplicates > 0 ? "ecb" : "not ecb") + ")\n";
+    emit(str_to_bytes(report));
+  }
+};
+
+std::unique_ptr<Stage> make_stage(const std::vector<std::string>& args)
+{
+  const std::string& name = args[0];
+  size_t num_args = args.size() - 1;
+  auto arg = [&](size_t i, const std::string& fallback) { return i <= num_args ? args[i] : fallback; };
+  auto require = [&](size_t min, size_t max) {
+    if (num_args < min || num_args > max) {
+      throw std::invalid_argument("wrong number of arguments to " + name);
+    }
+  };
+
+  if (name == "hex") {
+    require(0, 0);
+    return std::unique_ptr<Stage>(new HexEncode());
+  } else if (name == "hexd") {
+    require(0, 0);
+    return std::unique_ptr<Stage>(new HexDecode());
+  } else if (name == "b64") {
+    require(0, 0);
+    return std::unique_ptr<Stage>(new Base64Encode());
+  } else if (name == "b64d") {
+    require(0, 0);
+    return std::unique_ptr<Stage>(new Base64Decode());
+  } else if (name == "xor") {
+    require(1, 1);
+    return std::unique_ptr<Stage>(new FixedXor(args[1]));
+  } else if (name == "rxor") {
+    require(1, 1);
+    return std::unique_ptr<Stage>(new RepeatingKeyXor(args[1]));
+  } else if (name == "crack-sbx") {
+    require(0, 0);
+    return std::unique_ptr<Stage>(new CrackSingleByteXor());
+  } else if (name == "crack-rxor") {
+    require(0, 0);
+    return std::unique_ptr<Stage>(new CrackRepeatingKeyXor());
+  } else if (name == "aes-ecb" || name == "aes-ecb-d") {
+    require(1, 1);
+    return std::unique_ptr<Stage>(new AesEcb(args[1], name == "aes-ecb"));
+  } else if (name == "pad") {
+    require(0, 1);
+    return std::unique_ptr<Stage>(new Pad(std::stoul(arg(1, "16"))));
+  } else if (name == "unpad") {
+    require(0, 1);
+    return std::unique_ptr<Stage>(new Unpad(std::stoul(arg(1, "16"))));
+  } else if (name == "detect-ecb") {
+    require(0, 0);
+    return std::unique_ptr<Stage>(new DetectEcb());
+  }
+
+  throw std::invalid_argument("unknown stage " + name);
+}
+
+std::vector<std::vector<std::string> > parse_pipeline(const std::vector<std::string>& tokens)
+{
+  std::vector<std::vector<std::string> > stages(1);
+  for (auto& token : tokens) {
+    if (token == "|") {
+      stages.emplace_back();
+    } else {
+      stages.back().push_back(token);
+    }
+  }
+
+  for (auto& stage : stages) {
+    if (stage.empty()) {
+      throw std::invalid_argument("empty pipeline stage");
+    }
+  }
+  return stages;
+}
+
+std::vector<std::string> tokenize(const std::string& line)
+{
+  std::vector<std::string> tokens;
+  std::string token;
+  bool in_token = false;
+  char quote = 0;
+
+  for (char ch : line) {
+    if (quote) {
+      if (ch == quote) {
+	quote = 0;
+      } else {
+	token.push_back(ch);
+      }
+    } else if (ch == '\'' || ch == '"') {
+      quote = ch;
+      in_token = true;
+    } else if (isspace((unsigned char) ch) || ch == '|') {
+      if (in_token) {
+	tokens.push_back(token);
+	token.clear();
+	in_token = false;
+      }
+      if (ch == '|') {
+	tokens.push_back("|");
+      }
+    } else {
+      token.push_back(ch);
+      in_token = true;
+    }
+  }
+
+  if (quote) {
+    throw std::invalid_argument("unterminated quote");
+  }
+  if (in_token) {
+    tokens.push_back(token);
+  }
+  return tokens;
+}
+
+void run_pipeline(std::vector<std::unique_ptr<Stage> >& stages)
+{
+  // channels[i] feeds stage i; the last channel feeds the writer
+  std::vector<Channel> channels(stages.size() + 1);
+  std::vector<std::exception_ptr> errors(stages.size() + 1);
+  std::vector<std::thread> threads;
+
+  for (size_t i = 0; i < stages.size(); i++) {
+    threads.emplace_back([&, i] {
+      Channel& in = channels[i];
+      Channel& out = channels[i + 1];
+      EMIT emit = [&](Bytes&& chunk) {
+	if (!chunk.empty() && !out.push(std::move(chunk))) {
+	  throw PipelineClosed();
+	}
+      };
+
+      try {
+	Bytes chunk;
+	while (in.pop(chunk)) {
+	  stages[i]->process(std::move(chunk), emit);
+	}
+	stages[i]->finish(emit);
+      } catch (const PipelineClosed&) {
+	in.close();
+      } catch (...) {
+	errors[i] = std::current_exception();
+	in.close();
+      }
+      out.close();
+    });
+  }
+
+  threads.emplace_back([&] {
+    try {
+      Bytes chunk;
+      while (channels.back().pop(chunk)) {
+	size_t offset = 0;
+	while (offset < chunk.size()) {
+	  ssize_t n = write(STDOUT_FILENO, chunk.data() + offset, chunk.size() - offset);
+	  if (n < 0 && errno != EINTR) {
+	    throw std::runtime_error("write failed");
+	  }
+	  offset += std::max<ssize_t>(n, 0);
+	}
+      }
+    } catch (...) {
+      errors.back() = std::current_exception();
+      channels.back().close();
+    }
+  });
+
+  // stdin is read on this thread in large chunks that move down the pipeline without copies
+  for (;;) {
+    Bytes chunk(CHUNK_SIZE);
+    ssize_t n = read(STDIN_FILENO, chunk.data(), chunk.size());
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n < 0) {
+      channels[0].close();
+      for (auto& thread : threads) {
+	thread.join();
+      }
+      throw std::runtime_error("read failed");
+    }
+    if (n == 0) {
+      break;
+    }
+    chunk.resize(n);
+    if (!channels[0].push(std::move(chunk))) {
+      break;
+    }
+  }
+  channels[0].close();
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // report the first failure in pipeline order
+  for (auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
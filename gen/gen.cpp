@@ -0,0 +1,348 @@
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <openssl/evp.h>
+#include <unistd.h>
+
+#include "../solutions/common/aes.h"
+#include "../solutions/common/bytes.h"
+#include "../solutions/common/encoding.h"
+#include "../solutions/common/output.h"
+#include "../solutions/common/plaintext.h"
+#include "../solutions/common/random.h"
+#include "../solutions/common/size.h"
+#include "../solutions/common/xor.h"
+
+#define BASE64_LINE_LENGTH 60
+#define DEFAULT_SEED 1
+// relative to the current directory, so gen runs from the repository root unless -w is given
+#define DEFAULT_WORDLIST "solutions/3/wordlist.txt"
+
+// corpus options; counts and lengths default per mode when left at 0
+struct Options {
+  uint64_t seed;
+  size_t count;
+  size_t length;
+  std::vector<size_t> key_lengths;
+  size_t num_ecb;
+  bool base64;
+  bool cbc;
+  std::string wordlist_file;
+};
+
+// single byte xor lines with one hidden english line (challenge 4)
+size_t generate_single_byte_xor(const Options& options, const std::vector<std::string>& words,
+				Output& out, std::ostream& truth);
+
+// repeating key xor ciphertexts of english text, one key length after another (challenge 6)
+size_t generate_repeating_key_xor(const Options& options, const std::vector<std::string>& words,
+				  Output& out, std::ostream& truth);
+
+// AES-128 ECB or CBC encrypted english text (challenge 7)
+size_t generate_aes(const Options& options, const std::vector<std::string>& words,
+		    Output& out, std::ostream& truth);
+
+// random lines with some AES-128-ECB lines of repetitive plaintext mixed in (challenge 8)
+size_t generate_ecb_lines(const Options& options, const std::vector<std::string>& words,
+			  Output& out, std::ostream& truth);
+
+// write bytes as one hex or base64 line
+void write_line(Output& out, ByteSpan bytes, bool base64);
+
+// write bytes as base64 wrapped at BASE64_LINE_LENGTH characters, like the challenge files
+void write_wrapped_base64(Output& out, ByteSpan bytes);
+
+// encrypt ptext with AES-128 in ECB or CBC mode, with padding
+Bytes encrypt_aes(const EVP_CIPHER* cipher, ByteSpan key, ByteSpan iv, ByteSpan ptext);
+
+void usage(const char* program);
+
+
+int main(int argc, char* argv[])
+{
+  Options options = {DEFAULT_SEED, 0, 0, {}, 1, false, false, DEFAULT_WORDLIST};
+  std::string output_file;
+  std::string truth_file;
+
+  if (argc < 2) {
+    usage(argv[0]);
+    return 1;
+  }
+  std::string mode = argv[1];
+  optind = 2;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "s:n:l:k:e:bco:g:w:")) != -1) {
+    switch (opt) {
+    case 's': options.seed = std::stoull(optarg); break;
+    case 'n': options.count = parse_size(optarg); break;
+    case 'l': options.length = parse_size(optarg); break;
+    case 'k': {
+      std::istringstream lengths(optarg);
+      std::string length;
+      while (std::getline(lengths, length, ',')) {
+	options.key_lengths.push_back(std::max(1ul, std::stoul(length)));
+      }
+      break;
+    }
+    case 'e': options.num_ecb = parse_size(optarg); break;
+    case 'b': options.base64 = true; break;
+    case 'c': options.cbc = true; break;
+    case 'o': output_file = optarg; break;
+    case 'g': truth_file = optarg; break;
+    case 'w': options.wordlist_file = optarg; break;
+    default:
+      usage(argv[0]);
+      return 1;
+    }
+  }
+
+  std::set<std::string> wordlist = read_wordlist(options.wordlist_file);
+  std::vector<std::string> words(wordlist.begin(), wordlist.end());
+  if (words.empty()) {
+    throw std::runtime_error("wordlist is empty");
+  }
+
+  int fd = STDOUT_FILENO;
+  if (!output_file.empty()) {
+    fd = open(output_file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1) {
+      throw std::invalid_argument("unable to open output file");
+    }
+  }
+
+  std::ofstream truth_stream;
+  if (!truth_file.empty()) {
+    truth_stream.open(truth_file);
+    if (!truth_stream) {
+      throw std::invalid_argument("unable to open truth file");
+    }
+  }
+  std::ostream& truth = truth_file.empty() ? std::cerr : truth_stream;
+
+  auto start = std::chrono::steady_clock::now();
+  size_t num_records;
+  size_t size;
+  {
+    Output out(fd);
+    if (mode == "sbx") {
+      num_records = generate_single_byte_xor(options, words, out, truth);
+    } else if (mode == "rxor") {
+      num_records = generate_repeating_key_xor(options, words, out, truth);
+    } else if (mode == "aes") {
+      num_records = generate_aes(options, words, out, truth);
+    } else if (mode == "ecb") {
+      num_records = generate_ecb_lines(options, words, out, truth);
+    } else {
+      throw std::invalid_argument("unknown mode " + mode);
+    }
+    out.flush();
+    size = out.bytes_written();
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  if (fd != STDOUT_FILENO) {
+    close(fd);
+  }
+
+  std::cerr << num_records << " records, " << size << " bytes in " << elapsed.count() << " s ("
+	    << size / elapsed.count() / 1e6 << " MB/s)" << std::endl;
+
+  return 0;
+}
+
+size_t generate_single_byte_xor(const Options& options, const std::vector<std::string>& words,
+				Output& out, std::ostream& truth)
+{
+  // challenge 4 has 327 lines of 30 bytes
+  size_t count = options.count ? options.count : 327;
+  size_t length = options.length ? options.length : 30;
+
+  Prng prng(options.seed);
+  size_t hidden_line = prng.uniform(count);
+  Bytes bytes(length);
+
+  for (size_t line = 0; line < count; line++) {
+    if (line == hidden_line) {
+      byte key = prng.next();
+      std::string ptext = random_text(words, length, prng);
+      single_byte_xor(ByteSpan(ptext), key, bytes);
+      truth << "line " << line + 1 << " key " << bytes_to_hex(ByteSpan(&key, 1)) << " " << ptext << std::endl;
+    } else {
+      prng.fill(bytes);
+    }
+    write_line(out, bytes, options.base64);
+  }
+
+  return count;
+}
+
+size_t generate_repeating_key_xor(const Options& options, const std::vector<std::string>& words,
+				  Output& out, std::ostream& truth)
+{
+  // challenge 6 is 2876 bytes under a 29 byte key
+  size_t count = options.count ? options.count : 1;
+  size_t length = options.length ? options.length : 2876;
+  std::vector<size_t> key_lengths = options.key_lengths;
+  if (key_lengths.empty()) {
+    key_lengths.push_back(29);
+  }
+
+  Prng prng(options.seed);
+  for (size_t i = 0; i < count; i++) {
+    Bytes key(key_lengths[i % key_lengths.size()]);
+    prng.fill(key);
+    Bytes ctext = repeating_key_xor(str_to_bytes(random_text(words, length, prng)), key);
+
+    // a single ciphertext is wrapped like the challenge file; several go one per line
+    if (count == 1) {
+      write_wrapped_base64(out, ctext);
+    } else {
+      write_line(out, ctext, true);
+    }
+    truth << "ciphertext " << i + 1 << " keylength " << key.size() << " key " << bytes_to_hex(key) << std::endl;
+  }
+
+  return count;
+}
+
+size_t generate_aes(const Options& options, const std::vector<std::string>& words,
+		    Output& out, std::ostream& truth)
+{
+  size_t count = options.count ? options.count : 1;
+  size_t length = options.length ? options.length : 2876;
+  const EVP_CIPHER* cipher = options.cbc ? EVP_aes_128_cbc() : EVP_aes_128_ecb();
+
+  Prng prng(options.seed);
+  Bytes key(AES_KEY_SIZE);
+  Bytes iv(AES_BLOCK_SIZE);
+  for (size_t i = 0; i < count; i++) {
+    prng.fill(key);
+    if (options.cbc) {
+      prng.fill(iv);
+    }
+    Bytes ctext = encrypt_aes(cipher, key, iv, str_to_bytes(random_text(words, length, prng)));
+
+    if (count == 1) {
+      write_wrapped_base64(out, ctext);
+    } else {
+      write_line(out, ctext, true);
+    }
+    truth << "blob " << i + 1 << " mode " << (options.cbc ? "cbc" : "ecb") << " key " << bytes_to_hex(key);
+    if (options.cbc) {
+      truth << " iv " << bytes_to_hex(iv);
+    }
+    truth << std::endl;
+  }
+
+  return count;
+}
+
+size_t generate_ecb_lines(const Options& options, const std::vector<std::string>& words,
+			  Output& out, std::ostream& truth)
+{
+  // challenge 8 has 204 lines of 160 bytes
+  size_t count = options.count ? options.count : 204;
+  size_t length = options.length ? options.length : 160;
+  size_t num_ecb = std::min(options.num_ecb, count);
+  length = std::max<size_t>(length / AES_BLOCK_SIZE, 2) * AES_BLOCK_SIZE;
+
+  Prng prng(options.seed);
+
+  // pick distinct ECB lines up front so the rest of the stream does not depend on the order
+  std::vector<bool> is_ecb(count, false);
+  for (size_t picked = 0; picked < num_ecb; ) {
+    size_t line = prng.uniform(count);
+    if (!is_ecb[line]) {
+      is_ecb[line] = true;
+      picked++;
+    }
+  }
+
+  Bytes key(AES_KEY_SIZE);
+  prng.fill(key);
+  truth << "key " << bytes_to_hex(key) << std::endl;
+
+  // a handful of plaintext blocks repeated in random order, so duplicates survive encryption;
+  // the padding block pushes the ciphertext one block past length, so it is cut off
+  const size_t num_distinct = 4;
+  Bytes ptext(length - AES_BLOCK_SIZE);
+  Bytes bytes(length);
+  for (size_t line = 0; line < count; line++) {
+    if (is_ecb[line]) {
+      std::string distinct = random_text(words, num_distinct * AES_BLOCK_SIZE, prng);
+      for (size_t i = 0; i < ptext.size(); i += AES_BLOCK_SIZE) {
+	memcpy(ptext.data() + i, &distinct[prng.uniform(num_distinct) * AES_BLOCK_SIZE], AES_BLOCK_SIZE);
+      }
+      Bytes ctext = encrypt_aes(EVP_aes_128_ecb(), key, ByteSpan(), ptext);
+      write_line(out, ctext.subspan(0, length), options.base64);
+      truth << "line " << line + 1 << std::endl;
+    } else {
+      prng.fill(bytes);
+      write_line(out, bytes, options.base64);
+    }
+  }
+
+  return count;
+}
+
+void write_line(Output& out, ByteSpan bytes, bool base64)
+{
+  if (base64) {
+    out.write_base64(bytes);
+  } else {
+    out.write_hex(bytes);
+  }
+  out.put('\n');
+}
+
+void write_wrapped_base64(Output& out, ByteSpan bytes)
+{
+  // every full line encodes the same number of bytes, so lines can be encoded one by one
+  const size_t line_bytes = BASE64_LINE_LENGTH / 4 * 3;
+  for (size_t i = 0; i < bytes.size(); i += line_bytes) {
+    out.write_base64(bytes.subspan(i, line_bytes));
+    out.put('\n');
+  }
+}
+
+Bytes encrypt_aes(const EVP_CIPHER* cipher, ByteSpan key, ByteSpan iv, ByteSpan ptext)
+{
+  EVP_CIPHER_CTX_free_ptr ctx(EVP_CIPHER_CTX_new(), ::EVP_CIPHER_CTX_free);
+  if (EVP_EncryptInit_ex(ctx.get(), cipher, NULL, key.data(), iv.empty() ? NULL : iv.data()) != 1)
+    throw std::runtime_error("EVP_EncryptInit_ex failed");
+
+  // OpenSSL takes an int length, so multi-GB plaintexts go in whole-block chunks
+  Bytes ctext(ptext.size() + AES_BLOCK_SIZE);
+  size_t out_len = 0;
+  for (size_t i = 0; i < ptext.size(); i += AES_UPDATE_CHUNK) {
+    int chunk_len = std::min(AES_UPDATE_CHUNK, ptext.size() - i);
+    int n = 0;
+    if (EVP_EncryptUpdate(ctx.get(), ctext.data() + out_len, &n, ptext.data() + i, chunk_len) != 1)
+      throw std::runtime_error("EVP_EncryptUpdate failed");
+    out_len += n;
+  }
+
+  int n = 0;
+  if (EVP_EncryptFinal_ex(ctx.get(), ctext.data() + out_len, &n) != 1)
+    throw std::runtime_error("EVP_EncryptFinal_ex failed");
+
+  ctext.resize(out_len + n);
+  return ctext;
+}
+
+void usage(const char* program)
+{
+  std::cerr << "usage: " << program << " sbx|rxor|aes|ecb [-s seed] [-n count] [-l length]"
+	    << " [-k key_lengths] [-e ecb_lines] [-b] [-c] [-o output] [-g truth] [-w wordlist]\n"
+	    << "the wordlist defaults to " DEFAULT_WORDLIST ", relative to the current directory" << std::endl;
+}
@@ -0,0 +1,121 @@
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#define NGRAM_NO_TABLES
+#include "../solutions/common/ngram.h"
+
+#define VALUES_PER_LINE 16
+
+// write one table as a constexpr array
+void write_table(const std::string& name, const std::vector<double>& log_probs);
+
+
+int main(int argc, char* argv[])
+{
+  std::string source = "stdin";
+
+  int opt;
+  while ((opt = getopt(argc, argv, "s:")) != -1) {
+    switch (opt) {
+    case 's': source = optarg; break;
+    default:
+      std::cerr << "usage: " << argv[0] << " [-s source_name] < english.txt > solutions/common/ngram_tables.h" << std::endl;
+      return 1;
+    }
+  }
+
+  std::string text(std::istreambuf_iterator<char>(std::cin), {});
+  if (text.size() < 3) {
+    std::cerr << "training text is too short" << std::endl;
+    return 1;
+  }
+
+  const size_t num_classes = NGRAM_NUM_CLASSES;
+  std::vector<double> byte_counts(256, 0);
+  std::vector<double> class_counts(num_classes, 0);
+  std::vector<double> bigram_counts(num_classes * num_classes, 0);
+  std::vector<double> trigram_counts(num_classes * num_classes * num_classes, 0);
+
+  for (size_t i = 0; i < text.size(); i++) {
+    unsigned c = NGRAM_CLASS[(uint8_t) text[i]];
+    byte_counts[(uint8_t) text[i]]++;
+    class_counts[c]++;
+    if (i >= 1) {
+      unsigned b = NGRAM_CLASS[(uint8_t) text[i - 1]];
+      bigram_counts[b * num_classes + c]++;
+      if (i >= 2) {
+	unsigned a = NGRAM_CLASS[(uint8_t) text[i - 2]];
+	trigram_counts[(a * num_classes + b) * num_classes + c]++;
+      }
+    }
+  }
+
+  // add-one smoothing for single bytes and classes; bigrams back off to classes and
+  // trigrams to bigrams, so unseen sequences still get a finite, ordered cost
+  std::vector<double> byte_log_probs(256);
+  for (unsigned ch = 0; ch < 256; ch++) {
+    byte_log_probs[ch] = log2((byte_counts[ch] + 1) / (text.size() + 256));
+  }
+
+  std::vector<double> class_probs(num_classes);
+  for (unsigned c = 0; c < num_classes; c++) {
+    class_probs[c] = (class_counts[c] + 1) / (text.size() + num_classes);
+  }
+
+  std::vector<double> bigram_probs(num_classes * num_classes);
+  std::vector<double> bigram_log_probs(num_classes * num_classes);
+  for (unsigned b = 0; b < num_classes; b++) {
+    double total = 0;
+    for (unsigned c = 0; c < num_classes; c++) {
+      total += bigram_counts[b * num_classes + c];
+    }
+    for (unsigned c = 0; c < num_classes; c++) {
+      double p = (bigram_counts[b * num_classes + c] + class_probs[c]) / (total + 1);
+      bigram_probs[b * num_classes + c] = p;
+      // stored as the joint log probability of the pair, which starts a text
+      bigram_log_probs[b * num_classes + c] = log2(p * class_probs[b]);
+    }
+  }
+
+  std::vector<double> trigram_log_probs(num_classes * num_classes * num_classes);
+  for (unsigned ab = 0; ab < num_classes * num_classes; ab++) {
+    unsigned b = ab % num_classes;
+    double total = 0;
+    for (unsigned c = 0; c < num_classes; c++) {
+      total += trigram_counts[ab * num_classes + c];
+    }
+    for (unsigned c = 0; c < num_classes; c++) {
+      double p = (trigram_counts[ab * num_classes + c] + bigram_probs[b * num_classes + c]) / (total + 1);
+      trigram_log_probs[ab * num_classes + c] = log2(p);
+    }
+  }
+
+  std::cout << "// generated by gen/ngrams.cpp from " << source << " (" << text.size() << " bytes); do not edit\n"
+	    << "#ifndef CRYPTOPALS_NGRAM_TABLES_H\n"
+	    << "#define CRYPTOPALS_NGRAM_TABLES_H\n\n"
+	    << "#include <cstdint>\n\n";
+  write_table("NGRAM_BYTE_LOG_PROB", byte_log_probs);
+  write_table("NGRAM_BIGRAM_LOG_PROB", bigram_log_probs);
+  write_table("NGRAM_TRIGRAM_LOG_PROB", trigram_log_probs);
+  std::cout << "#endif" << std::endl;
+
+  return 0;
+}
+
+void write_table(const std::string& name, const std::vector<double>& log_probs)
+{
+  std::cout << "constexpr int16_t " << name << "[" << log_probs.size() << "] = {";
+  for (size_t i = 0; i < log_probs.size(); i++) {
+    if (i % VALUES_PER_LINE == 0) {
+      std::cout << "\n ";
+    }
+    std::cout << " " << lround(log_probs[i] * NGRAM_SCALE) << (i + 1 < log_probs.size() ? "," : "");
+  }
+  std::cout << "\n};\n\n";
+}
@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <unistd.h>
+
+#include "../common/random_pool.h"
+
+static const unsigned int KEY_SIZE = 16;
+static const unsigned int BLOCK_SIZE = 16;
+static const unsigned int MIN_PAD_SIZE = 5;
+static const unsigned int MAX_PAD_SIZE = 10;
+
+using EVP_CIPHER_CTX_free_ptr = std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)>;
+
+enum Mode { ECB, CBC };
+
+// encrypts input under a random key with random padding on both sides, using
+// ECB or CBC at random; returns the ciphertext and the mode that was chosen
+class EncryptionOracle {
+public:
+  EncryptionOracle();
+  Mode encrypt(const std::string& input, std::string& ctext);
+
+private:
+  EVP_CIPHER_CTX_free_ptr ctx;
+  std::string ptext;
+};
+
+// guess the mode from a ciphertext of input containing repeated blocks
+Mode detect_mode(const std::string& ctext);
+
+// run iterations of oracle + detection per thread, returning the number of correct guesses
+size_t run_oracle(size_t iterations);
+
+
+int main(int argc, char* argv[])
+{
+  size_t iterations = 100000;
+  unsigned num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+  int opt;
+  while ((opt = getopt(argc, argv, "n:t:u")) != -1) {
+    switch (opt) {
+    case 'n': iterations = std::stoul(optarg); break;
+    case 't': num_threads = std::max(1ul, std::stoul(optarg)); break;
+    case 'u': RandomPool::buffered = false; break;
+    default:
+      std::cerr << "usage: " << argv[0] << " [-n iterations] [-t threads] [-u]" << std::endl;
+      return 1;
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+
+  std::atomic<size_t> correct(0);
+  std::vector<std::thread> workers;
+  for (unsigned i = 0; i < num_threads; i++) {
+    size_t share = iterations / num_threads + (i < iterations % num_threads ? 1 : 0);
+    workers.emplace_back([&correct, share] { correct += run_oracle(share); });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  std::cout << "Detected " << correct << "/" << iterations << " modes correctly" << std::endl;
+  std::cerr << iterations << " oracle calls in " << elapsed.count() << " s ("
+	    << iterations / elapsed.count() << " calls/s, " << num_threads << " threads, "
+	    << (RandomPool::buffered ? "buffered" : "unbuffered") << " random bytes)" << std::endl;
+
+  return 0;
+}
+
+size_t run_oracle(size_t iterations)
+{
+  // three identical blocks guarantee two aligned duplicates whatever the prefix length
+  const std::string input(3 * BLOCK_SIZE, 'A');
+  EncryptionOracle oracle;
+  std::string ctext;
+  size_t correct = 0;
+
+  for (size_t i = 0; i < iterations; i++) {
+    Mode mode = oracle.encrypt(input, ctext);
+    if (detect_mode(ctext) == mode) {
+      correct++;
+    }
+  }
+
+  return correct;
+}
+
+Mode detect_mode(const std::string& ctext)
+{
+  for (size_t i = 0; i + 2 * BLOCK_SIZE <= ctext.size(); i += BLOCK_SIZE) {
+    if (memcmp(&ctext[i], &ctext[i + BLOCK_SIZE], BLOCK_SIZE) == 0)
+      return ECB;
+  }
+  return CBC;
+}
+
+EncryptionOracle::EncryptionOracle()
+  : ctx(EVP_CIPHER_CTX_new(), ::EVP_CIPHER_CTX_free)
+{
+}
+
+Mode EncryptionOracle::encrypt(const std::string& input, std::string& ctext)
+{
+  RandomPool& random = RandomPool::local();
+
+  // key, iv, both pad lengths and the mode all come from one pool
+  byte key[KEY_SIZE];
+  byte iv[BLOCK_SIZE];
+  random.bytes(key, KEY_SIZE);
+  random.bytes(iv, BLOCK_SIZE);
+  unsigned prefix_size = random.uniform(MIN_PAD_SIZE, MAX_PAD_SIZE);
+  unsigned suffix_size = random.uniform(MIN_PAD_SIZE, MAX_PAD_SIZE);
+  Mode mode = random.uniform(0, 1) ? CBC : ECB;
+
+  ptext.resize(prefix_size + input.size() + suffix_size);
+  random.bytes((byte*) &ptext[0], prefix_size);
+  memcpy(&ptext[prefix_size], input.data(), input.size());
+  random.bytes((byte*) &ptext[prefix_size + input.size()], suffix_size);
+
+  int rc = EVP_EncryptInit_ex(ctx.get(), mode == ECB ? EVP_aes_128_ecb() : EVP_aes_128_cbc(),
+			      NULL, key, mode == ECB ? NULL : iv);
+  OPENSSL_cleanse(key, KEY_SIZE);
+  if (rc != 1)
+    throw std::runtime_error("EVP_EncryptInit_ex failed");
+
+  ctext.resize(ptext.size() + BLOCK_SIZE);
+  int out_len1 = (int) ctext.size();
+  rc = EVP_EncryptUpdate(ctx.get(), (byte*) &ctext[0], &out_len1, (const byte*) ptext.data(), (int) ptext.size());
+  if (rc != 1)
+    throw std::runtime_error("EVP_EncryptUpdate failed");
+
+  int out_len2 = (int) ctext.size() - out_len1;
+  rc = EVP_EncryptFinal_ex(ctx.get(), (byte*) &ctext[0] + out_len1, &out_len2);
+  if (rc != 1)
+    throw std::runtime_error("EVP_EncryptFinal_ex failed");
+
+  ctext.resize(out_len1 + out_len2);
+  return mode;
+}
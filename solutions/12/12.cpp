@@ -0,0 +1,242 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include <openssl/evp.h>
+#include <unistd.h>
+
+#include "../common/aes.h"
+#include "../common/blocks.h"
+#include "../common/random_pool.h"
+
+static const unsigned int KEY_SIZE = 16;
+static const unsigned int BLOCK_SIZE = 16;
+static const unsigned int MAX_BLOCK_SIZE = 64;
+static const unsigned int MAX_PREFIX_SIZE = 64;
+static const unsigned int NUM_GUESSES = 256;
+
+// an encryption oracle: encrypts attacker controlled input into ctext
+typedef std::function<void(const secure_string& input, secure_string& ctext)> ORACLE;
+
+struct BlockHash {
+  size_t operator()(const BLOCK& block) const {
+    // ciphertext blocks are uniformly distributed, so any 8 bytes make a good hash
+    return block[0];
+  }
+};
+
+// properties of the oracle discovered before the byte-at-a-time attack
+struct OracleLayout {
+  size_t block_size;
+  size_t prefix_size;
+  size_t secret_size;
+};
+
+// local stand-in oracle: AES-128-ECB(prefix || input || secret) under a fixed random key
+class LocalOracle {
+public:
+  LocalOracle(const secure_string& secret, bool random_prefix);
+  ~LocalOracle();
+  void operator()(const secure_string& input, secure_string& ctext);
+  size_t num_calls() const { return calls; }
+
+private:
+  byte key[KEY_SIZE];
+  secure_string prefix;
+  secure_string secret;
+  secure_string ptext;
+  size_t calls;
+};
+
+// find the block size, prefix size and secret size of an ECB oracle
+OracleLayout analyze_oracle(const ORACLE& oracle);
+
+// recover the secret appended by the oracle one byte at a time
+secure_string recover_secret(const ORACLE& oracle, const OracleLayout& layout);
+
+// return the index of the first pair of identical adjacent blocks in both ciphertexts whose
+// blocks differ between the two, or -1 if there is none; a duplicate the secret contains is
+// the same in both, so only input that differs between them can produce one
+long find_fill_duplicate(const secure_string& ctext1, const secure_string& ctext2, size_t block_size);
+
+
+int main(int argc, char* argv[])
+{
+  bool random_prefix = false;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "p")) != -1) {
+    switch (opt) {
+    case 'p': random_prefix = true; break;
+    default:
+      std::cerr << "usage: " << argv[0] << " [-p] < secret.b64" << std::endl;
+      return 1;
+    }
+  }
+
+  // base64 encoded secret the oracle appends to every input
+  secure_string esecret(std::istreambuf_iterator<char>(std::cin), {});
+  secure_string secret;
+  b64_decode(esecret, secret);
+
+  LocalOracle local_oracle(secret, random_prefix);
+  ORACLE oracle = std::ref(local_oracle);
+
+  auto start = std::chrono::steady_clock::now();
+  OracleLayout layout = analyze_oracle(oracle);
+  secure_string recovered = recover_secret(oracle, layout);
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  std::cout << "Recovered message:\n" << recovered << std::endl;
+
+  std::cerr << "block size " << layout.block_size << ", prefix " << layout.prefix_size
+	    << " bytes, secret " << layout.secret_size << " bytes; "
+	    << local_oracle.num_calls() << " oracle calls in " << elapsed.count() << " s ("
+	    << layout.secret_size / elapsed.count() << " bytes/s)" << std::endl;
+
+  return 0;
+}
+
+LocalOracle::LocalOracle(const secure_string& secret, bool random_prefix)
+  : secret(secret), calls(0)
+{
+  RandomPool& random = RandomPool::local();
+  random.bytes(key, KEY_SIZE);
+
+  if (random_prefix) {
+    prefix.resize(random.uniform(0, MAX_PREFIX_SIZE - 1));
+    random.bytes((byte*)&prefix[0], prefix.size());
+  }
+}
+
+LocalOracle::~LocalOracle()
+{
+  OPENSSL_cleanse(key, KEY_SIZE);
+}
+
+void LocalOracle::operator()(const secure_string& input, secure_string& ctext)
+{
+  calls++;
+  ptext.clear();
+  ptext.reserve(prefix.size() + input.size() + secret.size());
+  ptext.append(prefix).append(input).append(secret);
+  aes_encrypt(key, ptext, ctext);
+}
+
+OracleLayout analyze_oracle(const ORACLE& oracle)
+{
+  OracleLayout layout;
+  secure_string input, ctext;
+
+  // the ciphertext grows by one block once the input pushes the padding over a boundary
+  oracle(input, ctext);
+  size_t base_size = ctext.size();
+  size_t fill_to_boundary = 0;
+  for (;;) {
+    input.push_back('A');
+    oracle(input, ctext);
+    if (ctext.size() != base_size) {
+      layout.block_size = ctext.size() - base_size;
+      fill_to_boundary = input.size();
+      break;
+    }
+    if (input.size() > MAX_BLOCK_SIZE)
+      throw std::runtime_error("unable to determine block size");
+  }
+
+  // two identical blocks of input must encrypt to identical blocks under ECB; pad in
+  // front of them until they line up and use two fill values so prefix bytes that
+  // happen to match the fill cannot fake the alignment, and repeated blocks in the
+  // secret, which encrypt the same under both fills, are not taken for the input's
+  size_t bs = layout.block_size;
+  bool found = false;
+  secure_string ctexts[2];
+  for (size_t pad = 0; pad < bs && !found; pad++) {
+    for (int i = 0; i < 2; i++) {
+      input.assign(pad, 'A' + i);
+      input.append(2 * bs, 'X' + i);
+      oracle(input, ctexts[i]);
+    }
+    long index = find_fill_duplicate(ctexts[0], ctexts[1], bs);
+    if (index >= 0) {
+      layout.prefix_size = index * bs - pad;
+      found = true;
+    }
+  }
+  if (!found)
+    throw std::runtime_error("oracle does not look like ECB");
+
+  // base_size = prefix + secret + padding, and padding filled up after fill_to_boundary bytes
+  layout.secret_size = base_size - fill_to_boundary - layout.prefix_size;
+
+  return layout;
+}
+
+secure_string recover_secret(const ORACLE& oracle, const OracleLayout& layout)
+{
+  if (layout.block_size != BLOCK_SIZE)
+    throw std::invalid_argument("unsupported block size");
+
+  size_t bs = layout.block_size;
+  size_t align = (bs - layout.prefix_size % bs) % bs;
+  size_t first_block = (layout.prefix_size + align) / bs;
+
+  // recovered bytes preceded by a block of known filler, so every byte has a full context
+  secure_string known(bs - 1, 'A');
+  known.reserve(known.size() + layout.secret_size);
+
+  secure_string input, ctext;
+  std::unordered_map<BLOCK, byte, BlockHash> dictionary;
+  dictionary.reserve(NUM_GUESSES);
+
+  for (size_t n = 0; n < layout.secret_size; n++) {
+    size_t shift = bs - 1 - (n % bs);
+
+    // align || 256 candidate blocks (context || guess) || shift filler
+    // the filler places secret byte n at the end of a block right after the candidates
+    input.assign(align, 'A');
+    const char* context = &known[known.size() - (bs - 1)];
+    for (unsigned guess = 0; guess < NUM_GUESSES; guess++) {
+      input.append(context, bs - 1);
+      input.push_back((char) guess);
+    }
+    input.append(shift, 'A');
+
+    oracle(input, ctext);
+
+    dictionary.clear();
+    BLOCK block;
+    for (unsigned guess = 0; guess < NUM_GUESSES; guess++) {
+      memcpy(block.data(), &ctext[(first_block + guess) * bs], bs);
+      dictionary.emplace(block, (byte) guess);
+    }
+
+    size_t target = first_block + NUM_GUESSES + n / bs;
+    memcpy(block.data(), &ctext[target * bs], bs);
+    auto match = dictionary.find(block);
+    if (match == dictionary.end())
+      throw std::runtime_error("no candidate block matched");
+
+    known.push_back((char) match->second);
+  }
+
+  return known.substr(bs - 1);
+}
+
+long find_fill_duplicate(const secure_string& ctext1, const secure_string& ctext2, size_t block_size)
+{
+  size_t size = std::min(ctext1.size(), ctext2.size());
+  for (size_t i = 0; i + 2 * block_size <= size; i += block_size) {
+    if (memcmp(&ctext1[i], &ctext1[i + block_size], block_size) == 0
+	&& memcmp(&ctext2[i], &ctext2[i + block_size], block_size) == 0
+	&& memcmp(&ctext1[i], &ctext2[i], block_size) != 0)
+      return i / block_size;
+  }
+  return -1;
+}
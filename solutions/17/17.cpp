@@ -0,0 +1,443 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <openssl/evp.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "../common/aes.h"
+#include "../common/blocks.h"
+#include "../common/random_pool.h"
+
+static const unsigned int KEY_SIZE = 16;
+static const unsigned int BLOCK_SIZE = 16;
+static const unsigned int NUM_GUESSES = 256;
+static const unsigned int MAX_BATCH = 4096;
+
+// a padding oracle answers batches of queries; each query is a 2 block CBC
+// ciphertext (iv || block) and the answer is whether it decrypts with valid padding
+class PaddingOracle {
+public:
+  virtual ~PaddingOracle() {}
+  virtual void query(const byte* queries, size_t num_queries, bool* valid) = 0;
+};
+
+// oracles are not shared between threads, so each worker asks the factory for its own
+typedef std::function<std::unique_ptr<PaddingOracle>()> ORACLE_FACTORY;
+
+// in-process oracle holding the key
+class LocalOracle : public PaddingOracle {
+public:
+  LocalOracle(const byte key[KEY_SIZE]);
+  void query(const byte* queries, size_t num_queries, bool* valid);
+
+private:
+  EVP_CIPHER_CTX_free_ptr ctx;
+  std::vector<byte> blocks;
+};
+
+// oracle on the other end of a unix socket
+class SocketOracle : public PaddingOracle {
+public:
+  SocketOracle(const std::string& path);
+  ~SocketOracle();
+  void query(const byte* queries, size_t num_queries, bool* valid);
+
+private:
+  int fd;
+  std::vector<byte> answers;
+};
+
+// encrypt plaintext with AES-128-CBC and PKCS#7 padding, returning iv || ciphertext
+secure_string cbc_encrypt(const byte key[KEY_SIZE], const secure_string& ptext);
+
+// recover the plaintext of iv || ciphertext using the padding oracle
+secure_string padding_oracle_attack(const ORACLE_FACTORY& factory, const secure_string& ctext,
+				    unsigned num_threads, size_t& num_queries);
+
+// recover the plaintext of one block given the block before it
+void attack_block(PaddingOracle& oracle, const byte* prev, const byte* block, byte* ptext,
+		  size_t& num_queries);
+
+// answer padding oracle queries on a unix socket until killed
+void serve(const std::string& path, const byte key[KEY_SIZE]);
+
+// handle the queries from one connection
+void serve_connection(int fd, const byte key[KEY_SIZE]);
+
+void read_full(int fd, void* buf, size_t size);
+void write_full(int fd, const void* buf, size_t size);
+std::string bytes_to_hex(const secure_string& bytes);
+secure_string hex_to_bytes(const std::string& hex);
+
+
+int main(int argc, char* argv[])
+{
+  std::string server_path, client_path;
+  unsigned num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+  int opt;
+  while ((opt = getopt(argc, argv, "s:c:t:")) != -1) {
+    switch (opt) {
+    case 's': server_path = optarg; break;
+    case 'c': client_path = optarg; break;
+    case 't': num_threads = std::max(1ul, std::stoul(optarg)); break;
+    default:
+      std::cerr << "usage: " << argv[0] << " [-s socket | -c socket] [-t threads]" << std::endl;
+      return 1;
+    }
+  }
+
+  secure_string input(std::istreambuf_iterator<char>(std::cin), {});
+  while (!input.empty() && input.back() == '\n') {
+    input.pop_back();
+  }
+
+  secure_string ctext;
+  ORACLE_FACTORY factory;
+  byte key[KEY_SIZE];
+  RandomPool::local().bytes(key, KEY_SIZE);
+
+  if (!server_path.empty()) {
+    // print the challenge ciphertext and answer queries about it
+    std::cout << bytes_to_hex(cbc_encrypt(key, input)) << std::endl;
+    serve(server_path, key);
+    return 0;
+  } else if (!client_path.empty()) {
+    // input is the hex ciphertext printed by the server
+    ctext = hex_to_bytes(std::string(input.begin(), input.end()));
+    factory = [client_path] { return std::unique_ptr<PaddingOracle>(new SocketOracle(client_path)); };
+  } else {
+    ctext = cbc_encrypt(key, input);
+    factory = [&key] { return std::unique_ptr<PaddingOracle>(new LocalOracle(key)); };
+  }
+
+  size_t num_queries = 0;
+  auto start = std::chrono::steady_clock::now();
+  secure_string recovered = padding_oracle_attack(factory, ctext, num_threads, num_queries);
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  OPENSSL_cleanse(key, KEY_SIZE);
+
+  std::cout << "Recovered message:\n" << recovered << std::endl;
+
+  std::cerr << ctext.size() / BLOCK_SIZE - 1 << " blocks, " << num_queries << " queries in "
+	    << elapsed.count() << " s (" << num_queries / elapsed.count() << " queries/s, "
+	    << num_threads << " threads)" << std::endl;
+
+  return 0;
+}
+
+secure_string padding_oracle_attack(const ORACLE_FACTORY& factory, const secure_string& ctext,
+				    unsigned num_threads, size_t& num_queries)
+{
+  if (ctext.size() < 2 * BLOCK_SIZE || ctext.size() % BLOCK_SIZE != 0)
+    throw std::invalid_argument("ciphertext must be an iv followed by whole blocks");
+
+  size_t num_blocks = ctext.size() / BLOCK_SIZE - 1;
+  secure_string ptext(num_blocks * BLOCK_SIZE, '\0');
+  const byte* cbytes = (const byte*) ctext.data();
+  byte* pbytes = (byte*) &ptext[0];
+
+  // every block only depends on its predecessor, so blocks are attacked independently
+  std::atomic<size_t> next_block(0);
+  std::atomic<size_t> total_queries(0);
+  std::vector<std::thread> workers;
+  for (unsigned i = 0; i < std::min<size_t>(num_threads, num_blocks); i++) {
+    workers.emplace_back([&] {
+      std::unique_ptr<PaddingOracle> oracle = factory();
+      size_t queries = 0;
+      size_t b;
+      while ((b = next_block++) < num_blocks) {
+	attack_block(*oracle, cbytes + b * BLOCK_SIZE, cbytes + (b + 1) * BLOCK_SIZE,
+		     pbytes + b * BLOCK_SIZE, queries);
+      }
+      total_queries += queries;
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  num_queries = total_queries;
+
+  if (!valid_pkcs7(pbytes + ptext.size() - BLOCK_SIZE, BLOCK_SIZE))
+    throw std::runtime_error("recovered plaintext has invalid padding");
+  ptext.resize(ptext.size() - pbytes[ptext.size() - 1]);
+
+  return ptext;
+}
+
+void attack_block(PaddingOracle& oracle, const byte* prev, const byte* block, byte* ptext,
+		  size_t& num_queries)
+{
+  // intermediate is the raw block decryption, before xor with prev
+  byte intermediate[BLOCK_SIZE];
+  std::vector<byte> queries(NUM_GUESSES * 2 * BLOCK_SIZE);
+  bool valid[NUM_GUESSES];
+
+  for (int pos = BLOCK_SIZE - 1; pos >= 0; pos--) {
+    byte pad = BLOCK_SIZE - pos;
+
+    // one round trip with all 256 guesses for this byte
+    for (unsigned guess = 0; guess < NUM_GUESSES; guess++) {
+      byte* q = &queries[guess * 2 * BLOCK_SIZE];
+      memset(q, 0, pos);
+      q[pos] = guess;
+      for (unsigned j = pos + 1; j < BLOCK_SIZE; j++) {
+	q[j] = intermediate[j] ^ pad;
+      }
+      memcpy(q + BLOCK_SIZE, block, BLOCK_SIZE);
+    }
+    oracle.query(queries.data(), NUM_GUESSES, valid);
+    num_queries += NUM_GUESSES;
+
+    std::vector<unsigned> hits;
+    for (unsigned guess = 0; guess < NUM_GUESSES; guess++) {
+      if (valid[guess])
+	hits.push_back(guess);
+    }
+
+    // on the last byte a hit can also come from the plaintext ending in 02 02 etc.;
+    // changing the byte before it only keeps the genuine 01 padding valid. Earlier bytes
+    // have the bytes after them pinned to the padding, so only one guess can hit there
+    if (hits.size() > 1 && pos == BLOCK_SIZE - 1) {
+      for (size_t h = 0; h < hits.size(); h++) {
+	byte* q = &queries[h * 2 * BLOCK_SIZE];
+	memset(q, 0, pos);
+	q[pos - 1] = 0xff;
+	q[pos] = hits[h];
+	for (unsigned j = pos + 1; j < BLOCK_SIZE; j++) {
+	  q[j] = intermediate[j] ^ pad;
+	}
+	memcpy(q + BLOCK_SIZE, block, BLOCK_SIZE);
+      }
+      oracle.query(queries.data(), hits.size(), valid);
+      num_queries += hits.size();
+
+      std::vector<unsigned> confirmed;
+      for (size_t h = 0; h < hits.size(); h++) {
+	if (valid[h])
+	  confirmed.push_back(hits[h]);
+      }
+      hits = confirmed;
+    }
+
+    if (hits.size() != 1)
+      throw std::runtime_error("padding oracle gave an inconsistent answer");
+
+    intermediate[pos] = hits[0] ^ pad;
+  }
+
+  for (unsigned j = 0; j < BLOCK_SIZE; j++) {
+    ptext[j] = intermediate[j] ^ prev[j];
+  }
+  OPENSSL_cleanse(intermediate, BLOCK_SIZE);
+}
+
+LocalOracle::LocalOracle(const byte key[KEY_SIZE])
+  : ctx(EVP_CIPHER_CTX_new(), ::EVP_CIPHER_CTX_free)
+{
+  int rc = EVP_DecryptInit_ex(ctx.get(), EVP_aes_128_ecb(), NULL, key, NULL);
+  if (rc != 1)
+    throw std::runtime_error("EVP_DecryptInit_ex failed");
+  EVP_CIPHER_CTX_set_padding(ctx.get(), 0);
+}
+
+void LocalOracle::query(const byte* queries, size_t num_queries, bool* valid)
+{
+  // gather the second block of every query and decrypt them all in one call
+  blocks.resize(num_queries * BLOCK_SIZE);
+  for (size_t i = 0; i < num_queries; i++) {
+    memcpy(&blocks[i * BLOCK_SIZE], queries + (2 * i + 1) * BLOCK_SIZE, BLOCK_SIZE);
+  }
+
+  int out_len = (int) blocks.size();
+  int rc = EVP_DecryptUpdate(ctx.get(), blocks.data(), &out_len, blocks.data(), (int) blocks.size());
+  if (rc != 1 || out_len != (int) blocks.size())
+    throw std::runtime_error("EVP_DecryptUpdate failed");
+
+  for (size_t i = 0; i < num_queries; i++) {
+    byte* block = &blocks[i * BLOCK_SIZE];
+    const byte* iv = queries + 2 * i * BLOCK_SIZE;
+    for (unsigned j = 0; j < BLOCK_SIZE; j++) {
+      block[j] ^= iv[j];
+    }
+    valid[i] = valid_pkcs7(block, BLOCK_SIZE);
+  }
+}
+
+SocketOracle::SocketOracle(const std::string& path)
+{
+  fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd == -1)
+    throw std::runtime_error("unable to create socket");
+
+  struct sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+  if (connect(fd, (struct sockaddr*) &addr, sizeof(addr)) == -1) {
+    close(fd);
+    throw std::runtime_error("unable to connect to oracle socket");
+  }
+}
+
+SocketOracle::~SocketOracle()
+{
+  close(fd);
+}
+
+void SocketOracle::query(const byte* queries, size_t num_queries, bool* valid)
+{
+  // request: query count, then the queries; response: one byte per query
+  uint32_t count = num_queries;
+  write_full(fd, &count, sizeof(count));
+  write_full(fd, queries, num_queries * 2 * BLOCK_SIZE);
+
+  answers.resize(num_queries);
+  read_full(fd, answers.data(), answers.size());
+  for (size_t i = 0; i < num_queries; i++) {
+    valid[i] = answers[i] != 0;
+  }
+}
+
+void serve(const std::string& path, const byte key[KEY_SIZE])
+{
+  // a client that hangs up mid-answer must not take the server down with it
+  signal(SIGPIPE, SIG_IGN);
+
+  int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listen_fd == -1)
+    throw std::runtime_error("unable to create socket");
+
+  struct sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+  unlink(path.c_str());
+  if (bind(listen_fd, (struct sockaddr*) &addr, sizeof(addr)) == -1 || listen(listen_fd, 64) == -1)
+    throw std::runtime_error("unable to listen on oracle socket");
+
+  std::vector<byte> server_key(key, key + KEY_SIZE);
+  int fd;
+  while ((fd = accept(listen_fd, NULL, NULL)) != -1) {
+    std::thread([fd, server_key] { serve_connection(fd, server_key.data()); }).detach();
+  }
+}
+
+void serve_connection(int fd, const byte key[KEY_SIZE])
+{
+  LocalOracle oracle(key);
+  std::vector<byte> queries;
+  std::vector<byte> answers;
+  bool valid[MAX_BATCH];
+
+  try {
+    for (;;) {
+      uint32_t count;
+      read_full(fd, &count, sizeof(count));
+      if (count > MAX_BATCH)
+	break;
+
+      queries.resize(count * 2 * BLOCK_SIZE);
+      read_full(fd, queries.data(), queries.size());
+      oracle.query(queries.data(), count, valid);
+
+      answers.assign(valid, valid + count);
+      write_full(fd, answers.data(), answers.size());
+    }
+  } catch (const std::exception&) {
+    // client went away
+  }
+
+  close(fd);
+}
+
+secure_string cbc_encrypt(const byte key[KEY_SIZE], const secure_string& ptext)
+{
+  byte iv[BLOCK_SIZE];
+  RandomPool::local().bytes(iv, BLOCK_SIZE);
+
+  EVP_CIPHER_CTX_free_ptr ctx(EVP_CIPHER_CTX_new(), ::EVP_CIPHER_CTX_free);
+  int rc = EVP_EncryptInit_ex(ctx.get(), EVP_aes_128_cbc(), NULL, key, iv);
+  if (rc != 1)
+    throw std::runtime_error("EVP_EncryptInit_ex failed");
+
+  secure_string ctext((const char*) iv, BLOCK_SIZE);
+  ctext.resize(BLOCK_SIZE + ptext.size() + BLOCK_SIZE);
+  int out_len1 = (int) ctext.size() - BLOCK_SIZE;
+
+  rc = EVP_EncryptUpdate(ctx.get(), (byte*) &ctext[BLOCK_SIZE], &out_len1,
+			 (const byte*) ptext.data(), (int) ptext.size());
+  if (rc != 1)
+    throw std::runtime_error("EVP_EncryptUpdate failed");
+
+  int out_len2 = (int) ctext.size() - BLOCK_SIZE - out_len1;
+  rc = EVP_EncryptFinal_ex(ctx.get(), (byte*) &ctext[BLOCK_SIZE] + out_len1, &out_len2);
+  if (rc != 1)
+    throw std::runtime_error("EVP_EncryptFinal_ex failed");
+
+  ctext.resize(BLOCK_SIZE + out_len1 + out_len2);
+  return ctext;
+}
+
+void read_full(int fd, void* buf, size_t size)
+{
+  byte* p = (byte*) buf;
+  while (size > 0) {
+    ssize_t n = read(fd, p, size);
+    if (n <= 0)
+      throw std::runtime_error("oracle socket closed");
+    p += n;
+    size -= n;
+  }
+}
+
+void write_full(int fd, const void* buf, size_t size)
+{
+  const byte* p = (const byte*) buf;
+  while (size > 0) {
+    ssize_t n = write(fd, p, size);
+    if (n <= 0)
+      throw std::runtime_error("oracle socket closed");
+    p += n;
+    size -= n;
+  }
+}
+
+std::string bytes_to_hex(const secure_string& bytes)
+{
+  static const char digits[] = "0123456789abcdef";
+  std::string hex;
+  hex.reserve(bytes.size() * 2);
+  for (auto ch : bytes) {
+    hex.push_back(digits[(byte) ch >> 4]);
+    hex.push_back(digits[(byte) ch & 0xf]);
+  }
+  return hex;
+}
+
+secure_string hex_to_bytes(const std::string& hex)
+{
+  if (hex.size() % 2 != 0)
+    throw std::invalid_argument("bad hex string input");
+
+  secure_string bytes;
+  bytes.reserve(hex.size() / 2);
+  for (size_t i = 0; i < hex.size(); i += 2) {
+    bytes.push_back((char) std::stoi(hex.substr(i, 2), NULL, 16));
+  }
+  return bytes;
+}
@@ -1,219 +1,266 @@
-#include <algorithm>
-#include <bitset>
-#include <cctype>
-#include <climits>
 #include <cmath>
-#include <fstream>
 #include <iostream>
-#include <set>
-#include <sstream>
-#include <stdexcept>
+#include <memory>
+#include <string>
+#include <string_view>
 #include <vector>
 
-#define NUM_HEX_BITS 4
-#define NUM_CHAR_BITS 8
-
-typedef std::bitset<NUM_HEX_BITS> HEX_BITS;
-typedef std::bitset<NUM_CHAR_BITS> CHAR_BITS;
-typedef std::vector<CHAR_BITS> STR_BITS;
-
-struct Plaintext {
-  double score;
-  char decryption_key;
-  STR_BITS text_bin;
-  std::string text;
+#include <unistd.h>
+
+#include "../common/batch.h"
+#include "../common/bytes.h"
+#include "../common/cache.h"
+#include "../common/checkpoint.h"
+#include "../common/corpus.h"
+#include "../common/encoding.h"
+#include "../common/input.h"
+#include "../common/instrument.h"
+#include "../common/output.h"
+#include "../common/plaintext.h"
+
+// names the analysis in cache keys
+#define CACHE_MODE "4 sbx batch"
+// ciphertexts, cache hits included, waiting to be printed before a partial batch is cracked
+#define MAX_WAITING (BATCH_LANES * 8)
+
+// cracks ciphertexts a batch at a time and prints the ones that decrypt to english, in input
+// order. With a cache, ciphertexts it has results for skip the batch but wait their turn to
+// be printed, and so do ciphertexts too long for a lane, which are cracked one at a time.
+// With a checkpoint, every result printed is also added to it.
+class Cracker {
+public:
+  Cracker(Output& output, CrackCache* cache, Checkpoint* checkpoint)
+    : output(output), cache(cache), checkpoint(checkpoint) {}
+  void add(ByteSpan encrypted);
+  // crack and print everything waiting
+  void finish();
+  // finish, then save the checkpoint as done up to position
+  void save(uint64_t position);
+
+private:
+  struct Waiting {
+    // lane in the batch, or -1 for a cache hit or a line too long for a lane
+    int lane;
+    CacheKey key;
+    BatchResult result;
+    Bytes decrypted;
+  };
+
+  Output& output;
+  CrackCache* cache;
+  Checkpoint* checkpoint;
+  SingleByteXorBatch batch;
+  std::vector<Waiting> waiting;
 };
 
-// read a wordlist file into a set of strings
-std::set<std::string> read_wordlist(const std::string filename);
-
-// convert a hexadecimal string to a bit representation
-STR_BITS hex_str_to_bits(const std::string hex_str);
-
-// attempt to decrypt an encrypted string
-void attempt_decrypt(const std::set<std::string> wordlist, const STR_BITS encrypted);
-
-// convert a hex character to a bit representation
-HEX_BITS hex_to_bin(const char ch);
-
-// return true if text is > 70% alpha characters
-bool is_reasonable_plaintext(const std::string text);
+// crack the records of a binary corpus, which need no reading or decoding; checkpoint
+// positions count records
+void crack_corpus(const std::string& filename, Cracker& cracker, Checkpoint* checkpoint);
 
-// return a value 0 <= score <= 1 that based on the percentage of real words in text
-double score_plaintext(const std::set<std::string> wordlist, const std::string text);
+// print the results a checkpoint saved, so a resumed run prints everything a run without
+// interruption would
+void print_saved_results(const Checkpoint& checkpoint, Output& output);
 
-// compare the scores of two plaintexts
-bool compare_plaintexts(const Plaintext &p1, const Plaintext &p2);
 
-// print a plaintext and its key
-void print_plaintext(const Plaintext& p);
-
-
-int main(void)
+int main(int argc, char* argv[])
 {
-  std::set<std::string> wordlist = read_wordlist("wordlist.txt");
-
-  std::vector<STR_BITS> encrypted_list;
-  std::string encrypted_str;
-  STR_BITS encrypted_bits;
-
-  while (std::cin >> encrypted_str) {
-    encrypted_bits = hex_str_to_bits(encrypted_str);
-    encrypted_list.push_back(encrypted_bits);
+  std::string corpus_file;
+  std::string cache_file;
+  std::string state_file;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "C:f:s:")) != -1) {
+    switch (opt) {
+    case 'C': cache_file = optarg; break;
+    case 'f': corpus_file = optarg; break;
+    case 's': state_file = optarg; break;
+    default:
+      std::cerr << "usage: " << argv[0] << " [-C cache] [-f corpus.bin] [-s state]" << std::endl;
+      return 1;
+    }
   }
 
-  for (auto &encrypted : encrypted_list) {
-    attempt_decrypt(wordlist, encrypted);
+  std::unique_ptr<CrackCache> cache;
+  if (!cache_file.empty()) {
+    cache.reset(new CrackCache(cache_file));
+  }
+  std::unique_ptr<Checkpoint> checkpoint;
+  if (!state_file.empty()) {
+    checkpoint.reset(new Checkpoint(state_file));
+  }
+  Output output;
+  if (checkpoint) {
+    print_saved_results(*checkpoint, output);
+  }
+  Cracker cracker(output, cache.get(), checkpoint.get());
+  if (!corpus_file.empty()) {
+    crack_corpus(corpus_file, cracker, checkpoint.get());
+    return 0;
   }
 
-  return 0;
-}
-
-void attempt_decrypt(const std::set<std::string> wordlist, const STR_BITS encrypted)
-{
-  std::vector<Plaintext> plaintexts;
-
-  // try every possible key and attempt to decrypt
-  for (int key = CHAR_MIN; key <= CHAR_MAX; key++) {
-    Plaintext plaintext;
-    plaintext.decryption_key = key;
-
-    CHAR_BITS key_bits(key);
-    std::ostringstream text_os;
-    for (auto& encrypted_ch_bin : encrypted) {
-      CHAR_BITS decrypted_ch_bin = key_bits ^ encrypted_ch_bin;
-      plaintext.text_bin.push_back(decrypted_ch_bin);
-      text_os << (char) decrypted_ch_bin.to_ulong();
+  Input input;
+  if (checkpoint && checkpoint->position() > 0) {
+    std::cerr << "resuming at byte " << checkpoint->position() << std::endl;
+    if (input.skip(checkpoint->position()) != checkpoint->position()) {
+      throw std::invalid_argument("input is shorter than the checkpoint position");
+    }
+  }
+  std::string scratch;
+  std::string_view encrypted_str;
+  Bytes encrypted;
+
+  for (;;) {
+    {
+      INSTRUMENT_STAGE("read");
+      std::string_view line;
+      if (!input.next_line(line)) {
+	break;
+      }
+      INSTRUMENT_COUNT("bytes_read", line.size() + 1);
+      encrypted_str = strip_whitespace(line, scratch);
+    }
+    if (encrypted_str.empty()) {
+      continue;
     }
 
-    plaintext.text = text_os.str();
-
-    // only consider reasonable plaintexts
-    if (is_reasonable_plaintext(plaintext.text)) {
-      plaintext.score = score_plaintext(wordlist, plaintext.text);
-      plaintexts.push_back(plaintext);
+    {
+      INSTRUMENT_STAGE("decode");
+      if (!hex_decode(encrypted_str, encrypted)) {
+	throw std::invalid_argument("bad hex string input");
+      }
+      INSTRUMENT_COUNT("bytes_decoded", encrypted.size());
     }
-  }
 
-  if (plaintexts.size() > 0) {
-    std::sort(plaintexts.begin(), plaintexts.end(), compare_plaintexts);
-    // output only if plaintext has a good score
-    if (plaintexts[0].score > 0.5) {
-      print_plaintext(plaintexts[0]);
+    cracker.add(encrypted);
+    if (checkpoint && checkpoint->due()) {
+      cracker.save(input.position());
     }
   }
+  cracker.finish();
+  if (checkpoint) {
+    cracker.save(input.position());
+  }
+
+  return 0;
 }
 
-STR_BITS hex_str_to_bits(const std::string hex_str)
+void Cracker::add(ByteSpan encrypted)
 {
-  STR_BITS bitstring;
-  CHAR_BITS ch_bin;
-  HEX_BITS upper_bits;
-  HEX_BITS lower_bits;
-  bool save_upper_bits = true;
-  char hex_ch;
-
-  // read hex string character by character
-  std::istringstream iss(hex_str);
-  while(iss >> hex_ch) {
-    if (save_upper_bits) {
-      upper_bits = hex_to_bin(hex_ch);
-      save_upper_bits = false;
-    } else {
-      lower_bits = hex_to_bin(hex_ch);
-      save_upper_bits = true;
-      // combine upper and lower bits and save into input vector
-      ch_bin = (upper_bits.to_ulong() << NUM_HEX_BITS) | lower_bits.to_ulong();
-      bitstring.push_back(ch_bin);
-      ch_bin.reset();
+  Waiting entry;
+  entry.lane = -1;
+  std::vector<CachedKey> keys;
+  if (cache) {
+    entry.key = make_cache_key(encrypted, CACHE_MODE);
+  }
+  if (cache && cache->find(entry.key, keys) && keys.size() == 1 && keys[0].key.size() == 1) {
+    entry.result = {keys[0].key[0], keys[0].score};
+  } else if (encrypted.size() > BATCH_MAX_LENGTH) {
+    // too long for a batch lane, so cracked on its own
+    std::vector<KeyScore> ranked = rank_single_byte_keys(encrypted);
+    entry.result = ranked.empty() ? BatchResult{0, -INFINITY} : BatchResult{ranked[0].key, ranked[0].score};
+    if (cache) {
+      std::vector<CachedKey> cached(1);
+      cached[0] = {Bytes(ByteSpan(&entry.result.key, 1)), entry.result.score};
+      cache->insert(entry.key, cached);
+    }
+  } else {
+    entry.lane = batch.size();
+    batch.add(encrypted);
+    waiting.push_back(std::move(entry));
+    if (batch.full()) {
+      finish();
     }
+    return;
   }
 
-  if (!save_upper_bits) {
-    throw std::invalid_argument("bad hex string input");
+  // a known result skips the batch but waits its turn to be printed
+  if (entry.result.score >= NGRAM_ENGLISH_THRESHOLD) {
+    entry.decrypted.resize(encrypted.size());
+    single_byte_xor(encrypted, entry.result.key, entry.decrypted);
+  }
+  waiting.push_back(std::move(entry));
+  if (waiting.size() >= MAX_WAITING) {
+    finish();
   }
-
-  return bitstring;
 }
 
-std::set<std::string> read_wordlist(std::string filename)
+void Cracker::finish()
 {
-  std::ifstream word_file(filename);
-
-  if (!word_file.is_open()) {
-    throw std::invalid_argument("unable to open wordlist file");
+  std::vector<BatchResult> results;
+  if (batch.size() > 0) {
+    results = batch.crack();
   }
 
-  std::string word;
-  std::set<std::string> wordlist;
-  while (getline(word_file, word)) {
-    wordlist.insert(word);
-  }
-  word_file.close();
+  INSTRUMENT_STAGE("output");
+  for (auto& entry : waiting) {
+    if (entry.lane >= 0) {
+      entry.result = results[entry.lane];
+      if (cache) {
+	std::vector<CachedKey> keys(1);
+	keys[0] = {Bytes(ByteSpan(&entry.result.key, 1)), entry.result.score};
+	cache->insert(entry.key, keys);
+      }
+    }
 
-  return wordlist;
+    // output only if plaintext scores as english
+    if (entry.result.score >= NGRAM_ENGLISH_THRESHOLD) {
+      if (entry.lane >= 0) {
+	batch.decrypt(entry.lane, entry.result.key, entry.decrypted);
+      }
+      print_plaintext(output, entry.result.key, entry.decrypted);
+      if (checkpoint) {
+	checkpoint->add_result(bytes_to_hex(ByteSpan(&entry.result.key, 1)) + " " + bytes_to_hex(entry.decrypted));
+      }
+    }
+  }
+  waiting.clear();
+  batch.clear();
 }
 
-HEX_BITS hex_to_bin(const char ch)
+void Cracker::save(uint64_t position)
 {
-  switch(ch) {
-  case '0': return 0;
-  case '1': return 1;
-  case '2': return 2;
-  case '3': return 3;
-  case '4': return 4;
-  case '5': return 5;
-  case '6': return 6;
-  case '7': return 7;
-  case '8': return 8;
-  case '9': return 9;
-  case 'a': case 'A': return 10;
-  case 'b': case 'B': return 11;
-  case 'c': case 'C': return 12;
-  case 'd': case 'D': return 13;
-  case 'e': case 'E': return 14;
-  case 'f': case 'F': return 15;
-  default: throw std::invalid_argument("character is not a hex value");
-  }
+  finish();
+  // results reach the output at least as soon as the checkpoint
+  output.flush();
+  checkpoint->save(position);
 }
 
-bool is_reasonable_plaintext(const std::string text)
+void crack_corpus(const std::string& filename, Cracker& cracker, Checkpoint* checkpoint)
 {
-  int num_letters = 0;
-  for (auto ch : text) {
-    ch = tolower(ch);
-    if (ch >= 'a' && ch <= 'z') {
-      num_letters++;
+  CorpusReader corpus(filename);
+  size_t start = 0;
+  if (checkpoint && checkpoint->position() > 0) {
+    start = checkpoint->position();
+    std::cerr << "resuming at record " << start << std::endl;
+    if (start > corpus.size()) {
+      throw std::invalid_argument("corpus is shorter than the checkpoint position");
     }
   }
 
-  float percent_letters = (float) num_letters / text.length();
-  return (percent_letters >= 0.7);
-}
-
-double score_plaintext(const std::set<std::string> wordlist, const std::string text)
-{
-  int num_words = 0;
-  int num_real_words = 0;
-  std::istringstream iss(text);
-  std::string word;
-
-  while (iss >> word) {
-    std::transform(word.begin(), word.end(), word.begin(), ::tolower);
-    if (wordlist.find(word) != wordlist.end()) {
-      num_real_words++;
+  for (size_t i = start; i < corpus.size(); i++) {
+    ByteSpan encrypted = corpus.record(i);
+    INSTRUMENT_COUNT("bytes_decoded", encrypted.size());
+    cracker.add(encrypted);
+    if (checkpoint && checkpoint->due()) {
+      cracker.save(i + 1);
     }
-    num_words++;
   }
-  return (double) num_real_words / num_words;
-}
-
-bool compare_plaintexts(const Plaintext &p1, const Plaintext &p2)
-{
-  return p1.score > p2.score;
+  cracker.finish();
+  if (checkpoint) {
+    cracker.save(corpus.size());
+  }
 }
 
-void print_plaintext(const Plaintext& p)
+void print_saved_results(const Checkpoint& checkpoint, Output& output)
 {
-  std::cout << p.decryption_key << ": " << p.text << std::endl;
+  // each result is the key and the plaintext, in hex
+  for (auto& result : checkpoint.results()) {
+    size_t space = result.find(' ');
+    Bytes key, plaintext;
+    if (space == std::string::npos || !hex_decode(std::string_view(result).substr(0, space), key)
+	|| key.size() != 1 || !hex_decode(std::string_view(result).substr(space + 1), plaintext)) {
+      throw std::invalid_argument("bad result in checkpoint: " + result);
+    }
+    print_plaintext(output, key[0], plaintext);
+  }
 }
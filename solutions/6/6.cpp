@@ -1,225 +1,183 @@
 #include <algorithm>
-#include <bitset>
 #include <climits>
+#include <cmath>
 #include <iostream>
-#include <sstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
 #include <utility>
 #include <vector>
 
-#define NUM_BASE64_BITS 6
-#define NUM_CHAR_BITS 8
-
-typedef std::bitset<NUM_CHAR_BITS> CHAR_BITS;
-typedef std::bitset<NUM_BASE64_BITS> BASE64_BITS;
-typedef std::bitset<NUM_BASE64_BITS * 4> BASE64_CHUNK_BITS;
-typedef std::vector<CHAR_BITS> STR_BITS;
-
-typedef std::pair<int, double> KEY_EVALUATION;
-
-STR_BITS str_to_bits(const std::string str);
-STR_BITS base64_str_to_bits(const std::string base64_str);
-BASE64_BITS base64_char_to_bits(const char base64_char);
-unsigned hamming_distance(const STR_BITS s1, const STR_BITS s2);
-std::vector<KEY_EVALUATION> evaluate_key_lengths(const STR_BITS encrypted_bits);
-bool compare_key_evaluations(const KEY_EVALUATION &ke1, const KEY_EVALUATION &ke2);
-void attempt_decrypt_with_keylength(const STR_BITS encrypted, const int keylength);
-std::vector<STR_BITS> generate_blocks(const STR_BITS encrypted, const int keylength);
-void attempt_decrypt(const STR_BITS encrypted);
-bool is_reasonable_plaintext(const std::string text);
-void decrypt(const STR_BITS key, const STR_BITS encrypted);
-
-
-int main(void)
+#include <unistd.h>
+
+#include "../common/bytes.h"
+#include "../common/cache.h"
+#include "../common/crib.h"
+#include "../common/encoding.h"
+#include "../common/input.h"
+#include "../common/instrument.h"
+#include "../common/ngram.h"
+#include "../common/output.h"
+#include "../common/xor.h"
+
+#define DECRYPT_BLOCK_SIZE (64ul << 10)
+#define MIN_KEYSIZE 2
+#define MAX_KEYSIZE 40
+// name the analyses in cache keys
+#define CACHE_MODE_COLUMNS "6 rxor columns"
+#define CACHE_MODE_CRIBS "6 rxor cribs"
+
+// the candidate key bytes of each column, most likely first, and the byte model log
+// probability of each column's best one
+std::vector<CachedKey> attempt_decrypt_with_keylength(ByteSpan encrypted, const int keylength);
+CachedKey attempt_decrypt(ByteSpan encrypted);
+void print_candidates(const std::vector<CachedKey>& columns, Output& output);
+bool is_reasonable_plaintext(const std::string& text);
+void decrypt(ByteSpan key, ByteSpan encrypted, Output& output);
+// recover the key from known plaintext fragments and decrypt with it
+void crack_with_cribs(ByteSpan encrypted, const std::vector<Bytes>& cribs, size_t max_keysize,
+		      unsigned num_threads, CrackCache* cache, Output& output);
+
+
+int main(int argc, char* argv[])
 {
-  std::ostringstream oss;
-  char ch;
-  while (std::cin >> std::noskipws >> ch) {
-    if (ch != '\n') {
-      oss << ch;
+  std::vector<Bytes> cribs;
+  std::string cache_file;
+  size_t max_keysize = MAX_KEYSIZE;
+  unsigned num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+  int opt;
+  while ((opt = getopt(argc, argv, "C:c:m:t:")) != -1) {
+    switch (opt) {
+    case 'C': cache_file = optarg; break;
+    case 'c': cribs.push_back(str_to_bytes(optarg)); break;
+    case 'm': max_keysize = std::max<size_t>(MIN_KEYSIZE, std::stoul(optarg)); break;
+    case 't': num_threads = std::max(1ul, std::stoul(optarg)); break;
+    default:
+      std::cerr << "usage: " << argv[0] << " [-C cache] [-c crib]... [-m max_keysize] [-t threads]" << std::endl;
+      return 1;
     }
   }
 
-  STR_BITS encrypted_bits = base64_str_to_bits(oss.str());
-
-  std::vector<KEY_EVALUATION> key_evaluations = evaluate_key_lengths(encrypted_bits);
-
-  std::cout << "Trying keylength " << key_evaluations[0].first << std::endl;
-  attempt_decrypt_with_keylength(encrypted_bits, key_evaluations[0].first);
-
-  /*
-  STR_BITS key = str_to_bits("Terminator X: Bring the noise");
-  decrypt(key, encrypted_bits);
-  */
-
-  return 0;
-}
-
-STR_BITS str_to_bits(const std::string str)
-{
-  STR_BITS bitstring;
-  char ch;
-
-  for (auto &ch : str) {
-    CHAR_BITS ch_bits(ch);
-    bitstring.push_back(ch);
+  Input input;
+  std::string scratch;
+  std::string_view base64;
+  {
+    INSTRUMENT_STAGE("read");
+    base64 = strip_whitespace(input.read_all(), scratch);
+    INSTRUMENT_COUNT("bytes_read", base64.size());
   }
 
-  return bitstring;
-}
-
-STR_BITS base64_str_to_bits(const std::string base64_str)
-{
-  if (base64_str.size() % 4 != 0) {
-    throw std::invalid_argument("base64_str length must be a multiple of 4");
+  Bytes encrypted_bits;
+  {
+    INSTRUMENT_STAGE("decode");
+    encrypted_bits = base64_str_to_bytes(base64);
+    INSTRUMENT_COUNT("bytes_decoded", encrypted_bits.size());
   }
 
-  unsigned long ch_mask = (1 << NUM_CHAR_BITS) - 1;
-  unsigned long ch1_mask = ch_mask << (NUM_CHAR_BITS * 2);
-  unsigned long ch2_mask = ch_mask << NUM_CHAR_BITS;
-  unsigned long ch3_mask = ch_mask;
-
-  STR_BITS bitstring;
-
-  for (int i = 0; i < base64_str.size(); i += 4) {
-    BASE64_BITS b64_ch1_bits = base64_char_to_bits(base64_str[i]);
-    BASE64_BITS b64_ch2_bits = base64_char_to_bits(base64_str[i+1]);
-    BASE64_BITS b64_ch3_bits = base64_char_to_bits(base64_str[i+2]);
-    BASE64_BITS b64_ch4_bits = base64_char_to_bits(base64_str[i+3]);
-    
-    BASE64_CHUNK_BITS b64_chunk_bits;
-    b64_chunk_bits |= b64_ch1_bits.to_ulong() << (NUM_BASE64_BITS * 3);
-    b64_chunk_bits |= b64_ch2_bits.to_ulong() << (NUM_BASE64_BITS * 2);
-    b64_chunk_bits |= b64_ch3_bits.to_ulong() << NUM_BASE64_BITS;
-    b64_chunk_bits |= b64_ch4_bits.to_ulong();
-
-    unsigned long b64_chunk = b64_chunk_bits.to_ulong();
-    CHAR_BITS ch1 = (b64_chunk & ch1_mask) >> (NUM_CHAR_BITS * 2);
-    CHAR_BITS ch2 = (b64_chunk & ch2_mask) >> NUM_CHAR_BITS;
-    CHAR_BITS ch3 = (b64_chunk & ch3_mask);
-
-    bitstring.push_back(ch1);
-    bitstring.push_back(ch2);
-    bitstring.push_back(ch3);
+  std::unique_ptr<CrackCache> cache;
+  if (!cache_file.empty()) {
+    cache.reset(new CrackCache(cache_file));
   }
 
-  return bitstring;
-}
-
-BASE64_BITS base64_char_to_bits(const char base64_char)
-{
-  if (base64_char >= 'A' && base64_char <= 'Z') {
-    return base64_char - 'A';
-  } else if (base64_char >= 'a' && base64_char <= 'z') {
-    return base64_char - 'a' + 26;
-  } else if (base64_char >= '0' && base64_char <= '9') {
-    return base64_char - '0' + 52;
-  } else if (base64_char == '+') {
-    return 62;
-  } else if (base64_char == '/') {
-    return 63;
-  } else if (base64_char == '=') {
+  Output output;
+  if (!cribs.empty()) {
+    crack_with_cribs(encrypted_bits, cribs, max_keysize, num_threads, cache.get(), output);
     return 0;
-  } else {
-    throw std::invalid_argument("base64_char is not a base64 value");
   }
-}
 
-unsigned hamming_distance(const STR_BITS s1, const STR_BITS s2)
-{
-  if (s1.size() != s2.size()) {
-    throw std::invalid_argument("strings must be equal length");
+  // a cache hit skips the keysize and key searches
+  CacheKey cache_key;
+  std::vector<CachedKey> columns;
+  if (cache) {
+    cache_key = make_cache_key(encrypted_bits, CACHE_MODE_COLUMNS);
   }
-
-  unsigned distance = 0;
-  for (int i = 0; i < s1.size(); i++) {
-    CHAR_BITS byte = s1[i] ^ s2[i];
-    for (int i = 0; i < NUM_CHAR_BITS; i++) {
-      if (byte.test(i)) {
-	distance++;
-      }
+  if (!cache || !cache->find(cache_key, columns)) {
+    std::vector<KEY_EVALUATION> key_evaluations;
+    {
+      INSTRUMENT_STAGE("keysize");
+      key_evaluations = evaluate_key_lengths(encrypted_bits);
     }
-  }
-
-  return distance;
-}
-
-std::vector<KEY_EVALUATION> evaluate_key_lengths(const STR_BITS encrypted_bits)
-{
-  std::vector<KEY_EVALUATION> key_evaluations;
-
-  for (int keysize = 2; keysize <= 40; keysize++) {
-    STR_BITS block1, block2, block3, block4;
-    for (int pos = 0; pos < keysize; pos++) {
-      block1.push_back(encrypted_bits[pos]);
-      block2.push_back(encrypted_bits[pos + keysize]);
-      block3.push_back(encrypted_bits[pos + (keysize * 2)]);
-      block4.push_back(encrypted_bits[pos + (keysize * 3)]);
+    if (key_evaluations.empty()) {
+      throw std::invalid_argument("input is too short to find a key length");
+    }
+    columns = attempt_decrypt_with_keylength(encrypted_bits, key_evaluations[0].first);
+    if (cache) {
+      cache->insert(cache_key, columns);
     }
-
-    int d1 = hamming_distance(block1, block2);
-    int d2 = hamming_distance(block3, block4);
-    int d3 = hamming_distance(block1, block3);
-    int d4 = hamming_distance(block2, block4);
-    int d5 = hamming_distance(block2, block3);
-    int d6 = hamming_distance(block1, block4);
-    double average_distance = (double) (d1 + d2 + d3 + d4 + d5 + d6) / 6;
-    double normalized_distance = average_distance / keysize;
-
-    KEY_EVALUATION key_evaluation(keysize, normalized_distance);
-    key_evaluations.push_back(key_evaluation);
   }
 
-  std::sort(key_evaluations.begin(), key_evaluations.end(), compare_key_evaluations);
+  output.write("Trying keylength " + std::to_string(columns.size()) + "\n");
+  print_candidates(columns, output);
 
-  return key_evaluations;
-}
+  /*
+  Bytes key = str_to_bytes("Terminator X: Bring the noise");
+  decrypt(key, encrypted_bits, output);
+  */
 
-bool compare_key_evaluations(const KEY_EVALUATION &ke1, const KEY_EVALUATION &ke2)
-{
-  return ke1.second < ke2.second;
+  return 0;
 }
 
-void attempt_decrypt_with_keylength(const STR_BITS encrypted, const int keylength)
+std::vector<CachedKey> attempt_decrypt_with_keylength(ByteSpan encrypted, const int keylength)
 {
-  std::vector<STR_BITS> encrypted_blocks = generate_blocks(encrypted, keylength);
+  INSTRUMENT_STAGE("key_search");
+  std::vector<Bytes> encrypted_blocks = generate_blocks(encrypted, keylength);
 
+  std::vector<CachedKey> columns;
   for (auto &encrypted_block : encrypted_blocks) {
-    attempt_decrypt(encrypted_block);
+    columns.push_back(attempt_decrypt(encrypted_block));
   }
+  return columns;
 }
 
-std::vector<STR_BITS> generate_blocks(const STR_BITS encrypted, const int keylength)
+CachedKey attempt_decrypt(ByteSpan encrypted)
 {
-  std::vector<STR_BITS> blocks;
-  for (int i = 0; i < keylength; i++) {
-    STR_BITS block;
-    for (int j = i; j < encrypted.size(); j += keylength) {
-      block.push_back(encrypted[j]);
+  // reasonable keys and the byte model log probability of their decryption
+  std::vector<std::pair<int32_t, char> > candidates;
+
+  Bytes decrypted(encrypted.size());
+  INSTRUMENT_COUNT("keys_tried", CHAR_MAX - CHAR_MIN);
+  for (int key = CHAR_MIN; key < CHAR_MAX; key++) {
+    single_byte_xor(encrypted, (byte) key, decrypted);
+
+    std::string plaintext = decrypted.to_string();
+    if (is_reasonable_plaintext(plaintext)) {
+      // a column of every keylength-th byte has no word context, so only single bytes are scored
+      candidates.emplace_back(ngram_byte_log_prob(decrypted), (char) key);
+    } else {
+      INSTRUMENT_COUNT("keys_pruned", 1);
     }
-    blocks.push_back(block);
   }
-  return blocks;
+
+  // most likely key first
+  std::stable_sort(candidates.begin(), candidates.end(),
+		   [](const std::pair<int32_t, char>& c1, const std::pair<int32_t, char>& c2) { return c1.first > c2.first; });
+
+  CachedKey column;
+  column.key.resize(candidates.size());
+  for (size_t i = 0; i < candidates.size(); i++) {
+    column.key[i] = candidates[i].second;
+  }
+  column.score = candidates.empty() ? -INFINITY : candidates[0].first;
+  return column;
 }
 
-void attempt_decrypt(const STR_BITS encrypted)
+void print_candidates(const std::vector<CachedKey>& columns, Output& output)
 {
-  for (int key = CHAR_MIN; key < CHAR_MAX; key++) {
-    CHAR_BITS key_bits(key);
-    std::ostringstream text_os;
-    for (auto& encrypted_ch_bin : encrypted) {
-      CHAR_BITS decrypted_ch_bin = key_bits ^ encrypted_ch_bin;
-      text_os << (char) decrypted_ch_bin.to_ulong();
-    }
-
-    std::string plaintext = text_os.str();
-    if (is_reasonable_plaintext(plaintext)) {
-      std::cout << (char) key << " ";
+  INSTRUMENT_STAGE("output");
+  for (auto& column : columns) {
+    for (byte candidate : column.key) {
+      char* p = output.reserve(2);
+      p[0] = candidate;
+      p[1] = ' ';
     }
+    output.put('\n');
   }
-  std::cout << std::endl;
 }
 
-bool is_reasonable_plaintext(const std::string text)
+bool is_reasonable_plaintext(const std::string& text)
 {
   int num_valid_chars = 0;
   for (auto ch : text) {
@@ -238,18 +196,68 @@ bool is_reasonable_plaintext(const std::string text)
   return (percent_valid_chars >= 0.95);
 }
 
-void decrypt(const STR_BITS key, const STR_BITS encrypted)
+void decrypt(ByteSpan key, ByteSpan encrypted, Output& output)
 {
+  // decrypt straight into the output buffer a block at a time
   size_t key_pos = 0;
-
-  for (auto &ch_bits : encrypted) {
-    if (key_pos >= key.size()) {
-      key_pos = 0;
+  for (size_t i = 0; i < encrypted.size(); i += DECRYPT_BLOCK_SIZE) {
+    size_t n = std::min(DECRYPT_BLOCK_SIZE, encrypted.size() - i);
+    char* decrypted = output.reserve(n);
+    for (size_t j = 0; j < n; j++) {
+      decrypted[j] = encrypted[i + j] ^ key[key_pos];
+      if (++key_pos == key.size()) {
+	key_pos = 0;
+      }
     }
+  }
+}
 
-    CHAR_BITS decrypted_ch = ch_bits ^ key[key_pos];
-    std::cout << (char) decrypted_ch.to_ulong();
+void crack_with_cribs(ByteSpan encrypted, const std::vector<Bytes>& cribs, size_t max_keysize,
+		      unsigned num_threads, CrackCache* cache, Output& output)
+{
+  // the cribs and the keysize range change the result, the thread count does not
+  std::string mode = CACHE_MODE_CRIBS " " + std::to_string(max_keysize);
+  for (auto& crib : cribs) {
+    mode += " " + std::to_string(crib.size()) + ":" + crib.to_string();
+  }
 
-    key_pos++;
+  // cached as the key, then a byte per key byte that is 1 where a crib reached it
+  CacheKey cache_key;
+  std::vector<CachedKey> cached;
+  CribKey key;
+  if (cache) {
+    cache_key = make_cache_key(encrypted, mode);
   }
+  if (cache && cache->find(cache_key, cached) && cached.size() == 2) {
+    key.key = std::move(cached[0].key);
+    key.score = cached[0].score;
+    key.known.assign(cached[1].key.begin(), cached[1].key.end());
+  } else {
+    key = ::crack_with_cribs(encrypted, cribs, MIN_KEYSIZE, max_keysize, num_threads);
+    if (cache) {
+      std::vector<CachedKey> entries(2);
+      entries[0] = {key.key.clone(), key.score};
+      entries[1].key.resize(key.known.size());
+      for (size_t i = 0; i < key.known.size(); i++) {
+	entries[1].key[i] = key.known[i];
+      }
+      entries[1].score = 0;
+      cache->insert(cache_key, entries);
+    }
+  }
+
+  // mark the key bytes no crib reached, which are only the byte model's best guess
+  std::string guessed(key.key.size(), ' ');
+  for (size_t i = 0; i < key.key.size(); i++) {
+    if (!key.known[i]) {
+      guessed[i] = '?';
+    }
+  }
+  output.write("Keylength " + std::to_string(key.key.size()) + "\n");
+  output.write("Key:     ");
+  output.write(key.key);
+  output.write("\nGuessed: " + guessed + "\n");
+
+  INSTRUMENT_STAGE("decrypt");
+  decrypt(key.key, encrypted, output);
 }
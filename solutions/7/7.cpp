@@ -1,190 +1,388 @@
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstring>
 #include <iostream>
-#include <string>
-#include <memory>
-#include <limits>
+#include <mutex>
+#include <set>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <openssl/evp.h>
-#include <openssl/rand.h>
-
-static const unsigned int KEY_SIZE = 16;
-static const unsigned int BLOCK_SIZE = 16;
+#include <unistd.h>
+
+#include "../common/aes.h"
+#include "../common/aes_search.h"
+#include "../common/bytes.h"
+#include "../common/encoding.h"
+#include "../common/input.h"
+#include "../common/instrument.h"
+#include "../common/output.h"
+#include "../common/plaintext.h"
+
+// mask candidates handed to a thread at a time
+#define MASK_UNIT_SIZE (1ul << 16)
+// spellings tried for every word: lower case, upper case and capitalized
+#define NUM_CASE_VARIANTS 3
+
+// a known plaintext block, its ciphertext, and the key once a thread finds it
+struct SearchTarget {
+  byte plaintext[AES_BLOCK_SIZE];
+  byte ciphertext[AES_BLOCK_SIZE];
+  std::atomic<bool> found{false};
+  std::mutex mutex;
+  byte key[AES_KEY_SIZE];
+};
 
-template <typename T>
-struct zallocator
-{
+// collects candidate keys AES_SEARCH_LANES at a time and tests them against the target
+class KeyBatch {
 public:
-    typedef T value_type;
-    typedef value_type* pointer;
-    typedef const value_type* const_pointer;
-    typedef value_type& reference;
-    typedef const value_type& const_reference;
-    typedef std::size_t size_type;
-    typedef std::ptrdiff_t difference_type;
-
-    pointer address (reference v) const {return &v;}
-    const_pointer address (const_reference v) const {return &v;}
-
-    pointer allocate (size_type n, const void* hint = 0) {
-        if (n > std::numeric_limits<size_type>::max() / sizeof(T))
-            throw std::bad_alloc();
-        return static_cast<pointer> (::operator new (n * sizeof (value_type)));
-    }
-
-    void deallocate(pointer p, size_type n) {
-        OPENSSL_cleanse(p, n*sizeof(T));
-        ::operator delete(p); 
-    }
-    
-    size_type max_size() const {
-        return std::numeric_limits<size_type>::max() / sizeof (T);
-    }
-    
-    template<typename U>
-    struct rebind
-    {
-        typedef zallocator<U> other;
-    };
-
-    void construct (pointer ptr, const T& val) {
-        new (static_cast<T*>(ptr) ) T (val);
+  explicit KeyBatch(SearchTarget& target) : target(target), num_keys(0), keys_tried(0) {
+    memset(keys, 0, sizeof(keys));
+  }
+
+  // sources write the next candidate straight into the batch
+  byte* slot() { return keys[num_keys]; }
+  void commit() {
+    if (++num_keys == AES_SEARCH_LANES) {
+      test();
     }
-
-    void destroy(pointer ptr) {
-        static_cast<T*>(ptr)->~T();
+  }
+  // test what is left in a partly filled batch
+  void finish() {
+    if (num_keys > 0) {
+      test();
     }
+  }
+  uint64_t tried() const { return keys_tried; }
 
-#if __cpluplus >= 201103L
-    template<typename U, typename... Args>
-    void construct (U* ptr, Args&&  ... args) {
-        ::new (static_cast<void*> (ptr) ) U (std::forward<Args> (args)...);
-    }
+private:
+  void test();
 
-    template<typename U>
-    void destroy(U* ptr) {
-        ptr->~U();
-    }
-#endif
+  SearchTarget& target;
+  byte keys[AES_SEARCH_LANES][AES_KEY_SIZE];
+  size_t num_keys;
+  uint64_t keys_tried;
 };
 
-typedef unsigned char byte;
-typedef std::basic_string<char, std::char_traits<char>, zallocator<char> > secure_string;
-using EVP_CIPHER_CTX_free_ptr = std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)>;
+// 16 byte keys from the wordlist: single words, or two words joined by a separator. The
+// candidates for one first word make up a unit of work.
+class WordSource {
+public:
+  WordSource(const std::set<std::string>& wordlist, bool pairs, const std::string& separators);
+  size_t num_units() const { return pairs ? first_words.size() : by_length[AES_KEY_SIZE][0].size(); }
+  void enumerate(size_t unit, KeyBatch& batch) const;
+
+private:
+  bool pairs;
+  std::vector<std::string> separators;
+  // words of each length up to AES_KEY_SIZE, in each case variant
+  std::vector<std::string> by_length[AES_KEY_SIZE + 1][NUM_CASE_VARIANTS];
+  // (length, index) of every word short enough to start a pair
+  std::vector<std::pair<size_t, size_t> > first_words;
+};
+
+// 16 byte keys matching a mask: ?l lower case letters, ?u upper case letters, ?d digits,
+// ?s space and punctuation, ?a all printable characters, ?? a question mark, anything else
+// itself. Candidates are numbered in mixed radix and split into runs of MASK_UNIT_SIZE.
+class MaskSource {
+public:
+  explicit MaskSource(const std::string& mask);
+  size_t num_units() const { return (num_keys + MASK_UNIT_SIZE - 1) / MASK_UNIT_SIZE; }
+  void enumerate(size_t unit, KeyBatch& batch) const;
+
+private:
+  std::vector<std::string> charsets;
+  uint64_t num_keys;
+};
+
+// try every candidate of source on num_threads threads; true if the key was found
+template <typename Source>
+bool search_keys(const Source& source, SearchTarget& target, unsigned num_threads);
 
-void aes_encrypt(const byte key[KEY_SIZE], const secure_string& ptext, secure_string& ctext);
-void aes_decrypt(const byte key[KEY_SIZE], const secure_string& ctext, secure_string& rtext);
-void b64_encode(const secure_string& ptext, secure_string& ctext);
-void b64_decode(const secure_string& etext, secure_string& dtext);
 
 int main(int argc, char* argv[])
 {
-    // Load the necessary cipher
-    EVP_add_cipher(EVP_aes_128_ecb());
-
-    // encoded ciphertext
-    secure_string ectext(std::istreambuf_iterator<char>(std::cin), {});
+  std::string known_plaintext;
+  std::string source_name;
+  std::string wordlist_file = "wordlist.txt";
+  std::string mask;
+  std::string separators = " ";
+  unsigned num_threads = std::max(1u, std::thread::hardware_concurrency());
+  bool pad = true;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "np:s:w:m:d:t:")) != -1) {
+    switch (opt) {
+    case 'n': pad = false; break;
+    case 'p': known_plaintext = optarg; break;
+    case 's': source_name = optarg; break;
+    case 'w': wordlist_file = optarg; break;
+    case 'm': mask = optarg; break;
+    case 'd': separators = optarg; break;
+    case 't': num_threads = std::max(1ul, std::stoul(optarg)); break;
+    default:
+      std::cerr << "usage: " << argv[0] << " [-n] [-p known_plaintext [-s words|pairs|mask] [-w wordlist]"
+		<< " [-m mask] [-d separators] [-t threads]]" << std::endl;
+      return 1;
+    }
+  }
+
+  // Load the necessary cipher
+  EVP_add_cipher(EVP_aes_128_ecb());
+
+  // the ciphertext is decrypted in place, so it is the only full size buffer once the
+  // encoded text is released
+  Bytes ctext;
+  {
+    Input input;
+    std::string scratch;
+    std::string_view ectext;
+    {
+      INSTRUMENT_STAGE("read");
+      ectext = strip_whitespace(input.read_all(), scratch);
+      INSTRUMENT_COUNT("bytes_read", ectext.size());
+    }
 
-    // ciphertext, recovered text
-    secure_string ctext, rtext;
-    
-    b64_decode(ectext, ctext);
+    INSTRUMENT_STAGE("decode");
+    ctext = base64_str_to_bytes(ectext);
+    INSTRUMENT_COUNT("bytes_decoded", ctext.size());
+  }
 
-    byte key[KEY_SIZE] = {
-      'Y', 'E', 'L', 'L', 'O', 'W', ' ', 'S',
-      'U', 'B', 'M', 'A', 'R', 'I', 'N', 'E'};
+  byte key[AES_KEY_SIZE] = {
+    'Y', 'E', 'L', 'L', 'O', 'W', ' ', 'S',
+    'U', 'B', 'M', 'A', 'R', 'I', 'N', 'E'};
 
-    aes_decrypt(key, ctext, rtext);
-    
-    OPENSSL_cleanse(key, KEY_SIZE);
+  // with a known plaintext, search for the key that encrypts it to the first block instead
+  if (!known_plaintext.empty()) {
+    if (known_plaintext.size() < AES_BLOCK_SIZE || ctext.size() < AES_BLOCK_SIZE) {
+      throw std::invalid_argument("the key search needs a full known plaintext and ciphertext block");
+    }
+    SearchTarget target;
+    memcpy(target.plaintext, known_plaintext.data(), AES_BLOCK_SIZE);
+    memcpy(target.ciphertext, ctext.data(), AES_BLOCK_SIZE);
 
-    std::cout << "Recovered message:\n" << rtext << std::endl;
+    if (source_name.empty()) {
+      source_name = mask.empty() ? "pairs" : "mask";
+    }
+    bool found;
+    if (source_name == "mask") {
+      found = search_keys(MaskSource(mask), target, num_threads);
+    } else if (source_name == "words" || source_name == "pairs") {
+      found = search_keys(WordSource(read_wordlist(wordlist_file), source_name == "pairs", separators),
+			  target, num_threads);
+    } else {
+      throw std::invalid_argument("unknown key source " + source_name);
+    }
 
-    return 0;
+    if (!found) {
+      std::cerr << "key not found" << std::endl;
+      return 1;
+    }
+    memcpy(key, target.key, AES_KEY_SIZE);
+    OPENSSL_cleanse(target.key, AES_KEY_SIZE);
+    std::cerr << "key: " << std::string((const char*) key, AES_KEY_SIZE) << std::endl;
+  }
+
+  size_t rtext_size;
+  {
+    INSTRUMENT_STAGE("decrypt");
+    rtext_size = aes_decrypt(key, ctext, ctext, pad);
+    INSTRUMENT_COUNT("bytes_decrypted", rtext_size);
+  }
+
+  OPENSSL_cleanse(key, AES_KEY_SIZE);
+
+  {
+    INSTRUMENT_STAGE("output");
+    Output output;
+    output.write("Recovered message:\n");
+    output.write(ctext.subspan(0, rtext_size));
+    output.put('\n');
+  }
+  OPENSSL_cleanse(ctext.data(), ctext.size());
+
+  return 0;
 }
 
-void b64_encode(const secure_string& ptext, secure_string& etext)
+void KeyBatch::test()
 {
-  EVP_ENCODE_CTX *ctx = EVP_ENCODE_CTX_new();
-  EVP_EncodeInit(ctx);
-
-  int rc;
-  etext.resize(ptext.size()+ BLOCK_SIZE);
-  int out_len1 = (int) etext.size();
-  rc = EVP_EncodeUpdate(ctx, (byte *) &etext[0], &out_len1,
-			(const byte *) &ptext[0], (int) ptext.size());
-  if (rc != 1)
-    throw std::runtime_error("EVP_EncodeUpdate failed");
-
-  int out_len2 = (int) etext.size() - out_len1;
-  EVP_EncodeFinal(ctx, (byte *) &etext[0] + out_len1, &out_len2);
-
-  etext.resize(out_len1 + out_len2);
+  unsigned matches = aes128_match_keys(keys, target.plaintext, target.ciphertext);
+  matches &= (1u << num_keys) - 1;
+  if (matches != 0) {
+    std::lock_guard<std::mutex> lock(target.mutex);
+    memcpy(target.key, keys[__builtin_ctz(matches)], AES_KEY_SIZE);
+    target.found = true;
+  }
+  keys_tried += num_keys;
+  num_keys = 0;
 }
 
-void b64_decode(const secure_string& etext, secure_string& dtext)
+WordSource::WordSource(const std::set<std::string>& wordlist, bool pairs, const std::string& separators)
+  : pairs(pairs)
 {
-  EVP_ENCODE_CTX *ctx = EVP_ENCODE_CTX_new();
-  EVP_DecodeInit(ctx);
-
-  int rc;
-  dtext.resize(etext.size() + BLOCK_SIZE);
-  int out_len1 = (int) dtext.size();
-  rc = EVP_DecodeUpdate(ctx, (byte *) &dtext[0], &out_len1,
-			(const byte *) &etext[0], (int) etext.size());
-  if (rc == -1)
-    throw std::runtime_error("EVP_DecodeUpdate failed");
-
-  int out_len2 = (int) dtext.size() - out_len1;
-  EVP_DecodeFinal(ctx, (byte *) &dtext[0] + out_len1, &out_len2);
+  // each character is one separator; an empty string means words are joined directly
+  if (separators.empty()) {
+    this->separators.push_back("");
+  }
+  for (char ch : separators) {
+    this->separators.push_back(std::string(1, ch));
+  }
+
+  for (auto& word : wordlist) {
+    if (word.empty() || word.size() > AES_KEY_SIZE) {
+      continue;
+    }
+    std::string lower = word, upper = word, capitalized;
+    std::transform(word.begin(), word.end(), lower.begin(), ::tolower);
+    std::transform(word.begin(), word.end(), upper.begin(), ::toupper);
+    capitalized = lower;
+    capitalized[0] = toupper(capitalized[0]);
+
+    std::vector<std::string>* variants = by_length[word.size()];
+    variants[0].push_back(lower);
+    variants[1].push_back(upper);
+    variants[2].push_back(capitalized);
+    if (word.size() < AES_KEY_SIZE) {
+      first_words.emplace_back(word.size(), variants[0].size() - 1);
+    }
+  }
+}
 
-  dtext.resize(out_len1 + out_len2);
+void WordSource::enumerate(size_t unit, KeyBatch& batch) const
+{
+  if (!pairs) {
+    for (size_t variant = 0; variant < NUM_CASE_VARIANTS; variant++) {
+      memcpy(batch.slot(), by_length[AES_KEY_SIZE][variant][unit].data(), AES_KEY_SIZE);
+      batch.commit();
+    }
+    return;
+  }
+
+  size_t first_length = first_words[unit].first;
+  size_t first_index = first_words[unit].second;
+  for (auto& separator : separators) {
+    if (first_length + separator.size() >= AES_KEY_SIZE) {
+      continue;
+    }
+    size_t second_length = AES_KEY_SIZE - first_length - separator.size();
+    for (size_t variant = 0; variant < NUM_CASE_VARIANTS; variant++) {
+      const std::string& first = by_length[first_length][variant][first_index];
+      for (auto& second : by_length[second_length][variant]) {
+	byte* key = batch.slot();
+	memcpy(key, first.data(), first_length);
+	memcpy(key + first_length, separator.data(), separator.size());
+	memcpy(key + first_length + separator.size(), second.data(), second_length);
+	batch.commit();
+      }
+    }
+  }
 }
 
-void aes_encrypt(const byte key[KEY_SIZE], const secure_string& ptext, secure_string& ctext)
+MaskSource::MaskSource(const std::string& mask)
 {
-    EVP_CIPHER_CTX_free_ptr ctx(EVP_CIPHER_CTX_new(), ::EVP_CIPHER_CTX_free);
-    int rc = EVP_EncryptInit_ex(ctx.get(), EVP_aes_128_ecb(), NULL, key, NULL);
-    if (rc != 1)
-      throw std::runtime_error("EVP_EncryptInit_ex failed");
-
-    // Recovered text expands upto BLOCK_SIZE
-    ctext.resize(ptext.size()+BLOCK_SIZE);
-    int out_len1 = (int)ctext.size();
-
-    rc = EVP_EncryptUpdate(ctx.get(), (byte*)&ctext[0], &out_len1, (const byte*)&ptext[0], (int)ptext.size());
-    if (rc != 1)
-      throw std::runtime_error("EVP_EncryptUpdate failed");
-  
-    int out_len2 = (int)ctext.size() - out_len1;
-    rc = EVP_EncryptFinal_ex(ctx.get(), (byte*)&ctext[0]+out_len1, &out_len2);
-    if (rc != 1)
-      throw std::runtime_error("EVP_EncryptFinal_ex failed");
-
-    // Set cipher text size now that we know it
-    ctext.resize(out_len1 + out_len2);
+  std::string lower = "abcdefghijklmnopqrstuvwxyz";
+  std::string upper = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+  std::string digits = "0123456789";
+  std::string symbols = " !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~";
+
+  for (size_t i = 0; i < mask.size(); i++) {
+    if (mask[i] != '?') {
+      charsets.push_back(std::string(1, mask[i]));
+      continue;
+    }
+    if (++i == mask.size()) {
+      throw std::invalid_argument("mask ends in ?");
+    }
+    switch (mask[i]) {
+    case 'l': charsets.push_back(lower); break;
+    case 'u': charsets.push_back(upper); break;
+    case 'd': charsets.push_back(digits); break;
+    case 's': charsets.push_back(symbols); break;
+    case 'a': charsets.push_back(lower + upper + digits + symbols); break;
+    case '?': charsets.push_back("?"); break;
+    default:
+      throw std::invalid_argument(std::string("unknown mask class ?") + mask[i]);
+    }
+  }
+  if (charsets.size() != AES_KEY_SIZE) {
+    throw std::invalid_argument("mask must describe exactly 16 key bytes");
+  }
+
+  num_keys = 1;
+  for (auto& charset : charsets) {
+    if (num_keys > UINT64_MAX / charset.size()) {
+      throw std::invalid_argument("mask has too many candidates");
+    }
+    num_keys *= charset.size();
+  }
 }
 
-void aes_decrypt(const byte key[KEY_SIZE], const secure_string& ctext, secure_string& rtext)
+void MaskSource::enumerate(size_t unit, KeyBatch& batch) const
 {
-    EVP_CIPHER_CTX_free_ptr ctx(EVP_CIPHER_CTX_new(), ::EVP_CIPHER_CTX_free);
-    int rc = EVP_DecryptInit_ex(ctx.get(), EVP_aes_128_ecb(), NULL, key, NULL);
-    if (rc != 1)
-      throw std::runtime_error("EVP_DecryptInit_ex failed");
-
-    // Recovered text contracts upto BLOCK_SIZE
-    rtext.resize(ctext.size());
-    int out_len1 = (int)rtext.size();
-
-    rc = EVP_DecryptUpdate(ctx.get(), (byte*)&rtext[0], &out_len1, (const byte*)&ctext[0], (int)ctext.size());
-    if (rc != 1)
-      throw std::runtime_error("EVP_DecryptUpdate failed");
-  
-    int out_len2 = (int)rtext.size() - out_len1;
-    rc = EVP_DecryptFinal_ex(ctx.get(), (byte*)&rtext[0]+out_len1, &out_len2);
-    if (rc != 1)
-      throw std::runtime_error("EVP_DecryptFinal_ex failed");
-
-    // Set recovered text size now that we know it
-    rtext.resize(out_len1 + out_len2);
+  uint64_t start = unit * MASK_UNIT_SIZE;
+  uint64_t count = std::min<uint64_t>(MASK_UNIT_SIZE, num_keys - start);
+
+  // digits of the first candidate, the last position counting fastest
+  size_t digits[AES_KEY_SIZE];
+  byte key[AES_KEY_SIZE];
+  for (size_t i = AES_KEY_SIZE; i-- > 0;) {
+    digits[i] = start % charsets[i].size();
+    start /= charsets[i].size();
+    key[i] = charsets[i][digits[i]];
+  }
+
+  for (uint64_t n = 0; n < count; n++) {
+    memcpy(batch.slot(), key, AES_KEY_SIZE);
+    batch.commit();
+
+    // step to the next candidate, carrying into earlier positions
+    for (size_t i = AES_KEY_SIZE; i-- > 0;) {
+      if (++digits[i] < charsets[i].size()) {
+	key[i] = charsets[i][digits[i]];
+	break;
+      }
+      digits[i] = 0;
+      key[i] = charsets[i][0];
+    }
+  }
 }
 
+template <typename Source>
+bool search_keys(const Source& source, SearchTarget& target, unsigned num_threads)
+{
+  auto start = std::chrono::steady_clock::now();
+  std::atomic<size_t> next_unit{0};
+  std::atomic<uint64_t> keys_tried{0};
+
+  auto worker = [&] {
+    INSTRUMENT_STAGE("key_search");
+    KeyBatch batch(target);
+    size_t unit;
+    while (!target.found.load(std::memory_order_relaxed)
+	   && (unit = next_unit.fetch_add(1, std::memory_order_relaxed)) < source.num_units()) {
+      source.enumerate(unit, batch);
+    }
+    batch.finish();
+    keys_tried += batch.tried();
+  };
+
+  std::vector<std::thread> workers;
+  for (unsigned i = 1; i < num_threads; i++) {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (auto& t : workers) {
+    t.join();
+  }
+  INSTRUMENT_COUNT("keys_tried", keys_tried.load());
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  std::cerr << keys_tried.load() << " keys in " << elapsed.count() << " s ("
+	    << keys_tried.load() / elapsed.count() / 1e6 << " Mkeys/s, " << num_threads << " threads)" << std::endl;
+
+  return target.found.load();
+}
@@ -1,10 +1,129 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
 #include <iostream>
+#include <queue>
 #include <set>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../common/block_index.h"
+#include "../common/bytes.h"
+#include "../common/blocks.h"
+#include "../common/corpus.h"
+#include "../common/encoding.h"
 
 #define BLOCK_SIZE 16
+#define DEFAULT_TOP_K 10
+#define DEFAULT_INDEX_MEMORY_MB 1024
+// lines of a group printed before the rest are only counted
+#define MAX_GROUP_LINES_SHOWN 10
+
+// visit(i, first, fn) calls fn(num, bytes) for each ciphertext in the i-th share of a corpus,
+// numbered from first + 1, and returns how many there were
+typedef std::function<size_t(unsigned, size_t, const std::function<void(size_t, ByteSpan)> &)> CORPUS_VISITOR;
+
+struct LineScore {
+  double ratio;
+  unsigned duplicate_blocks;
+  unsigned total_blocks;
+  size_t line_num;
+  const char *line;
+  size_t line_length;
+};
+
+struct ScanResult {
+  std::vector<LineScore> top;
+  size_t num_lines;
+};
+
+// true if s1 ranks above s2, so that sorting puts the best line first and a priority_queue
+// keeps the worst of its lines on top, where a better one replaces it
+bool compare_line_scores(const LineScore &s1, const LineScore &s2);
+
+// report duplicate blocks in each hex line read from stdin
+void detect_stdin();
+
+// scan a memory-mapped corpus in parallel and print the top_k most ECB-like lines, or with
+// index_memory bytes for a block index, the top_k groups of lines that share blocks
+void scan_corpus(const std::string filename, bool base64, size_t top_k, unsigned num_threads, size_t index_memory);
+
+// scan the lines in [begin, end) and keep the top_k most ECB-like lines
+ScanResult scan_range(const char *begin, const char *end, bool base64, size_t top_k);
+
+// call fn(line_num, encoded, bytes) for each line in [begin, end) that decodes, numbering the
+// lines from first_line + 1, and return the number of lines
+template <typename Fn>
+size_t for_each_line(const char *begin, const char *end, bool base64, size_t first_line, Fn fn);
+
+// scan a binary corpus in parallel, split by record number, and print the top_k most ECB-like
+// records, or the top_k groups of records that share blocks
+void scan_binary_corpus(const std::string filename, size_t top_k, unsigned num_threads, size_t index_memory);
+
+// scan records [begin, end) of a binary corpus and keep the top_k most ECB-like, numbering
+// them from 1
+ScanResult scan_records(const CorpusReader &corpus, size_t begin, size_t end, size_t top_k);
+
+// run scan(i) for each of num_threads shares of a corpus of size bytes, each share numbering
+// its ciphertexts from 1, then print(score) the top_k most ECB-like of them all, numbered
+// across the corpus; unit names a ciphertext in the report
+void scan_shares(const std::function<ScanResult(unsigned)> &scan, unsigned num_threads, size_t top_k,
+		 size_t size, const std::string &unit, const std::function<void(const LineScore &)> &print);
+
+// index every block of a corpus split into num_threads shares and print the top_k groups of
+// ciphertexts that share blocks; unit names a ciphertext in the report
+void index_blocks(const CORPUS_VISITOR &visit, unsigned num_threads, size_t expected_blocks,
+		  size_t memory_budget, size_t top_k, const std::string &unit);
+
+// run fn(i) for i in [0, num_threads) on that many threads and wait for them all
+void run_threads(unsigned num_threads, const std::function<void(unsigned)> &fn);
 
-int main(void)
+
+int main(int argc, char *argv[])
+{
+  std::string filename;
+  bool base64 = false;
+  size_t top_k = DEFAULT_TOP_K;
+  unsigned num_threads = std::max(1u, std::thread::hardware_concurrency());
+  bool cross_lines = false;
+  size_t index_memory_mb = DEFAULT_INDEX_MEMORY_MB;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "f:bk:t:xm:")) != -1) {
+    switch (opt) {
+    case 'f': filename = optarg; break;
+    case 'b': base64 = true; break;
+    case 'k': top_k = std::stoul(optarg); break;
+    case 't': num_threads = std::max(1ul, std::stoul(optarg)); break;
+    case 'x': cross_lines = true; break;
+    case 'm': index_memory_mb = std::max(1ul, std::stoul(optarg)); break;
+    default:
+      std::cerr << "usage: " << argv[0] << " [-f corpus [-b] [-k top_k] [-t threads] [-x [-m memory_mb]]]" << std::endl;
+      return 1;
+    }
+  }
+
+  if (filename.empty()) {
+    detect_stdin();
+  } else {
+    scan_corpus(filename, base64, top_k, num_threads, cross_lines ? index_memory_mb << 20 : 0);
+  }
+
+  return 0;
+}
+
+void detect_stdin()
 {
   std::string encrypted_str;
   while (std::cin >> encrypted_str) {
@@ -18,6 +137,292 @@ int main(void)
       }
     }
   }
+}
 
-  return 0;
+void scan_corpus(const std::string filename, bool base64, size_t top_k, unsigned num_threads, size_t index_memory)
+{
+  if (CorpusReader::is_corpus(filename)) {
+    scan_binary_corpus(filename, top_k, num_threads, index_memory);
+    return;
+  }
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd == -1) {
+    throw std::invalid_argument("unable to open corpus file");
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) == -1) {
+    close(fd);
+    throw std::runtime_error("unable to stat corpus file");
+  }
+
+  size_t size = st.st_size;
+  if (size == 0) {
+    close(fd);
+    return;
+  }
+
+  void *mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    throw std::runtime_error("unable to mmap corpus file");
+  }
+  madvise(mapping, size, MADV_SEQUENTIAL);
+
+  // split the file into ranges that start and end on line boundaries
+  const char *data = static_cast<const char *>(mapping);
+  const char *data_end = data + size;
+  std::vector<const char *> bounds;
+  bounds.push_back(data);
+  for (unsigned i = 1; i < num_threads; i++) {
+    const char *split = std::max(data + size / num_threads * i, bounds.back());
+    const char *newline = static_cast<const char *>(memchr(split, '\n', data_end - split));
+    bounds.push_back(newline == NULL ? data_end : newline + 1);
+  }
+  bounds.push_back(data_end);
+
+  if (index_memory > 0) {
+    size_t expected_blocks = (base64 ? size / 4 * 3 : size / 2) / AES_BLOCK_SIZE;
+    index_blocks([&](unsigned i, size_t first_line, const std::function<void(size_t, ByteSpan)> &fn) {
+      return for_each_line(bounds[i], bounds[i + 1], base64, first_line,
+			   [&](size_t line_num, std::string_view, ByteSpan bytes) { fn(line_num, bytes); });
+    }, num_threads, expected_blocks, index_memory, top_k, "line");
+    munmap(mapping, size);
+    return;
+  }
+
+  scan_shares([&](unsigned i) {
+    return scan_range(bounds[i], bounds[i + 1], base64, top_k);
+  }, num_threads, top_k, size, "line", [](const LineScore &score) {
+    std::cout.write(score.line, score.line_length);
+  });
+
+  munmap(mapping, size);
+}
+
+ScanResult scan_range(const char *begin, const char *end, bool base64, size_t top_k)
+{
+  ScanResult result;
+  result.num_lines = 0;
+
+  // the best top_k lines seen so far, the worst of them on top
+  std::priority_queue<LineScore, std::vector<LineScore>, std::function<bool(const LineScore &, const LineScore &)> >
+    heap(compare_line_scores);
+
+  std::vector<BLOCK> blocks;
+  result.num_lines = for_each_line(begin, end, base64, 0, [&](size_t line_num, std::string_view encoded, ByteSpan bytes) {
+    if (bytes.size() < AES_BLOCK_SIZE || top_k == 0) {
+      return;
+    }
+    unsigned total_blocks = bytes.size() / AES_BLOCK_SIZE;
+    unsigned duplicate_blocks = count_duplicate_blocks(bytes, blocks);
+    LineScore score = {(double) duplicate_blocks / total_blocks, duplicate_blocks, total_blocks,
+		       line_num, encoded.data(), encoded.size()};
+
+    if (heap.size() < top_k) {
+      heap.push(score);
+    } else if (compare_line_scores(score, heap.top())) {
+      heap.pop();
+      heap.push(score);
+    }
+  });
+
+  while (!heap.empty()) {
+    result.top.push_back(heap.top());
+    heap.pop();
+  }
+
+  return result;
+}
+
+template <typename Fn>
+size_t for_each_line(const char *begin, const char *end, bool base64, size_t first_line, Fn fn)
+{
+  Bytes bytes;
+  size_t num_lines = 0;
+  const char *line = begin;
+  while (line < end) {
+    const char *newline = static_cast<const char *>(memchr(line, '\n', end - line));
+    const char *line_end = (newline == NULL) ? end : newline;
+    size_t length = line_end - line;
+    if (length > 0 && line[length - 1] == '\r') {
+      length--;
+    }
+
+    num_lines++;
+    std::string_view encoded(line, length);
+    bool decoded = base64 ? base64_decode(encoded, bytes) : hex_decode(encoded, bytes);
+    if (decoded) {
+      fn(first_line + num_lines, encoded, bytes);
+    }
+    line = line_end + 1;
+  }
+  return num_lines;
+}
+
+void scan_binary_corpus(const std::string filename, size_t top_k, unsigned num_threads, size_t index_memory)
+{
+  CorpusReader corpus(filename);
+  if (index_memory > 0) {
+    index_blocks([&](unsigned i, size_t, const std::function<void(size_t, ByteSpan)> &fn) {
+      size_t begin = corpus.size() * i / num_threads;
+      size_t end = corpus.size() * (i + 1) / num_threads;
+      for (size_t r = begin; r < end; r++) {
+	fn(r + 1, corpus.record(r));
+      }
+      return end - begin;
+    }, num_threads, corpus.bytes() / AES_BLOCK_SIZE, index_memory, top_k, "record");
+    return;
+  }
+
+  // records are already decoded and the index gives every record's position, so the
+  // threads just take equal runs of record numbers
+  scan_shares([&](unsigned i) {
+    return scan_records(corpus, corpus.size() * i / num_threads, corpus.size() * (i + 1) / num_threads, top_k);
+  }, num_threads, top_k, corpus.bytes(), "record", [](const LineScore &score) {
+    std::cout << bytes_to_hex(ByteSpan((const byte *) score.line, score.line_length));
+  });
+}
+
+ScanResult scan_records(const CorpusReader &corpus, size_t begin, size_t end, size_t top_k)
+{
+  ScanResult result;
+  result.num_lines = end - begin;
+
+  // the best top_k records seen so far, the worst of them on top
+  std::priority_queue<LineScore, std::vector<LineScore>, std::function<bool(const LineScore &, const LineScore &)> >
+    heap(compare_line_scores);
+
+  std::vector<BLOCK> blocks;
+  for (size_t i = begin; i < end && top_k > 0; i++) {
+    ByteSpan bytes = corpus.record(i);
+    if (bytes.size() < AES_BLOCK_SIZE) {
+      continue;
+    }
+    unsigned total_blocks = bytes.size() / AES_BLOCK_SIZE;
+    unsigned duplicate_blocks = count_duplicate_blocks(bytes, blocks);
+    LineScore score = {(double) duplicate_blocks / total_blocks, duplicate_blocks, total_blocks,
+		       i - begin + 1, (const char *) bytes.data(), bytes.size()};
+
+    if (heap.size() < top_k) {
+      heap.push(score);
+    } else if (compare_line_scores(score, heap.top())) {
+      heap.pop();
+      heap.push(score);
+    }
+  }
+
+  while (!heap.empty()) {
+    result.top.push_back(heap.top());
+    heap.pop();
+  }
+
+  return result;
+}
+
+void scan_shares(const std::function<ScanResult(unsigned)> &scan, unsigned num_threads, size_t top_k,
+		 size_t size, const std::string &unit, const std::function<void(const LineScore &)> &print)
+{
+  auto start = std::chrono::steady_clock::now();
+
+  std::vector<ScanResult> results(num_threads);
+  run_threads(num_threads, [&](unsigned i) { results[i] = scan(i); });
+
+  // merge per-thread heaps, converting share numbers to corpus ones
+  std::vector<LineScore> top;
+  size_t num_ciphertexts = 0;
+  for (auto &result : results) {
+    for (auto &score : result.top) {
+      score.line_num += num_ciphertexts;
+      top.push_back(score);
+    }
+    num_ciphertexts += result.num_lines;
+  }
+
+  std::sort(top.begin(), top.end(), compare_line_scores);
+  if (top.size() > top_k) {
+    top.resize(top_k);
+  }
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  for (auto &score : top) {
+    std::cout << unit << " " << score.line_num << ": "
+	      << score.duplicate_blocks << "/" << score.total_blocks
+	      << " duplicate blocks (" << score.ratio << ") ";
+    print(score);
+    std::cout << std::endl;
+  }
+
+  std::cerr << num_ciphertexts << " " << unit << "s, " << size << " bytes in " << elapsed.count() << " s ("
+	    << num_ciphertexts / elapsed.count() << " " << unit << "s/s, "
+	    << size / elapsed.count() / 1e9 << " GB/s, "
+	    << num_threads << " threads)" << std::endl;
+}
+
+void index_blocks(const CORPUS_VISITOR &visit, unsigned num_threads, size_t expected_blocks,
+		  size_t memory_budget, size_t top_k, const std::string &unit)
+{
+  auto start = std::chrono::steady_clock::now();
+  const char *tmpdir = getenv("TMPDIR");
+  BlockIndex index(expected_blocks, memory_budget, tmpdir != NULL ? tmpdir : "/tmp");
+
+  // first pass: find the blocks that appear in more than one ciphertext, counting each
+  // share's ciphertexts so the second pass can number them
+  std::vector<size_t> counts(num_threads);
+  run_threads(num_threads, [&](unsigned i) {
+    std::vector<BLOCK> blocks;
+    counts[i] = visit(i, 0, [&](size_t, ByteSpan bytes) { index.count(bytes, blocks); });
+  });
+  std::vector<size_t> firsts(num_threads, 0);
+  for (unsigned i = 1; i < num_threads; i++) {
+    firsts[i] = firsts[i - 1] + counts[i - 1];
+  }
+  size_t num_ciphertexts = firsts.back() + counts.back();
+
+  // second pass: keep the ciphertext numbers of those blocks
+  run_threads(num_threads, [&](unsigned i) {
+    BlockIndex::Writer writer(index);
+    visit(i, firsts[i], [&](size_t num, ByteSpan bytes) { writer.add(num, bytes); });
+    writer.flush();
+  });
+
+  std::vector<LineGroup> groups = index.groups(num_threads, top_k);
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  for (size_t g = 0; g < groups.size(); g++) {
+    std::cout << unit << "s";
+    for (size_t i = 0; i < groups[g].lines.size() && i < MAX_GROUP_LINES_SHOWN; i++) {
+      std::cout << " " << groups[g].lines[i];
+    }
+    if (groups[g].lines.size() > MAX_GROUP_LINES_SHOWN) {
+      std::cout << " and " << groups[g].lines.size() - MAX_GROUP_LINES_SHOWN << " more";
+    }
+    std::cout << ": " << groups[g].shared_blocks << " shared blocks" << std::endl;
+  }
+
+  std::cerr << num_ciphertexts << " " << unit << "s, " << index.num_pairs() << " candidate pairs ("
+	    << index.spilled_bytes() << " bytes spilled), " << index.num_groups() << " groups in "
+	    << elapsed.count() << " s (" << num_ciphertexts / elapsed.count() << " " << unit << "s/s, "
+	    << num_threads << " threads)" << std::endl;
+}
+
+void run_threads(unsigned num_threads, const std::function<void(unsigned)> &fn)
+{
+  std::vector<std::thread> workers;
+  for (unsigned i = 0; i < num_threads; i++) {
+    workers.emplace_back(fn, i);
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
+bool compare_line_scores(const LineScore &s1, const LineScore &s2)
+{
+  if (s1.ratio != s2.ratio) {
+    return s1.ratio > s2.ratio;
+  }
+  return s1.line_num < s2.line_num;
 }
@@ -1,25 +1,26 @@
 #include <iostream>
-#include <sstream>
 #include <string>
+#include <string_view>
+
+#include "../common/blocks.h"
+#include "../common/bytes.h"
+#include "../common/input.h"
 
 #define BLOCK_SIZE 20
 
 int main(void)
 {
-  std::ostringstream oss;
-  char ch;
-  while (std::cin >> std::noskipws >> ch) {
-    if (ch != '\n') {
-      oss << ch;
-    }
+  // the input with its newlines dropped
+  Input input;
+  Bytes plaintext;
+  std::string_view line;
+  while (input.next_line(line)) {
+    plaintext.append(line);
   }
 
-  std::string plaintext = oss.str();
-  size_t num_missing_bytes = BLOCK_SIZE - (plaintext.length() % BLOCK_SIZE);
-  std::string padding(num_missing_bytes, (char) num_missing_bytes);
-  plaintext += padding;
+  pkcs7_pad(plaintext, BLOCK_SIZE);
 
-  std::cout << plaintext << std::endl;
+  std::cout << plaintext.to_string() << std::endl;
   
   return 0;
 }
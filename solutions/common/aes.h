@@ -0,0 +1,206 @@
+#ifndef CRYPTOPALS_AES_H
+#define CRYPTOPALS_AES_H
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <openssl/evp.h>
+
+#include "blocks.h"
+#include "bytes.h"
+
+#define AES_KEY_SIZE 16
+
+template <typename T>
+struct zallocator
+{
+public:
+    typedef T value_type;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    pointer address (reference v) const {return &v;}
+    const_pointer address (const_reference v) const {return &v;}
+
+    pointer allocate (size_type n, const void* hint = 0) {
+        if (n > std::numeric_limits<size_type>::max() / sizeof(T))
+            throw std::bad_alloc();
+        return static_cast<pointer> (::operator new (n * sizeof (value_type)));
+    }
+
+    void deallocate(pointer p, size_type n) {
+        OPENSSL_cleanse(p, n*sizeof(T));
+        ::operator delete(p);
+    }
+
+    size_type max_size() const {
+        return std::numeric_limits<size_type>::max() / sizeof (T);
+    }
+
+    template<typename U>
+    struct rebind
+    {
+        typedef zallocator<U> other;
+    };
+
+    void construct (pointer ptr, const T& val) {
+        new (static_cast<T*>(ptr) ) T (val);
+    }
+
+    void destroy(pointer ptr) {
+        static_cast<T*>(ptr)->~T();
+    }
+};
+
+// zallocator is stateless, so any two instances can free each other's memory
+template <typename T, typename U>
+bool operator==(const zallocator<T>&, const zallocator<U>&) { return true; }
+template <typename T, typename U>
+bool operator!=(const zallocator<T>&, const zallocator<U>&) { return false; }
+
+typedef std::basic_string<char, std::char_traits<char>, zallocator<char> > secure_string;
+using EVP_CIPHER_CTX_free_ptr = std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)>;
+using EVP_ENCODE_CTX_free_ptr = std::unique_ptr<EVP_ENCODE_CTX, decltype(&::EVP_ENCODE_CTX_free)>;
+
+inline void b64_encode(const secure_string& ptext, secure_string& etext)
+{
+  EVP_ENCODE_CTX_free_ptr ctx(EVP_ENCODE_CTX_new(), ::EVP_ENCODE_CTX_free);
+  EVP_EncodeInit(ctx.get());
+
+  // 4 output chars per 3 input bytes, plus a newline every 64 chars
+  int rc;
+  etext.resize(ptext.size() / 3 * 4 + ptext.size() / 48 + AES_BLOCK_SIZE);
+  int out_len1 = (int) etext.size();
+  rc = EVP_EncodeUpdate(ctx.get(), (byte *) &etext[0], &out_len1,
+			(const byte *) &ptext[0], (int) ptext.size());
+  if (rc != 1)
+    throw std::runtime_error("EVP_EncodeUpdate failed");
+
+  int out_len2 = (int) etext.size() - out_len1;
+  EVP_EncodeFinal(ctx.get(), (byte *) &etext[0] + out_len1, &out_len2);
+
+  etext.resize(out_len1 + out_len2);
+}
+
+inline void b64_decode(const secure_string& etext, secure_string& dtext)
+{
+  EVP_ENCODE_CTX_free_ptr ctx(EVP_ENCODE_CTX_new(), ::EVP_ENCODE_CTX_free);
+  EVP_DecodeInit(ctx.get());
+
+  int rc;
+  dtext.resize(etext.size() + AES_BLOCK_SIZE);
+  int out_len1 = (int) dtext.size();
+  rc = EVP_DecodeUpdate(ctx.get(), (byte *) &dtext[0], &out_len1,
+			(const byte *) &etext[0], (int) etext.size());
+  if (rc == -1)
+    throw std::runtime_error("EVP_DecodeUpdate failed");
+
+  int out_len2 = (int) dtext.size() - out_len1;
+  EVP_DecodeFinal(ctx.get(), (byte *) &dtext[0] + out_len1, &out_len2);
+
+  dtext.resize(out_len1 + out_len2);
+}
+
+// bytes handed to OpenSSL per update call, which takes an int length
+#define AES_UPDATE_CHUNK (1ul << 30)
+
+// ciphertext length for size bytes of plaintext: the next whole block with padding, which
+// always adds at least one byte, or size itself without
+inline size_t aes_encrypted_size(size_t size, bool pad = true)
+{
+  return pad ? (size / AES_BLOCK_SIZE + 1) * AES_BLOCK_SIZE : size;
+}
+
+// AES-128-ECB encrypt ptext into ctext and return the ciphertext length. ctext must hold
+// aes_encrypted_size(ptext.size(), pad) bytes and may start at ptext to encrypt in place.
+// Without padding ptext must be a whole number of blocks.
+inline size_t aes_encrypt(const byte key[AES_KEY_SIZE], ByteSpan ptext, MutableByteSpan ctext, bool pad = true)
+{
+  if (ctext.size() < aes_encrypted_size(ptext.size(), pad)) {
+    throw std::length_error("ciphertext buffer is too small");
+  }
+  if (!pad && ptext.size() % AES_BLOCK_SIZE != 0) {
+    throw std::invalid_argument("unpadded plaintext must be a whole number of blocks");
+  }
+
+  thread_local EVP_CIPHER_CTX_free_ptr ctx(EVP_CIPHER_CTX_new(), ::EVP_CIPHER_CTX_free);
+  if (EVP_EncryptInit_ex(ctx.get(), EVP_aes_128_ecb(), NULL, key, NULL) != 1)
+    throw std::runtime_error("EVP_EncryptInit_ex failed");
+  EVP_CIPHER_CTX_set_padding(ctx.get(), pad);
+
+  // ECB holds back no partial block between whole-block chunks, so out never passes in
+  size_t out_len = 0;
+  for (size_t i = 0; i < ptext.size(); i += AES_UPDATE_CHUNK) {
+    int chunk_len = std::min(AES_UPDATE_CHUNK, ptext.size() - i);
+    int n = 0;
+    if (EVP_EncryptUpdate(ctx.get(), ctext.data() + out_len, &n, ptext.data() + i, chunk_len) != 1)
+      throw std::runtime_error("EVP_EncryptUpdate failed");
+    out_len += n;
+  }
+
+  int n = 0;
+  if (EVP_EncryptFinal_ex(ctx.get(), ctext.data() + out_len, &n) != 1)
+    throw std::runtime_error("EVP_EncryptFinal_ex failed");
+  return out_len + n;
+}
+
+// AES-128-ECB decrypt ctext into rtext and return the recovered length. rtext must hold
+// ctext.size() bytes and may start at ctext to decrypt in place. Without padding nothing is
+// checked or stripped from the last block.
+inline size_t aes_decrypt(const byte key[AES_KEY_SIZE], ByteSpan ctext, MutableByteSpan rtext, bool pad = true)
+{
+  if (rtext.size() < ctext.size()) {
+    throw std::length_error("recovered text buffer is too small");
+  }
+  if (ctext.size() % AES_BLOCK_SIZE != 0) {
+    throw std::invalid_argument("ciphertext must be a whole number of blocks");
+  }
+
+  thread_local EVP_CIPHER_CTX_free_ptr ctx(EVP_CIPHER_CTX_new(), ::EVP_CIPHER_CTX_free);
+  if (EVP_DecryptInit_ex(ctx.get(), EVP_aes_128_ecb(), NULL, key, NULL) != 1)
+    throw std::runtime_error("EVP_DecryptInit_ex failed");
+  EVP_CIPHER_CTX_set_padding(ctx.get(), pad);
+
+  // with padding the last block is held back until the final call, so out trails in by at
+  // most a block and never overwrites ciphertext not yet read
+  size_t out_len = 0;
+  for (size_t i = 0; i < ctext.size(); i += AES_UPDATE_CHUNK) {
+    int chunk_len = std::min(AES_UPDATE_CHUNK, ctext.size() - i);
+    int n = 0;
+    if (EVP_DecryptUpdate(ctx.get(), rtext.data() + out_len, &n, ctext.data() + i, chunk_len) != 1)
+      throw std::runtime_error("EVP_DecryptUpdate failed");
+    out_len += n;
+  }
+
+  int n = 0;
+  if (EVP_DecryptFinal_ex(ctx.get(), rtext.data() + out_len, &n) != 1)
+    throw std::runtime_error("EVP_DecryptFinal_ex failed");
+  return out_len + n;
+}
+
+inline void aes_encrypt(const byte key[AES_KEY_SIZE], const secure_string& ptext, secure_string& ctext,
+			bool pad = true)
+{
+  ctext.resize(aes_encrypted_size(ptext.size(), pad));
+  size_t size = aes_encrypt(key, ByteSpan((const byte*) ptext.data(), ptext.size()),
+			    MutableByteSpan((byte*) &ctext[0], ctext.size()), pad);
+  ctext.resize(size);
+}
+
+inline void aes_decrypt(const byte key[AES_KEY_SIZE], const secure_string& ctext, secure_string& rtext,
+			bool pad = true)
+{
+  rtext.resize(ctext.size());
+  size_t size = aes_decrypt(key, ByteSpan((const byte*) ctext.data(), ctext.size()),
+			    MutableByteSpan((byte*) &rtext[0], rtext.size()), pad);
+  rtext.resize(size);
+}
+
+#endif
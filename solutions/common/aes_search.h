@@ -0,0 +1,128 @@
+#ifndef CRYPTOPALS_AES_SEARCH_H
+#define CRYPTOPALS_AES_SEARCH_H
+
+#include <cstring>
+#include <stdexcept>
+
+#include <openssl/evp.h>
+
+// the AES-NI search is compiled on x86 whatever the -m flags, through target attributes, and
+// chosen at run time when the CPU has AES-NI; elsewhere only the OpenSSL search is built.
+// __AES__ alone would drop it from builds without -maes, which the runtime check covers.
+#if defined(__x86_64__) || defined(__i386__)
+#define AES_SEARCH_NI 1
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+#endif
+
+#include "aes.h"
+#include "blocks.h"
+#include "bytes.h"
+
+// keys tested per call of aes128_match_keys
+#define AES_SEARCH_LANES 8
+
+#ifdef AES_SEARCH_NI
+
+// the AES-NI version expands each key one round ahead of the encryption, so no key schedule
+// is stored, and runs the AES_SEARCH_LANES keys side by side so their aesenc instructions
+// overlap in the pipeline instead of waiting on each other's latency
+#define AES_SEARCH_ROUND(rcon)						\
+  _Pragma("GCC unroll 8")						\
+  for (int i = 0; i < AES_SEARCH_LANES; i++) {				\
+    round_keys[i] = aes128_expand_step(round_keys[i], rcon);		\
+    states[i] = _mm_aesenc_si128(states[i], round_keys[i]);		\
+  }
+
+// next AES-128 round key from the previous one. SubWord(RotWord()) of the last word comes
+// from aesenclast on that word rotated into every column (its ShiftRows is undone by the
+// shuffle), which issues every cycle where aeskeygenassist takes several.
+__attribute__((target("aes,ssse3")))
+inline __m128i aes128_expand_step(__m128i key, int rcon)
+{
+  __m128i rotated = _mm_shuffle_epi8(key, _mm_set1_epi32(0x0c0f0e0d));
+  __m128i assist = _mm_aesenclast_si128(rotated, _mm_set1_epi32(rcon));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  return _mm_xor_si128(key, assist);
+}
+
+__attribute__((target("aes,ssse3")))
+inline unsigned aes128_match_keys_ni(const byte keys[AES_SEARCH_LANES][AES_KEY_SIZE],
+				     const byte plaintext[AES_BLOCK_SIZE], const byte expected[AES_BLOCK_SIZE])
+{
+  __m128i block = _mm_loadu_si128((const __m128i*) plaintext);
+  __m128i round_keys[AES_SEARCH_LANES];
+  __m128i states[AES_SEARCH_LANES];
+#pragma GCC unroll 8
+  for (int i = 0; i < AES_SEARCH_LANES; i++) {
+    round_keys[i] = _mm_loadu_si128((const __m128i*) keys[i]);
+    states[i] = _mm_xor_si128(block, round_keys[i]);
+  }
+
+  // rounds 1 to 9, then the last round without MixColumns
+  AES_SEARCH_ROUND(0x01);
+  AES_SEARCH_ROUND(0x02);
+  AES_SEARCH_ROUND(0x04);
+  AES_SEARCH_ROUND(0x08);
+  AES_SEARCH_ROUND(0x10);
+  AES_SEARCH_ROUND(0x20);
+  AES_SEARCH_ROUND(0x40);
+  AES_SEARCH_ROUND(0x80);
+  AES_SEARCH_ROUND(0x1b);
+
+  __m128i target = _mm_loadu_si128((const __m128i*) expected);
+  unsigned matches = 0;
+#pragma GCC unroll 8
+  for (int i = 0; i < AES_SEARCH_LANES; i++) {
+    round_keys[i] = aes128_expand_step(round_keys[i], 0x36);
+    states[i] = _mm_aesenclast_si128(states[i], round_keys[i]);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(states[i], target)) == 0xffff) {
+      matches |= 1u << i;
+    }
+  }
+  return matches;
+}
+
+#undef AES_SEARCH_ROUND
+
+#endif
+
+// the same test through OpenSSL, one key at a time, for CPUs without AES-NI
+inline unsigned aes128_match_keys_evp(const byte keys[AES_SEARCH_LANES][AES_KEY_SIZE],
+				      const byte plaintext[AES_BLOCK_SIZE], const byte expected[AES_BLOCK_SIZE])
+{
+  thread_local EVP_CIPHER_CTX_free_ptr ctx(EVP_CIPHER_CTX_new(), ::EVP_CIPHER_CTX_free);
+  unsigned matches = 0;
+  for (int i = 0; i < AES_SEARCH_LANES; i++) {
+    if (EVP_EncryptInit_ex(ctx.get(), EVP_aes_128_ecb(), NULL, keys[i], NULL) != 1)
+      throw std::runtime_error("EVP_EncryptInit_ex failed");
+    EVP_CIPHER_CTX_set_padding(ctx.get(), 0);
+
+    byte ciphertext[AES_BLOCK_SIZE];
+    int out_len = 0;
+    if (EVP_EncryptUpdate(ctx.get(), ciphertext, &out_len, plaintext, AES_BLOCK_SIZE) != 1)
+      throw std::runtime_error("EVP_EncryptUpdate failed");
+    if (memcmp(ciphertext, expected, AES_BLOCK_SIZE) == 0) {
+      matches |= 1u << i;
+    }
+  }
+  return matches;
+}
+
+// encrypt one known plaintext block under AES_SEARCH_LANES AES-128 keys and return a mask with
+// bit i set when keys[i] gives the expected ciphertext block
+inline unsigned aes128_match_keys(const byte keys[AES_SEARCH_LANES][AES_KEY_SIZE],
+				  const byte plaintext[AES_BLOCK_SIZE], const byte expected[AES_BLOCK_SIZE])
+{
+#ifdef AES_SEARCH_NI
+  static const bool aesni = __builtin_cpu_supports("aes") && __builtin_cpu_supports("ssse3");
+  if (aesni) {
+    return aes128_match_keys_ni(keys, plaintext, expected);
+  }
+#endif
+  return aes128_match_keys_evp(keys, plaintext, expected);
+}
+
+#endif
@@ -0,0 +1,165 @@
+#ifndef CRYPTOPALS_BATCH_H
+#define CRYPTOPALS_BATCH_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include "bytes.h"
+#include "instrument.h"
+#include "ngram.h"
+
+// ciphertexts cracked together, one per lane
+#define BATCH_LANES 32
+// keys per lane that survive the counting sweep and are rescored with the n-gram model
+#define BATCH_CANDIDATES 4
+// weight of an unprintable byte against a letter or space
+#define BATCH_UNPRINTABLE_PENALTY 4
+// longest ciphertext a lane holds, so lengths and counts fit in 16 bits
+#define BATCH_MAX_LENGTH UINT16_MAX
+
+// best single byte key found for one lane of a batch
+struct BatchResult {
+  byte key;
+  double score;
+};
+
+// cracks up to BATCH_LANES single byte xor ciphertexts at once. The ciphertexts are stored
+// transposed, byte j of every lane next to each other, so each step of the sweep over the
+// 256 keys applies the same byte operations to all lanes and compiles to vector code.
+class SingleByteXorBatch {
+public:
+  SingleByteXorBatch() : num_lanes(0), max_length(0) {
+    std::fill(lengths, lengths + BATCH_LANES, 0);
+  }
+
+  size_t size() const { return num_lanes; }
+  bool full() const { return num_lanes == BATCH_LANES; }
+
+  // add a ciphertext to the next free lane
+  void add(ByteSpan ciphertext) {
+    if (full()) {
+      throw std::length_error("batch is full");
+    }
+    if (ciphertext.size() > BATCH_MAX_LENGTH) {
+      throw std::invalid_argument("ciphertext is too long for a batch");
+    }
+
+    if (ciphertext.size() > max_length) {
+      columns.resize(ciphertext.size() * BATCH_LANES);
+      max_length = ciphertext.size();
+    }
+    for (size_t j = 0; j < ciphertext.size(); j++) {
+      columns[j * BATCH_LANES + num_lanes] = ciphertext[j];
+    }
+    lengths[num_lanes++] = ciphertext.size();
+  }
+
+  void clear() {
+    num_lanes = 0;
+    max_length = 0;
+    std::fill(lengths, lengths + BATCH_LANES, 0);
+    columns.clear();
+  }
+
+  // find the best key for every lane
+  std::vector<BatchResult> crack() const;
+
+  // decrypt one lane under key into out
+  void decrypt(size_t lane, byte key, Bytes& out) const {
+    out.resize(lengths[lane]);
+    for (size_t j = 0; j < lengths[lane]; j++) {
+      out[j] = columns[j * BATCH_LANES + lane] ^ key;
+    }
+  }
+
+private:
+  // letters and spaces count for a key, unprintable bytes against it
+  static byte is_plausible(byte p) {
+    return ((byte) ((p | 0x20) - 'a') < 26) | (p == ' ');
+  }
+  static byte is_unprintable(byte p) {
+    return ((p < ' ') & (p != '\n') & (p != '\r') & (p != '\t')) | (p >= 0x7f);
+  }
+
+  // ciphertext byte j of lane i at columns[j * BATCH_LANES + i]; bytes past a lane's end are 0
+  Bytes columns;
+  uint16_t lengths[BATCH_LANES];
+  size_t num_lanes;
+  size_t max_length;
+};
+
+inline std::vector<BatchResult> SingleByteXorBatch::crack() const
+{
+  INSTRUMENT_STAGE("key_search");
+  INSTRUMENT_COUNT("keys_tried", 256 * num_lanes);
+
+  // best BATCH_CANDIDATES keys per lane by counter score, kept sorted best first
+  int32_t candidate_scores[BATCH_LANES][BATCH_CANDIDATES];
+  byte candidate_keys[BATCH_LANES][BATCH_CANDIDATES];
+  for (size_t lane = 0; lane < BATCH_LANES; lane++) {
+    std::fill(candidate_scores[lane], candidate_scores[lane] + BATCH_CANDIDATES, INT32_MIN);
+    std::fill(candidate_keys[lane], candidate_keys[lane] + BATCH_CANDIDATES, 0);
+  }
+
+  for (unsigned key = 0; key < 256; key++) {
+    // every lane's counters for this key are updated together, one ciphertext byte position at a time
+    uint16_t plausible[BATCH_LANES] = {0};
+    uint16_t unprintable[BATCH_LANES] = {0};
+    for (size_t j = 0; j < max_length; j++) {
+      const byte* row = columns.data() + j * BATCH_LANES;
+      for (size_t lane = 0; lane < BATCH_LANES; lane++) {
+	byte p = row[lane] ^ key;
+	plausible[lane] += is_plausible(p);
+	unprintable[lane] += is_unprintable(p);
+      }
+    }
+
+    // bytes past the end of a lane are 0, so they decrypted to the key itself; taking them
+    // back out afterwards keeps a length check out of the loop above
+    int32_t pad_plausible = is_plausible(key);
+    int32_t pad_unprintable = is_unprintable(key);
+    for (size_t lane = 0; lane < num_lanes; lane++) {
+      int32_t padding = max_length - lengths[lane];
+      int32_t score = (int32_t) plausible[lane] - padding * pad_plausible
+	- BATCH_UNPRINTABLE_PENALTY * ((int32_t) unprintable[lane] - padding * pad_unprintable);
+      if (score <= candidate_scores[lane][BATCH_CANDIDATES - 1]) {
+	continue;
+      }
+      // insert into the short sorted candidate list
+      size_t i = BATCH_CANDIDATES - 1;
+      while (i > 0 && candidate_scores[lane][i - 1] < score) {
+	candidate_scores[lane][i] = candidate_scores[lane][i - 1];
+	candidate_keys[lane][i] = candidate_keys[lane][i - 1];
+	i--;
+      }
+      candidate_scores[lane][i] = score;
+      candidate_keys[lane][i] = key;
+    }
+  }
+  INSTRUMENT_COUNT("keys_pruned", (256 - BATCH_CANDIDATES) * num_lanes);
+
+  // the n-gram model decides between the surviving candidates
+  std::vector<BatchResult> results(num_lanes);
+  Bytes decrypted;
+  for (size_t lane = 0; lane < num_lanes; lane++) {
+    INSTRUMENT_STAGE("scoring");
+    results[lane].key = candidate_keys[lane][0];
+    results[lane].score = -INFINITY;
+    for (size_t i = 0; i < BATCH_CANDIDATES; i++) {
+      decrypt(lane, candidate_keys[lane][i], decrypted);
+      double score = ngram_score(decrypted);
+      if (score > results[lane].score) {
+	results[lane].key = candidate_keys[lane][i];
+	results[lane].score = score;
+      }
+    }
+  }
+
+  return results;
+}
+
+#endif
@@ -0,0 +1,568 @@
+#ifndef CRYPTOPALS_BLOCK_INDEX_H
+#define CRYPTOPALS_BLOCK_INDEX_H
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "blocks.h"
+#include "bytes.h"
+#include "instrument.h"
+
+// shards of the (block, line) pairs, chosen by the top bits of the block hash
+#define BLOCK_INDEX_SHARDS 64
+// pairs a thread collects for one shard before taking the shard's lock
+#define BLOCK_INDEX_STAGING 256
+// pairs read from a spill file at a time while grouping
+#define BLOCK_INDEX_READ_PAIRS 4096
+// bytes a group costs while being merged beyond its lines: the map node, the vector and
+// their allocations
+#define BLOCK_INDEX_GROUP_OVERHEAD 96
+// bloom filter bits per expected block, and bit positions tested per block
+#define BLOCK_INDEX_BLOOM_BITS 8
+#define BLOCK_INDEX_BLOOM_PROBES 4
+// hash bits that pick a probe's bit within its word; the bits above them pick the word
+#define BLOCK_INDEX_BLOOM_PROBE_BITS 6
+
+// a 16 byte block and a line it appears in
+struct BlockLine {
+  BLOCK block;
+  uint64_t line;
+};
+
+// lines that share blocks no other line has, and how many such blocks
+struct LineGroup {
+  std::vector<uint64_t> lines;
+  size_t shared_blocks;
+};
+
+// bloom filter that several threads can add to at once. All the probes of a hash fall in
+// one 64 bit word, so a single fetch_or sets them and tells whether they were all set
+// before: of two threads adding the same hash at once, exactly one sees it as new.
+class AtomicBloom {
+public:
+  // size_bits is rounded up to a power of two
+  explicit AtomicBloom(size_t size_bits);
+  // add hash and return true if it may have been added before
+  bool add(uint64_t hash);
+  bool contains(uint64_t hash) const;
+
+private:
+  std::atomic<uint64_t>& word(uint64_t hash) const;
+  static uint64_t probes(uint64_t hash);
+
+  std::unique_ptr<std::atomic<uint64_t>[]> words;
+  uint64_t mask;
+};
+
+// Index of the 16 byte blocks of every line in a corpus, to find lines encrypted under the
+// same ECB key that share plaintext blocks. It is built in two passes over the corpus, each
+// of which may run on any number of threads:
+//
+//   count()  adds each distinct block of a line to a bloom filter, and blocks already in it
+//            to a second filter of blocks seen in more than one line
+//   add()    keeps a (block, line) pair only for blocks in the second filter
+//
+// Only blocks that repeat, plus the filters' false positives, reach the shards. Each shard
+// holds its pairs in memory up to its share of the memory budget, then appends them to an
+// unlinked temporary file. groups() frees the filters and splits their half of the budget
+// into a share for each thread and one for the groups found:
+//
+//   gather   each thread takes one shard at a time, in as many passes over it as keep its
+//            pairs within the thread's share, and turns each block's lines into a group
+//            record; records past their share are spilled like the shards
+//   merge    each thread takes one pass over the records at a time, adding up the records
+//            of each set of lines whose hash falls in the pass, and offers the totals to a
+//            heap of the best top_k
+class BlockIndex {
+public:
+  // a thread's staging buffers for add(); pairs reach the shards when a buffer fills up
+  // and on flush()
+  class Writer {
+  public:
+    explicit Writer(BlockIndex& index) : index(index), staging(BLOCK_INDEX_SHARDS) {}
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+
+    // pass 2: note the line of each block of ciphertext that may be in another line
+    void add(uint64_t line, ByteSpan ciphertext);
+    // hand the rest of the staged pairs to the shards
+    void flush();
+
+  private:
+    BlockIndex& index;
+    std::vector<std::vector<BlockLine> > staging;
+    std::vector<BLOCK> blocks;
+  };
+
+  // size the filters for expected_blocks blocks and spill shards past memory_budget bytes
+  // into files under spill_dir
+  BlockIndex(size_t expected_blocks, size_t memory_budget, const std::string& spill_dir);
+  ~BlockIndex();
+  BlockIndex(const BlockIndex&) = delete;
+  BlockIndex& operator=(const BlockIndex&) = delete;
+
+  // pass 1: note the distinct blocks of one line; blocks is scratch space
+  void count(ByteSpan ciphertext, std::vector<BLOCK>& blocks);
+
+  // the top_k groups of lines that share blocks, most shared blocks first, gathered on
+  // num_threads; called once, after pass 2
+  std::vector<LineGroup> groups(unsigned num_threads, size_t top_k);
+
+  // pairs kept in pass 2, and bytes of them and of group records spilled to disk
+  size_t num_pairs() const { return pairs; }
+  size_t spilled_bytes() const;
+  // groups found by groups(), printed or not
+  size_t num_groups() const { return distinct_groups; }
+
+private:
+  struct Shard {
+    std::mutex mutex;
+    std::vector<BlockLine> pairs;
+    int spill_fd = -1;
+    size_t spilled = 0;
+  };
+
+  // groups gathered from the shards, each a record of words: the hash of its lines, the
+  // blocks they share, the number of lines and the lines
+  struct GroupRecords {
+    std::mutex mutex;
+    std::vector<uint64_t> words;
+    int spill_fd = -1;
+    size_t spilled = 0;
+    // bytes the records would take as merged groups, to size the merge passes
+    size_t merge_bytes = 0;
+  };
+
+  // move staged pairs into a shard, spilling it if it grows past its budget
+  void store(size_t shard, std::vector<BlockLine>& staged);
+  void spill(Shard& shard);
+  // the pairs of a shard, from its file and from memory, whose blocks fall in pass out of
+  // num_passes
+  std::vector<BlockLine> load(Shard& shard, size_t pass, size_t num_passes);
+  // add the groups of one gather pass to the records, spilling them past budget bytes
+  void store_groups(const std::map<std::vector<uint64_t>, size_t>& found, size_t budget);
+  // call fn with every group record, from the spill file and then from memory
+  template <typename Fn>
+  void read_groups(Fn fn);
+
+  // append size bytes to the spill file fd, creating it first if fd is -1
+  void write_spill(int& fd, const void* data, size_t size);
+  static void read_spill(int fd, void* data, size_t size, size_t offset);
+
+  AtomicBloom seen;
+  AtomicBloom repeated;
+  std::string spill_dir;
+  size_t filter_budget;
+  size_t shard_budget;
+  Shard shards[BLOCK_INDEX_SHARDS];
+  GroupRecords group_records;
+  std::atomic<size_t> pairs{0};
+  size_t distinct_groups = 0;
+};
+
+// sorted distinct blocks of ciphertext, into blocks
+inline void distinct_blocks(ByteSpan ciphertext, std::vector<BLOCK>& blocks)
+{
+  size_t num_blocks = ciphertext.size() / AES_BLOCK_SIZE;
+  blocks.resize(num_blocks);
+  for (size_t i = 0; i < num_blocks; i++) {
+    memcpy(blocks[i].data(), ciphertext.data() + i * AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+  }
+  std::sort(blocks.begin(), blocks.end());
+  blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+}
+
+// hash of a group's lines, to split the groups between merge passes
+inline uint64_t lines_hash(const std::vector<uint64_t>& lines)
+{
+  uint64_t h = lines.size();
+  for (uint64_t line : lines) {
+    h = (h ^ line) * 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+  }
+  return h;
+}
+
+inline uint64_t block_hash(const BLOCK& block)
+{
+  // MurmurHash3's 64 bit finalizer over both halves
+  uint64_t h = block[0] ^ (block[1] * 0x9e3779b97f4a7c15ull);
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdull;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ull;
+  h ^= h >> 33;
+  return h;
+}
+
+inline AtomicBloom::AtomicBloom(size_t size_bits)
+{
+  size_t num_words = 1;
+  while (num_words * 64 < size_bits) {
+    num_words *= 2;
+  }
+  words.reset(new std::atomic<uint64_t>[num_words]);
+  for (size_t i = 0; i < num_words; i++) {
+    words[i].store(0, std::memory_order_relaxed);
+  }
+  mask = num_words - 1;
+}
+
+inline std::atomic<uint64_t>& AtomicBloom::word(uint64_t hash) const
+{
+  return words[(hash >> (BLOCK_INDEX_BLOOM_PROBES * BLOCK_INDEX_BLOOM_PROBE_BITS)) & mask];
+}
+
+inline uint64_t AtomicBloom::probes(uint64_t hash)
+{
+  uint64_t flags = 0;
+  for (int i = 0; i < BLOCK_INDEX_BLOOM_PROBES; i++) {
+    flags |= 1ull << ((hash >> (i * BLOCK_INDEX_BLOOM_PROBE_BITS)) & 63);
+  }
+  return flags;
+}
+
+inline bool AtomicBloom::add(uint64_t hash)
+{
+  uint64_t flags = probes(hash);
+  std::atomic<uint64_t>& w = word(hash);
+  // most blocks are already in a filter that sees them twice, so look before writing
+  if ((w.load(std::memory_order_relaxed) & flags) == flags) {
+    return true;
+  }
+  return (w.fetch_or(flags, std::memory_order_relaxed) & flags) == flags;
+}
+
+inline bool AtomicBloom::contains(uint64_t hash) const
+{
+  uint64_t flags = probes(hash);
+  return (word(hash).load(std::memory_order_relaxed) & flags) == flags;
+}
+
+inline BlockIndex::BlockIndex(size_t expected_blocks, size_t memory_budget, const std::string& spill_dir)
+  // the two filters take at most half the budget and the shards the rest
+  : seen(std::min(expected_blocks * BLOCK_INDEX_BLOOM_BITS, memory_budget * 8 / 4)),
+    repeated(std::min(expected_blocks * BLOCK_INDEX_BLOOM_BITS, memory_budget * 8 / 4)),
+    spill_dir(spill_dir), filter_budget(memory_budget / 2),
+    shard_budget(std::max<size_t>(memory_budget / 2 / BLOCK_INDEX_SHARDS, sizeof(BlockLine)))
+{
+}
+
+inline BlockIndex::~BlockIndex()
+{
+  for (auto& shard : shards) {
+    if (shard.spill_fd != -1) {
+      close(shard.spill_fd);
+    }
+  }
+  if (group_records.spill_fd != -1) {
+    close(group_records.spill_fd);
+  }
+}
+
+inline void BlockIndex::count(ByteSpan ciphertext, std::vector<BLOCK>& blocks)
+{
+  // blocks repeated within the line are the single line detector's business
+  distinct_blocks(ciphertext, blocks);
+  for (auto& block : blocks) {
+    uint64_t hash = block_hash(block);
+    if (seen.add(hash)) {
+      repeated.add(hash);
+    }
+  }
+  INSTRUMENT_COUNT("blocks_indexed", blocks.size());
+}
+
+inline void BlockIndex::Writer::flush()
+{
+  for (size_t s = 0; s < staging.size(); s++) {
+    if (!staging[s].empty()) {
+      index.store(s, staging[s]);
+    }
+  }
+}
+
+inline void BlockIndex::Writer::add(uint64_t line, ByteSpan ciphertext)
+{
+  distinct_blocks(ciphertext, blocks);
+  for (auto& block : blocks) {
+    uint64_t hash = block_hash(block);
+    if (!index.repeated.contains(hash)) {
+      continue;
+    }
+    size_t s = hash >> 58;
+    staging[s].push_back({block, line});
+    if (staging[s].size() >= BLOCK_INDEX_STAGING) {
+      index.store(s, staging[s]);
+    }
+  }
+}
+
+inline void BlockIndex::store(size_t s, std::vector<BlockLine>& staged)
+{
+  static_assert(BLOCK_INDEX_SHARDS == 64, "shards are picked by the top 6 bits of the hash");
+  Shard& shard = shards[s];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.pairs.insert(shard.pairs.end(), staged.begin(), staged.end());
+  pairs += staged.size();
+  staged.clear();
+  if (shard.pairs.size() * sizeof(BlockLine) >= shard_budget) {
+    spill(shard);
+  }
+}
+
+inline void BlockIndex::spill(Shard& shard)
+{
+  size_t size = shard.pairs.size() * sizeof(BlockLine);
+  write_spill(shard.spill_fd, shard.pairs.data(), size);
+  shard.spilled += size;
+  shard.pairs.clear();
+  shard.pairs.shrink_to_fit();
+}
+
+inline void BlockIndex::write_spill(int& fd, const void* data, size_t size)
+{
+  if (fd == -1) {
+    // unlinked at once, so the file goes away with the process however it ends
+    std::string name = spill_dir + "/blockindex.XXXXXX";
+    fd = mkstemp(&name[0]);
+    if (fd == -1) {
+      throw std::runtime_error("unable to create spill file in " + spill_dir);
+    }
+    unlink(name.c_str());
+  }
+
+  size_t written = 0;
+  while (written < size) {
+    ssize_t n = write(fd, (const char*) data + written, size - written);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      throw std::runtime_error(std::string("unable to write spill file: ") + strerror(errno));
+    }
+    written += n;
+  }
+  INSTRUMENT_COUNT("bytes_spilled", size);
+}
+
+inline void BlockIndex::read_spill(int fd, void* data, size_t size, size_t offset)
+{
+  size_t done = 0;
+  while (done < size) {
+    ssize_t n = pread(fd, (char*) data + done, size - done, offset + done);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      throw std::runtime_error("unable to read spill file");
+    }
+    done += n;
+  }
+}
+
+inline std::vector<BlockLine> BlockIndex::load(Shard& shard, size_t pass, size_t num_passes)
+{
+  // every pair of a block lands in the same pass
+  auto in_pass = [&](const BlockLine& pair) {
+    return num_passes == 1 || (block_hash(pair.block) >> 26) % num_passes == pass;
+  };
+
+  std::vector<BlockLine> selected;
+  std::vector<BlockLine> chunk(BLOCK_INDEX_READ_PAIRS);
+  for (size_t offset = 0; offset < shard.spilled; ) {
+    size_t size = std::min(chunk.size() * sizeof(BlockLine), shard.spilled - offset);
+    read_spill(shard.spill_fd, chunk.data(), size, offset);
+    std::copy_if(chunk.begin(), chunk.begin() + size / sizeof(BlockLine), std::back_inserter(selected), in_pass);
+    offset += size;
+  }
+  std::copy_if(shard.pairs.begin(), shard.pairs.end(), std::back_inserter(selected), in_pass);
+  return selected;
+}
+
+inline void BlockIndex::store_groups(const std::map<std::vector<uint64_t>, size_t>& found, size_t budget)
+{
+  std::vector<uint64_t> records;
+  size_t merge_bytes = 0;
+  for (auto& group : found) {
+    records.push_back(lines_hash(group.first));
+    records.push_back(group.second);
+    records.push_back(group.first.size());
+    records.insert(records.end(), group.first.begin(), group.first.end());
+    merge_bytes += group.first.size() * sizeof(uint64_t) + BLOCK_INDEX_GROUP_OVERHEAD;
+  }
+
+  std::lock_guard<std::mutex> lock(group_records.mutex);
+  group_records.words.insert(group_records.words.end(), records.begin(), records.end());
+  group_records.merge_bytes += merge_bytes;
+  size_t size = group_records.words.size() * sizeof(uint64_t);
+  if (size >= budget) {
+    write_spill(group_records.spill_fd, group_records.words.data(), size);
+    group_records.spilled += size;
+    group_records.words.clear();
+    group_records.words.shrink_to_fit();
+  }
+}
+
+template <typename Fn>
+inline void BlockIndex::read_groups(Fn fn)
+{
+  // calls fn with each whole record in words and returns how many words they took
+  auto each_record = [&](const uint64_t* words, size_t num_words) {
+    size_t i = 0;
+    while (num_words - i >= 3 && num_words - i - 3 >= words[i + 2]) {
+      fn(words + i);
+      i += 3 + words[i + 2];
+    }
+    return i;
+  };
+
+  // records may cross chunks, so the unread end of one chunk is kept for the next
+  std::vector<uint64_t> buffer;
+  for (size_t offset = 0; offset < group_records.spilled; ) {
+    size_t size = std::min(BLOCK_INDEX_READ_PAIRS * sizeof(BlockLine), group_records.spilled - offset);
+    size_t kept = buffer.size();
+    buffer.resize(kept + size / sizeof(uint64_t));
+    read_spill(group_records.spill_fd, buffer.data() + kept, size, offset);
+    offset += size;
+    buffer.erase(buffer.begin(), buffer.begin() + each_record(buffer.data(), buffer.size()));
+  }
+  if (!buffer.empty()) {
+    throw std::runtime_error("spill file ends inside a group record");
+  }
+  each_record(group_records.words.data(), group_records.words.size());
+}
+
+inline size_t BlockIndex::spilled_bytes() const
+{
+  size_t total = 0;
+  for (auto& shard : shards) {
+    total += shard.spilled;
+  }
+  return total + group_records.spilled;
+}
+
+inline std::vector<LineGroup> BlockIndex::groups(unsigned num_threads, size_t top_k)
+{
+  // the filters are done with once pass 2 has ended, and their memory goes to the passes and
+  // the group records
+  seen = AtomicBloom(0);
+  repeated = AtomicBloom(0);
+  size_t share = std::max<size_t>(filter_budget / (num_threads + 1), sizeof(BlockLine));
+
+  auto run_workers = [num_threads](const std::function<void()>& worker) {
+    std::vector<std::thread> workers;
+    for (unsigned i = 1; i < num_threads; i++) {
+      workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& t : workers) {
+      t.join();
+    }
+  };
+
+  // gather: lines sharing a block -> number of blocks they share, per pass over a shard
+  std::atomic<size_t> next_shard{0};
+  run_workers([&] {
+    INSTRUMENT_STAGE("group");
+    size_t s;
+    while ((s = next_shard.fetch_add(1)) < BLOCK_INDEX_SHARDS) {
+      Shard& shard = shards[s];
+      size_t shard_bytes = shard.spilled + shard.pairs.size() * sizeof(BlockLine);
+      size_t num_passes = std::max<size_t>(1, (shard_bytes + share - 1) / share);
+      INSTRUMENT_COUNT("group_passes", num_passes);
+
+      for (size_t pass = 0; pass < num_passes; pass++) {
+	std::vector<BlockLine> all = load(shard, pass, num_passes);
+	std::sort(all.begin(), all.end(), [](const BlockLine& p1, const BlockLine& p2) {
+	  return p1.block != p2.block ? p1.block < p2.block : p1.line < p2.line;
+	});
+
+	// a run of one block lists its lines in order, once each since count() and add()
+	// saw each line's distinct blocks
+	std::map<std::vector<uint64_t>, size_t> found;
+	for (size_t begin = 0, end; begin < all.size(); begin = end) {
+	  end = begin + 1;
+	  while (end < all.size() && all[end].block == all[begin].block) {
+	    end++;
+	  }
+	  if (end - begin < 2) {
+	    continue;
+	  }
+	  std::vector<uint64_t> lines;
+	  for (size_t i = begin; i < end; i++) {
+	    lines.push_back(all[i].line);
+	  }
+	  found[std::move(lines)]++;
+	}
+	store_groups(found, share);
+      }
+      // the shard is done with, and its memory goes to the merge
+      shard.pairs.clear();
+      shard.pairs.shrink_to_fit();
+    }
+  });
+
+  // merge: one set of lines at a time adds up its records from every shard and pass
+  // most shared blocks first, then by lines; the heap keeps the worst of the best top_k on top
+  auto better = [](const LineGroup& g1, const LineGroup& g2) {
+    return g1.shared_blocks != g2.shared_blocks ? g1.shared_blocks > g2.shared_blocks : g1.lines < g2.lines;
+  };
+  std::priority_queue<LineGroup, std::vector<LineGroup>, decltype(better)> top(better);
+  std::mutex top_mutex;
+  size_t num_passes = std::max<size_t>(1, (group_records.merge_bytes + share - 1) / share);
+  INSTRUMENT_COUNT("merge_passes", num_passes);
+  std::atomic<size_t> next_pass{0};
+  distinct_groups = 0;
+  run_workers([&] {
+    INSTRUMENT_STAGE("merge");
+    size_t pass;
+    while ((pass = next_pass.fetch_add(1)) < num_passes) {
+      std::map<std::vector<uint64_t>, size_t> merged;
+      read_groups([&](const uint64_t* record) {
+	if (record[0] % num_passes == pass) {
+	  merged[std::vector<uint64_t>(record + 3, record + 3 + record[2])] += record[1];
+	}
+      });
+
+      std::lock_guard<std::mutex> lock(top_mutex);
+      distinct_groups += merged.size();
+      for (auto& group : merged) {
+	if (top.size() < top_k) {
+	  top.push({group.first, group.second});
+	} else if (top_k > 0 && group.second >= top.top().shared_blocks) {
+	  LineGroup candidate = {group.first, group.second};
+	  if (better(candidate, top.top())) {
+	    top.pop();
+	    top.push(std::move(candidate));
+	  }
+	}
+      }
+    }
+  });
+
+  std::vector<LineGroup> result(top.size());
+  for (size_t i = result.size(); i > 0; i--) {
+    result[i - 1] = top.top();
+    top.pop();
+  }
+  return result;
+}
+
+#endif
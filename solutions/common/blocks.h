@@ -0,0 +1,68 @@
+#ifndef CRYPTOPALS_BLOCKS_H
+#define CRYPTOPALS_BLOCKS_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include "bytes.h"
+
+#define AES_BLOCK_SIZE 16
+
+typedef std::array<uint64_t, 2> BLOCK;
+
+// count the 16 byte blocks that repeat an earlier block; blocks is scratch space
+// that callers can reuse across calls to avoid reallocating
+inline unsigned count_duplicate_blocks(ByteSpan bytes, std::vector<BLOCK> &blocks)
+{
+  size_t num_blocks = bytes.size() / AES_BLOCK_SIZE;
+  blocks.resize(num_blocks);
+  for (size_t i = 0; i < num_blocks; i++) {
+    memcpy(blocks[i].data(), bytes.data() + i * AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+  }
+
+  // sorting groups equal blocks together without a per-line set
+  std::sort(blocks.begin(), blocks.end());
+  unsigned duplicates = 0;
+  for (size_t i = 1; i < num_blocks; i++) {
+    if (blocks[i] == blocks[i - 1]) {
+      duplicates++;
+    }
+  }
+
+  return duplicates;
+}
+
+// append PKCS#7 padding so text is a whole number of blocks
+inline void pkcs7_pad(Bytes& text, size_t block_size)
+{
+  if (block_size == 0 || block_size > 255) {
+    throw std::invalid_argument("block size must be between 1 and 255");
+  }
+
+  size_t num_missing_bytes = block_size - (text.size() % block_size);
+  text.reserve(text.size() + num_missing_bytes);
+  for (size_t i = 0; i < num_missing_bytes; i++) {
+    text.push_back((byte) num_missing_bytes);
+  }
+}
+
+// return true if the block ends with valid PKCS#7 padding
+inline bool valid_pkcs7(const byte* block, size_t block_size)
+{
+  byte num_padding_bytes = block[block_size - 1];
+  if (num_padding_bytes == 0 || num_padding_bytes > block_size)
+    return false;
+
+  for (size_t i = block_size - num_padding_bytes; i < block_size; i++) {
+    if (block[i] != num_padding_bytes)
+      return false;
+  }
+
+  return true;
+}
+
+#endif
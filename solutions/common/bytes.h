@@ -0,0 +1,185 @@
+#ifndef CRYPTOPALS_BYTES_H
+#define CRYPTOPALS_BYTES_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// allocations are cache line aligned so whole buffers can be walked with wide loads
+#define BYTES_ALIGNMENT 64
+
+typedef unsigned char byte;
+
+// non-owning, read-only view of contiguous bytes
+class ByteSpan {
+public:
+  ByteSpan() : ptr(nullptr), len(0) {}
+  ByteSpan(const byte* data, size_t size) : ptr(data), len(size) {}
+  ByteSpan(std::string_view str) : ptr((const byte*) str.data()), len(str.size()) {}
+  ByteSpan(const std::string& str) : ptr((const byte*) str.data()), len(str.size()) {}
+  ByteSpan(const char* str) : ByteSpan(std::string_view(str)) {}
+
+  const byte* data() const { return ptr; }
+  size_t size() const { return len; }
+  bool empty() const { return len == 0; }
+  const byte& operator[](size_t i) const { return ptr[i]; }
+  const byte* begin() const { return ptr; }
+  const byte* end() const { return ptr + len; }
+
+  // view of size bytes starting at offset, clamped to the end of this view
+  ByteSpan subspan(size_t offset, size_t size = std::string_view::npos) const {
+    if (offset > len)
+      throw std::out_of_range("subspan offset past end");
+    return ByteSpan(ptr + offset, std::min(size, len - offset));
+  }
+
+  std::string_view to_string_view() const { return std::string_view((const char*) ptr, len); }
+
+private:
+  const byte* ptr;
+  size_t len;
+};
+
+// non-owning, writable view of contiguous bytes
+class MutableByteSpan {
+public:
+  MutableByteSpan() : ptr(nullptr), len(0) {}
+  MutableByteSpan(byte* data, size_t size) : ptr(data), len(size) {}
+
+  byte* data() const { return ptr; }
+  size_t size() const { return len; }
+  bool empty() const { return len == 0; }
+  byte& operator[](size_t i) const { return ptr[i]; }
+  byte* begin() const { return ptr; }
+  byte* end() const { return ptr + len; }
+
+  MutableByteSpan subspan(size_t offset, size_t size = std::string_view::npos) const {
+    if (offset > len)
+      throw std::out_of_range("subspan offset past end");
+    return MutableByteSpan(ptr + offset, std::min(size, len - offset));
+  }
+
+  operator ByteSpan() const { return ByteSpan(ptr, len); }
+
+private:
+  byte* ptr;
+  size_t len;
+};
+
+// owning, contiguous, aligned byte buffer; move-only so copies have to be asked for with clone()
+class Bytes {
+public:
+  Bytes() : buf(nullptr), len(0), cap(0) {}
+  explicit Bytes(size_t size) : Bytes() { resize(size); }
+  explicit Bytes(ByteSpan span) : Bytes() { append(span); }
+
+  Bytes(const Bytes&) = delete;
+  Bytes& operator=(const Bytes&) = delete;
+
+  Bytes(Bytes&& other) noexcept : buf(other.buf), len(other.len), cap(other.cap) {
+    other.buf = nullptr;
+    other.len = other.cap = 0;
+  }
+
+  Bytes& operator=(Bytes&& other) noexcept {
+    if (this != &other) {
+      release();
+      buf = other.buf;
+      len = other.len;
+      cap = other.cap;
+      other.buf = nullptr;
+      other.len = other.cap = 0;
+    }
+    return *this;
+  }
+
+  ~Bytes() { release(); }
+
+  Bytes clone() const { return Bytes(span()); }
+
+  byte* data() { return buf; }
+  const byte* data() const { return buf; }
+  size_t size() const { return len; }
+  size_t capacity() const { return cap; }
+  bool empty() const { return len == 0; }
+  byte& operator[](size_t i) { return buf[i]; }
+  const byte& operator[](size_t i) const { return buf[i]; }
+  byte* begin() { return buf; }
+  byte* end() { return buf + len; }
+  const byte* begin() const { return buf; }
+  const byte* end() const { return buf + len; }
+
+  ByteSpan span() const { return ByteSpan(buf, len); }
+  ByteSpan subspan(size_t offset, size_t size = std::string_view::npos) const { return span().subspan(offset, size); }
+  MutableByteSpan mutable_span() { return MutableByteSpan(buf, len); }
+  operator ByteSpan() const { return span(); }
+  operator MutableByteSpan() { return mutable_span(); }
+
+  void reserve(size_t new_cap) {
+    if (new_cap <= cap)
+      return;
+    byte* new_buf = static_cast<byte*>(::operator new(new_cap, std::align_val_t(BYTES_ALIGNMENT)));
+    if (len > 0)
+      memcpy(new_buf, buf, len);
+    release_buffer();
+    buf = new_buf;
+    cap = new_cap;
+  }
+
+  // new bytes are zeroed
+  void resize(size_t new_len) {
+    if (new_len > cap)
+      reserve(std::max(new_len, cap * 2));
+    if (new_len > len)
+      memset(buf + len, 0, new_len - len);
+    len = new_len;
+  }
+
+  void push_back(byte b) {
+    if (len == cap)
+      reserve(std::max<size_t>(BYTES_ALIGNMENT, cap * 2));
+    buf[len++] = b;
+  }
+
+  void append(ByteSpan span) {
+    if (span.empty())
+      return;
+    if (len + span.size() > cap)
+      reserve(std::max(len + span.size(), cap * 2));
+    memcpy(buf + len, span.data(), span.size());
+    len += span.size();
+  }
+
+  void clear() { len = 0; }
+
+  std::string to_string() const { return std::string((const char*) buf, len); }
+
+private:
+  void release_buffer() {
+    if (buf != nullptr)
+      ::operator delete(buf, std::align_val_t(BYTES_ALIGNMENT));
+  }
+
+  void release() {
+    release_buffer();
+    buf = nullptr;
+    len = cap = 0;
+  }
+
+  byte* buf;
+  size_t len;
+  size_t cap;
+};
+
+// copy a string into an owned byte buffer
+inline Bytes str_to_bytes(std::string_view str)
+{
+  return Bytes(ByteSpan(str));
+}
+
+#endif
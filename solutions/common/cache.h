@@ -0,0 +1,575 @@
+#ifndef CRYPTOPALS_CACHE_H
+#define CRYPTOPALS_CACHE_H
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "bytes.h"
+#include "instrument.h"
+
+// On-disk cache of crack results, keyed by a 128 bit hash of the ciphertext and of a string
+// naming the analysis and its parameters. All integers are little endian.
+//
+//   header   magic "CPCRACKS", version u32, reserved u32
+//   records  hash 2 x u64, size u32 of the entries, num_keys u32, then for each ranked key
+//            its length u32, its bytes and its score as a double
+//
+// The file is only ever appended to, under an exclusive flock, so several crackers can share
+// one. A record a crashed writer cut short is dropped by the next process to open the cache
+// or write to it.
+//
+// The open addressing index from hash to record is saved beside the cache, in the cache
+// filename plus CACHE_INDEX_SUFFIX, when a process closes the cache having indexed records
+// the saved index lacks:
+//
+//   header   magic "CPCINDEX", version u32, reserved u32, then u64s: the inode of the cache
+//            file, the end of the records indexed, the offset and first hash of the last of
+//            them, the slot count and the entry count
+//   slots    record offset u64 and first hash u64 per slot; offset 0 marks an empty slot,
+//            since no record starts inside the header
+//
+// Opening the cache maps the saved index privately, so it is neither read nor rebuilt up
+// front, and indexes only the records appended after it. An index that does not end on the
+// last record it names, or names another file, is ignored and the index is rebuilt.
+#define CACHE_MAGIC "CPCRACKS"
+#define CACHE_MAGIC_SIZE 8
+#define CACHE_VERSION 1
+#define CACHE_HEADER_SIZE 16
+#define CACHE_RECORD_HEADER_SIZE 24
+// new records are written out once this many bytes of them are waiting
+#define CACHE_WRITE_BUFFER_SIZE (1ul << 20)
+// set in an index offset that points into the records not written out yet
+#define CACHE_PENDING_FLAG (1ull << 63)
+#define CACHE_INDEX_SUFFIX ".index"
+#define CACHE_INDEX_MAGIC "CPCINDEX"
+#define CACHE_INDEX_VERSION 1
+#define CACHE_INDEX_HEADER_SIZE 64
+#define CACHE_INDEX_MIN_SLOTS 1024
+
+struct CacheHeader {
+  char magic[CACHE_MAGIC_SIZE];
+  uint32_t version;
+  uint32_t reserved;
+};
+static_assert(sizeof(CacheHeader) == CACHE_HEADER_SIZE, "cache header must be packed");
+
+struct CacheRecordHeader {
+  uint64_t hash[2];
+  uint32_t size;
+  uint32_t num_keys;
+};
+static_assert(sizeof(CacheRecordHeader) == CACHE_RECORD_HEADER_SIZE, "cache record header must be packed");
+struct CacheIndexHeader {
+  char magic[CACHE_MAGIC_SIZE];
+  uint32_t version;
+  uint32_t reserved;
+  uint64_t inode;
+  uint64_t indexed_end;
+  uint64_t last_record;
+  uint64_t last_hash;
+  uint64_t num_slots;
+  uint64_t num_entries;
+};
+static_assert(sizeof(CacheIndexHeader) == CACHE_INDEX_HEADER_SIZE, "cache index header must be packed");
+
+// one slot of the index; offset 0 marks an empty slot
+struct CacheSlot {
+  uint64_t offset;
+  uint64_t hash;
+};
+
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "cache files are read in place as little endian");
+
+struct CacheKey {
+  uint64_t hash[2];
+};
+
+// one ranked key as the cache stores it
+struct CachedKey {
+  Bytes key;
+  double score;
+};
+
+// cache key for the results of mode, which should name the analysis and every parameter that
+// changes its results, on ciphertext
+CacheKey make_cache_key(ByteSpan ciphertext, const std::string& mode);
+
+class CrackCache {
+public:
+  // open the cache file, creating it if it does not exist
+  explicit CrackCache(const std::string& filename);
+  // errors writing the last records or the index are lost here; call flush() and
+  // save_index() first to see them
+  ~CrackCache();
+  CrackCache(const CrackCache&) = delete;
+  CrackCache& operator=(const CrackCache&) = delete;
+
+  // the ranked keys stored for key, or false if there are none
+  bool find(const CacheKey& key, std::vector<CachedKey>& keys) const;
+  // store ranked keys for key; they can be found at once, and are written out on flush()
+  void insert(const CacheKey& key, const std::vector<CachedKey>& keys);
+  // append the waiting records to the file and pick up records other processes appended
+  void flush();
+  // save the index beside the cache if it covers records the saved one does not; the
+  // records must have been flushed
+  void save_index();
+  size_t size() const { return num_entries; }
+
+private:
+  // map the saved index if it matches the cache file, st, as it is now
+  void load_index(const struct stat& st);
+  void unmap_index();
+  // map the file as it is now and index the complete records not indexed yet
+  void refresh();
+  void index_record(const CacheKey& key, uint64_t offset);
+  const byte* record_at(uint64_t offset) const;
+  // write all of buf to fd, or return false with errno set
+  static bool write_all(int fd, const void* buf, size_t size);
+
+  int fd;
+  std::string index_filename;
+  const byte* data;
+  size_t mapped_size;
+  // end of the last complete record in the index, and where that record starts
+  size_t indexed_end;
+  size_t last_record;
+  // end of the records the saved index covers
+  size_t saved_end;
+  // the open addressing table, in the private mapping of the saved index until it has to grow
+  // and in owned_slots after that
+  CacheSlot* slots;
+  size_t num_slots;
+  std::vector<CacheSlot> owned_slots;
+  void* index_mapping;
+  size_t index_mapped_size;
+  size_t num_entries;
+  std::string pending;
+};
+
+// 64 bit finalizer from MurmurHash3
+inline uint64_t cache_mix(uint64_t h)
+{
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdull;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ull;
+  h ^= h >> 33;
+  return h;
+}
+
+// hash of data eight bytes at a time, chained from seed
+inline uint64_t cache_hash(ByteSpan data, uint64_t seed)
+{
+  uint64_t h = seed ^ cache_mix(data.size());
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= data.size(); i += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, data.data() + i, sizeof(word));
+    h = (h ^ cache_mix(word)) * 0x9e3779b97f4a7c15ull;
+  }
+  uint64_t tail = 0;
+  if (i < data.size()) {
+    memcpy(&tail, data.data() + i, data.size() - i);
+  }
+  return cache_mix(h ^ tail);
+}
+
+inline CacheKey make_cache_key(ByteSpan ciphertext, const std::string& mode)
+{
+  // two independent hashes, so a collision needs 128 bits to agree
+  CacheKey key;
+  for (int i = 0; i < 2; i++) {
+    uint64_t seed = cache_hash(ByteSpan((const byte*) mode.data(), mode.size()), i + 1);
+    key.hash[i] = cache_hash(ciphertext, seed);
+  }
+  return key;
+}
+
+inline CrackCache::CrackCache(const std::string& filename)
+  : index_filename(filename + CACHE_INDEX_SUFFIX), data(NULL), mapped_size(0),
+    indexed_end(CACHE_HEADER_SIZE), last_record(0), saved_end(CACHE_HEADER_SIZE),
+    owned_slots(CACHE_INDEX_MIN_SLOTS), index_mapping(NULL), index_mapped_size(0), num_entries(0)
+{
+  slots = owned_slots.data();
+  num_slots = owned_slots.size();
+
+  fd = open(filename.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+  if (fd == -1) {
+    throw std::invalid_argument("unable to open cache file " + filename);
+  }
+
+  flock(fd, LOCK_EX);
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size == 0) {
+    CacheHeader header = {};
+    memcpy(header.magic, CACHE_MAGIC, CACHE_MAGIC_SIZE);
+    header.version = CACHE_VERSION;
+    if (write(fd, &header, sizeof(header)) != sizeof(header)) {
+      flock(fd, LOCK_UN);
+      close(fd);
+      throw std::runtime_error("unable to write cache header");
+    }
+  }
+
+  try {
+    CacheHeader header = {};
+    if (pread(fd, &header, sizeof(header), 0) != sizeof(header)
+	|| memcmp(header.magic, CACHE_MAGIC, CACHE_MAGIC_SIZE) != 0 || header.version != CACHE_VERSION) {
+      throw std::invalid_argument("not a cache file");
+    }
+    if (fstat(fd, &st) == -1) {
+      throw std::runtime_error("unable to stat cache file");
+    }
+    load_index(st);
+    refresh();
+    // drop a record a crash cut short, so appends start on a record boundary again
+    if (indexed_end < mapped_size && ftruncate(fd, indexed_end) == -1) {
+      throw std::runtime_error("unable to truncate cache file");
+    }
+  } catch (...) {
+    flock(fd, LOCK_UN);
+    if (data) {
+      munmap(const_cast<byte*>(data), mapped_size);
+    }
+    unmap_index();
+    close(fd);
+    throw;
+  }
+  flock(fd, LOCK_UN);
+}
+
+inline CrackCache::~CrackCache()
+{
+  try {
+    flush();
+    save_index();
+  } catch (const std::runtime_error&) {
+  }
+  if (data) {
+    munmap(const_cast<byte*>(data), mapped_size);
+  }
+  unmap_index();
+  close(fd);
+}
+
+inline bool CrackCache::find(const CacheKey& key, std::vector<CachedKey>& keys) const
+{
+  size_t mask = num_slots - 1;
+  for (size_t i = key.hash[0] & mask; slots[i].offset != 0; i = (i + 1) & mask) {
+    if (slots[i].hash != key.hash[0]) {
+      continue;
+    }
+    const byte* record = record_at(slots[i].offset);
+    CacheRecordHeader header;
+    memcpy(&header, record, sizeof(header));
+    if (header.hash[1] != key.hash[1]) {
+      continue;
+    }
+
+    // the entries were checked to stay inside the record when it was indexed
+    keys.resize(header.num_keys);
+    const byte* p = record + sizeof(header);
+    for (auto& k : keys) {
+      uint32_t length;
+      memcpy(&length, p, sizeof(length));
+      p += sizeof(length);
+      k.key = Bytes(ByteSpan(p, length));
+      p += length;
+      memcpy(&k.score, p, sizeof(k.score));
+      p += sizeof(k.score);
+    }
+    INSTRUMENT_COUNT("cache_hits", 1);
+    return true;
+  }
+  INSTRUMENT_COUNT("cache_misses", 1);
+  return false;
+}
+
+inline void CrackCache::insert(const CacheKey& key, const std::vector<CachedKey>& keys)
+{
+  CacheRecordHeader header = {{key.hash[0], key.hash[1]}, 0, (uint32_t) keys.size()};
+  for (auto& k : keys) {
+    header.size += sizeof(uint32_t) + k.key.size() + sizeof(double);
+  }
+
+  uint64_t offset = pending.size() | CACHE_PENDING_FLAG;
+  pending.append((const char*) &header, sizeof(header));
+  for (auto& k : keys) {
+    uint32_t length = k.key.size();
+    pending.append((const char*) &length, sizeof(length));
+    pending.append((const char*) k.key.data(), k.key.size());
+    pending.append((const char*) &k.score, sizeof(k.score));
+  }
+  index_record(key, offset);
+
+  if (pending.size() >= CACHE_WRITE_BUFFER_SIZE) {
+    flush();
+  }
+}
+
+inline void CrackCache::flush()
+{
+  if (pending.empty()) {
+    return;
+  }
+
+  // other processes may have appended since, or died part way through a record, so index
+  // what they added and cut off what they left unfinished before appending
+  flock(fd, LOCK_EX);
+  try {
+    refresh();
+    if (indexed_end < mapped_size && ftruncate(fd, indexed_end) == -1) {
+      throw std::runtime_error("unable to truncate cache file");
+    }
+  } catch (...) {
+    flock(fd, LOCK_UN);
+    throw;
+  }
+  if (!write_all(fd, pending.data(), pending.size())) {
+    std::string error = strerror(errno);
+    flock(fd, LOCK_UN);
+    throw std::runtime_error("unable to write cache file: " + error);
+  }
+
+  // indexing the records just written points their keys at the file instead of pending
+  try {
+    refresh();
+  } catch (...) {
+    flock(fd, LOCK_UN);
+    throw;
+  }
+  flock(fd, LOCK_UN);
+  pending.clear();
+}
+
+inline void CrackCache::refresh()
+{
+  struct stat st;
+  if (fstat(fd, &st) == -1) {
+    throw std::runtime_error("unable to stat cache file");
+  }
+  size_t file_size = st.st_size;
+  if (file_size != mapped_size) {
+    if (data) {
+      munmap(const_cast<byte*>(data), mapped_size);
+      data = NULL;
+    }
+    mapped_size = 0;
+    void* mapping = mmap(NULL, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED) {
+      throw std::runtime_error("unable to mmap cache file");
+    }
+    data = static_cast<const byte*>(mapping);
+    mapped_size = file_size;
+  }
+
+  while (indexed_end + sizeof(CacheRecordHeader) <= mapped_size) {
+    CacheRecordHeader header;
+    memcpy(&header, data + indexed_end, sizeof(header));
+    size_t end = indexed_end + sizeof(header) + header.size;
+    if (end > mapped_size) {
+      break;
+    }
+
+    // check the entries fit the record once here, so find() can read them unchecked
+    size_t p = indexed_end + sizeof(header);
+    bool valid = true;
+    for (uint32_t i = 0; i < header.num_keys && valid; i++) {
+      uint32_t length;
+      valid = p + sizeof(length) <= end;
+      if (valid) {
+	memcpy(&length, data + p, sizeof(length));
+	p += sizeof(length) + length + sizeof(double);
+	valid = p <= end;
+      }
+    }
+    if (!valid) {
+      break;
+    }
+
+    index_record(CacheKey{{header.hash[0], header.hash[1]}}, indexed_end);
+    last_record = indexed_end;
+    indexed_end = end;
+  }
+}
+
+inline void CrackCache::index_record(const CacheKey& key, uint64_t offset)
+{
+  // keep the table at most half full
+  if ((num_entries + 1) * 2 > num_slots) {
+    std::vector<CacheSlot> grown(num_slots * 2);
+    size_t mask = grown.size() - 1;
+    for (size_t j = 0; j < num_slots; j++) {
+      if (slots[j].offset != 0) {
+	size_t i = slots[j].hash & mask;
+	while (grown[i].offset != 0) {
+	  i = (i + 1) & mask;
+	}
+	grown[i] = slots[j];
+      }
+    }
+    owned_slots.swap(grown);
+    unmap_index();
+    slots = owned_slots.data();
+    num_slots = owned_slots.size();
+  }
+
+  size_t mask = num_slots - 1;
+  size_t i = key.hash[0] & mask;
+  while (slots[i].offset != 0) {
+    // a later record for the same key replaces the earlier one
+    if (slots[i].hash == key.hash[0]) {
+      CacheRecordHeader header;
+      memcpy(&header, record_at(slots[i].offset), sizeof(header));
+      if (header.hash[1] == key.hash[1]) {
+	slots[i].offset = offset;
+	return;
+      }
+    }
+    i = (i + 1) & mask;
+  }
+  slots[i].offset = offset;
+  slots[i].hash = key.hash[0];
+  num_entries++;
+}
+
+inline const byte* CrackCache::record_at(uint64_t offset) const
+{
+  if (offset & CACHE_PENDING_FLAG) {
+    return (const byte*) pending.data() + (offset & ~CACHE_PENDING_FLAG);
+  }
+  return data + offset;
+}
+
+inline void CrackCache::load_index(const struct stat& st)
+{
+  int index_fd = open(index_filename.c_str(), O_RDONLY);
+  if (index_fd == -1) {
+    return;
+  }
+
+  // the last record the index names must end where the index does, so an index left from a
+  // cache since deleted or truncated is caught even if the inode was reused
+  struct stat index_st;
+  CacheIndexHeader header = {};
+  CacheRecordHeader last = {};
+  bool usable = fstat(index_fd, &index_st) == 0
+    && pread(index_fd, &header, sizeof(header), 0) == sizeof(header)
+    && memcmp(header.magic, CACHE_INDEX_MAGIC, CACHE_MAGIC_SIZE) == 0 && header.version == CACHE_INDEX_VERSION
+    && header.inode == (uint64_t) st.st_ino && header.indexed_end <= (uint64_t) st.st_size
+    && header.num_slots >= CACHE_INDEX_MIN_SLOTS && (header.num_slots & (header.num_slots - 1)) == 0
+    && header.num_slots <= (uint64_t) index_st.st_size / sizeof(CacheSlot)
+    && (uint64_t) index_st.st_size == sizeof(header) + header.num_slots * sizeof(CacheSlot)
+    && header.num_entries * 2 <= header.num_slots;
+  if (usable && header.indexed_end > CACHE_HEADER_SIZE) {
+    usable = header.last_record >= CACHE_HEADER_SIZE
+      && pread(fd, &last, sizeof(last), header.last_record) == sizeof(last)
+      && last.hash[0] == header.last_hash
+      && header.last_record + sizeof(last) + last.size == header.indexed_end;
+  } else if (usable) {
+    usable = header.num_entries == 0;
+  }
+
+  void* mapping = MAP_FAILED;
+  if (usable) {
+    // private and writable, so records indexed later change this process's copy only
+    mapping = mmap(NULL, index_st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, index_fd, 0);
+  }
+  close(index_fd);
+  if (mapping == MAP_FAILED) {
+    return;
+  }
+
+  index_mapping = mapping;
+  index_mapped_size = index_st.st_size;
+  slots = reinterpret_cast<CacheSlot*>(static_cast<byte*>(mapping) + sizeof(header));
+  num_slots = header.num_slots;
+  num_entries = header.num_entries;
+  indexed_end = header.indexed_end;
+  last_record = header.last_record;
+  saved_end = indexed_end;
+  owned_slots = std::vector<CacheSlot>();
+}
+
+inline void CrackCache::unmap_index()
+{
+  if (index_mapping) {
+    munmap(index_mapping, index_mapped_size);
+    index_mapping = NULL;
+  }
+}
+
+inline void CrackCache::save_index()
+{
+  if (indexed_end == saved_end || !pending.empty()) {
+    return;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) == -1) {
+    throw std::runtime_error("unable to stat cache file");
+  }
+  CacheIndexHeader header = {};
+  memcpy(header.magic, CACHE_INDEX_MAGIC, CACHE_MAGIC_SIZE);
+  header.version = CACHE_INDEX_VERSION;
+  header.inode = st.st_ino;
+  header.indexed_end = indexed_end;
+  header.num_slots = num_slots;
+  header.num_entries = num_entries;
+  if (indexed_end > CACHE_HEADER_SIZE) {
+    CacheRecordHeader last;
+    memcpy(&last, record_at(last_record), sizeof(last));
+    header.last_record = last_record;
+    header.last_hash = last.hash[0];
+  }
+
+  // written to a new file and renamed over the old one, so a process opening the cache sees
+  // one whole index or the other; the flock keeps other savers off the temporary file
+  std::string temporary = index_filename + ".tmp";
+  flock(fd, LOCK_EX);
+  int index_fd = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  bool saved = index_fd != -1 && write_all(index_fd, &header, sizeof(header))
+    && write_all(index_fd, slots, num_slots * sizeof(CacheSlot)) && fsync(index_fd) == 0;
+  if (index_fd != -1) {
+    saved = close(index_fd) == 0 && saved;
+  }
+  saved = saved && rename(temporary.c_str(), index_filename.c_str()) == 0;
+  if (!saved) {
+    unlink(temporary.c_str());
+  }
+  flock(fd, LOCK_UN);
+  if (!saved) {
+    throw std::runtime_error("unable to save cache index " + index_filename);
+  }
+  saved_end = indexed_end;
+}
+
+inline bool CrackCache::write_all(int fd, const void* buf, size_t size)
+{
+  const char* p = static_cast<const char*>(buf);
+  size_t written = 0;
+  while (written < size) {
+    ssize_t n = write(fd, p + written, size - written);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return false;
+    }
+    written += n;
+  }
+  return true;
+}
+
+#endif
@@ -0,0 +1,170 @@
+#ifndef CRYPTOPALS_CHECKPOINT_H
+#define CRYPTOPALS_CHECKPOINT_H
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#define CHECKPOINT_HEADER "cryptopals checkpoint 2"
+// appended to the checkpoint filename to name its results file
+#define CHECKPOINT_RESULTS_SUFFIX ".results"
+// seconds between saves while a batch job runs
+#define CHECKPOINT_INTERVAL 10
+
+// Progress of a long batch job, kept in two files so a restarted job can carry on where the
+// last save left it. The checkpoint file itself is small and rewritten on every save:
+//
+//   cryptopals checkpoint 2
+//   position <how far into the input everything is done>
+//   results <how many lines of the results file belong to that position>
+//
+// The results file, the checkpoint filename plus CHECKPOINT_RESULTS_SUFFIX, holds one result
+// line per result and only grows: a save appends the results added since the last one. The
+// job decides what a position counts, bytes or records, and what a result line holds.
+// Results are synced before the checkpoint file is written to a new file and renamed over
+// the old one, so a crash during a save leaves the previous checkpoint intact, and results
+// appended past its count are dropped when it is loaded.
+class Checkpoint {
+public:
+  // load the checkpoint in filename, or start from nothing if there is none
+  explicit Checkpoint(const std::string& filename);
+
+  uint64_t position() const { return saved_position; }
+  // results saved so far, then any added since
+  const std::vector<std::string>& results() const { return all_results; }
+
+  // a result for the input before the next save's position
+  void add_result(const std::string& result);
+  // true once CHECKPOINT_INTERVAL seconds have passed since the last save
+  bool due() const { return std::chrono::steady_clock::now() >= next_save; }
+  // record that everything before position is done, with the results added so far
+  void save(uint64_t position);
+
+private:
+  // write all of contents to fd, or throw naming filename
+  static void write_all(int fd, const std::string& contents, const std::string& filename);
+
+  std::string filename;
+  std::string results_filename;
+  uint64_t saved_position;
+  // results already in the results file
+  size_t saved_results;
+  std::vector<std::string> all_results;
+  std::chrono::steady_clock::time_point next_save;
+};
+
+inline Checkpoint::Checkpoint(const std::string& filename)
+  : filename(filename), results_filename(filename + CHECKPOINT_RESULTS_SUFFIX),
+    saved_position(0), saved_results(0),
+    next_save(std::chrono::steady_clock::now() + std::chrono::seconds(CHECKPOINT_INTERVAL))
+{
+  std::ifstream file(filename);
+  if (!file) {
+    // results from a run that never saved a checkpoint belong to no position
+    if (truncate(results_filename.c_str(), 0) == -1 && errno != ENOENT) {
+      throw std::runtime_error("unable to truncate checkpoint results file " + results_filename);
+    }
+    return;
+  }
+
+  std::string line;
+  if (!std::getline(file, line) || line != CHECKPOINT_HEADER) {
+    throw std::invalid_argument("not a checkpoint file: " + filename);
+  }
+  while (std::getline(file, line)) {
+    if (line.compare(0, 9, "position ") == 0) {
+      saved_position = std::stoull(line.substr(9));
+    } else if (line.compare(0, 8, "results ") == 0) {
+      saved_results = std::stoull(line.substr(8));
+    } else {
+      throw std::invalid_argument("bad line in checkpoint file: " + line);
+    }
+  }
+
+  // read the results the checkpoint counts, and drop any a later, unfinished save appended
+  std::ifstream results(results_filename);
+  off_t length = 0;
+  while (all_results.size() < saved_results && std::getline(results, line)) {
+    if (results.eof()) {
+      break;
+    }
+    all_results.push_back(line);
+    length += line.size() + 1;
+  }
+  if (all_results.size() < saved_results) {
+    throw std::invalid_argument("checkpoint results file is missing results: " + results_filename);
+  }
+  if (truncate(results_filename.c_str(), length) == -1 && errno != ENOENT) {
+    throw std::runtime_error("unable to truncate checkpoint results file " + results_filename);
+  }
+}
+
+inline void Checkpoint::add_result(const std::string& result)
+{
+  if (result.find('\n') != std::string::npos) {
+    throw std::invalid_argument("checkpoint results must be single lines");
+  }
+  all_results.push_back(result);
+}
+
+inline void Checkpoint::save(uint64_t position)
+{
+  // the new results must be on disk before a checkpoint counts them
+  std::string appended;
+  for (size_t i = saved_results; i < all_results.size(); i++) {
+    appended += all_results[i] + "\n";
+  }
+  if (!appended.empty()) {
+    int fd = open(results_filename.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (fd == -1) {
+      throw std::runtime_error("unable to write checkpoint results file " + results_filename);
+    }
+    write_all(fd, appended, results_filename);
+    if (fsync(fd) == -1 || close(fd) == -1) {
+      throw std::runtime_error("unable to save checkpoint results file " + results_filename);
+    }
+  }
+
+  // the new checkpoint must be on disk before it replaces the old one
+  std::string contents = CHECKPOINT_HEADER "\nposition " + std::to_string(position)
+    + "\nresults " + std::to_string(all_results.size()) + "\n";
+  std::string temporary = filename + ".tmp";
+  int fd = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd == -1) {
+    throw std::runtime_error("unable to write checkpoint file " + temporary);
+  }
+  write_all(fd, contents, temporary);
+  if (fsync(fd) == -1 || close(fd) == -1 || rename(temporary.c_str(), filename.c_str()) == -1) {
+    throw std::runtime_error("unable to save checkpoint file " + filename);
+  }
+
+  saved_position = position;
+  saved_results = all_results.size();
+  next_save = std::chrono::steady_clock::now() + std::chrono::seconds(CHECKPOINT_INTERVAL);
+}
+
+inline void Checkpoint::write_all(int fd, const std::string& contents, const std::string& filename)
+{
+  size_t written = 0;
+  while (written < contents.size()) {
+    ssize_t n = write(fd, contents.data() + written, contents.size() - written);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      close(fd);
+      throw std::runtime_error("unable to write checkpoint file " + filename);
+    }
+    written += n;
+  }
+}
+
+#endif
@@ -0,0 +1,173 @@
+#ifndef CRYPTOPALS_CORPUS_H
+#define CRYPTOPALS_CORPUS_H
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "bytes.h"
+#include "output.h"
+
+// Binary ciphertext corpus. All integers are little endian.
+//
+//   header   magic "CPCORPUS", version u32, reserved u32, num_records u64, index_offset u64
+//   records  for each record its length u32, then its raw bytes
+//   index    num_records u64 file offsets, each pointing at a record's length
+//
+// Readers map the file and hand out records in place, so nothing is parsed or copied, any
+// record can be found from the index, and a range of record numbers splits the corpus
+// between threads.
+#define CORPUS_MAGIC "CPCORPUS"
+#define CORPUS_MAGIC_SIZE 8
+#define CORPUS_VERSION 1
+#define CORPUS_HEADER_SIZE 32
+
+struct CorpusHeader {
+  char magic[CORPUS_MAGIC_SIZE];
+  uint32_t version;
+  uint32_t reserved;
+  uint64_t num_records;
+  uint64_t index_offset;
+};
+static_assert(sizeof(CorpusHeader) == CORPUS_HEADER_SIZE, "corpus header must be packed");
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "corpus files are read in place as little endian");
+
+// writes a corpus to a file descriptor that supports pwrite, so the header can be filled
+// in once the records are counted
+class CorpusWriter {
+public:
+  explicit CorpusWriter(int fd) : fd(fd), out(fd) {
+    CorpusHeader header = {};
+    out.write((const char*) &header, sizeof(header));
+  }
+
+  void add(ByteSpan record) {
+    if (record.size() > UINT32_MAX) {
+      throw std::invalid_argument("corpus records are limited to 4 GB");
+    }
+    offsets.push_back(out.bytes_written());
+    uint32_t length = record.size();
+    out.write((const char*) &length, sizeof(length));
+    out.write(record);
+  }
+
+  size_t size() const { return offsets.size(); }
+
+  // write the index and the header; the writer must not be used afterwards
+  void finish();
+
+private:
+  int fd;
+  Output out;
+  std::vector<uint64_t> offsets;
+};
+
+// a mapped corpus file
+class CorpusReader {
+public:
+  explicit CorpusReader(const std::string& filename);
+  ~CorpusReader() { munmap(const_cast<byte*>(data), file_size); }
+  CorpusReader(const CorpusReader&) = delete;
+  CorpusReader& operator=(const CorpusReader&) = delete;
+
+  // true if the file starts with the corpus magic, so callers can tell it from a text corpus
+  static bool is_corpus(const std::string& filename);
+
+  size_t size() const { return num_records; }
+  ByteSpan record(size_t i) const {
+    uint64_t offset = index[i];
+    uint32_t length;
+    if (offset < CORPUS_HEADER_SIZE || offset > records_end - sizeof(length)) {
+      throw std::out_of_range("corpus index points outside the records");
+    }
+    memcpy(&length, data + offset, sizeof(length));
+    if (length > records_end - offset - sizeof(length)) {
+      throw std::out_of_range("corpus record runs past the records");
+    }
+    return ByteSpan(data + offset + sizeof(length), length);
+  }
+  size_t bytes() const { return file_size; }
+
+private:
+  const byte* data;
+  size_t file_size;
+  size_t num_records;
+  size_t records_end;
+  // offsets straight from the mapping; the index starts 8 byte aligned
+  const uint64_t* index;
+};
+
+inline void CorpusWriter::finish()
+{
+  CorpusHeader header = {};
+  memcpy(header.magic, CORPUS_MAGIC, CORPUS_MAGIC_SIZE);
+  header.version = CORPUS_VERSION;
+  header.num_records = offsets.size();
+
+  // pad so the index can be read in place as uint64_t
+  while (out.bytes_written() % sizeof(uint64_t) != 0) {
+    out.put(0);
+  }
+  header.index_offset = out.bytes_written();
+  out.write((const char*) offsets.data(), offsets.size() * sizeof(uint64_t));
+  out.flush();
+
+  if (pwrite(fd, &header, sizeof(header), 0) != sizeof(header)) {
+    throw std::runtime_error("unable to write corpus header; the output must be a file");
+  }
+}
+
+inline CorpusReader::CorpusReader(const std::string& filename)
+{
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd == -1) {
+    throw std::invalid_argument("unable to open corpus file");
+  }
+  struct stat st;
+  if (fstat(fd, &st) == -1 || (size_t) st.st_size < CORPUS_HEADER_SIZE) {
+    close(fd);
+    throw std::invalid_argument("corpus file is too short");
+  }
+  file_size = st.st_size;
+  void* mapping = mmap(NULL, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    throw std::runtime_error("unable to mmap corpus file");
+  }
+  data = static_cast<const byte*>(mapping);
+
+  CorpusHeader header;
+  memcpy(&header, data, sizeof(header));
+  if (memcmp(header.magic, CORPUS_MAGIC, CORPUS_MAGIC_SIZE) != 0 || header.version != CORPUS_VERSION
+      || header.index_offset % sizeof(uint64_t) != 0 || header.index_offset < CORPUS_HEADER_SIZE
+      || header.index_offset > file_size
+      || header.num_records > (file_size - header.index_offset) / sizeof(uint64_t)) {
+    munmap(mapping, file_size);
+    throw std::invalid_argument("not a corpus file, or an unfinished one");
+  }
+  num_records = header.num_records;
+  records_end = header.index_offset;
+  index = reinterpret_cast<const uint64_t*>(data + header.index_offset);
+}
+
+inline bool CorpusReader::is_corpus(const std::string& filename)
+{
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return false;
+  }
+  char magic[CORPUS_MAGIC_SIZE];
+  bool result = read(fd, magic, sizeof(magic)) == sizeof(magic)
+    && memcmp(magic, CORPUS_MAGIC, CORPUS_MAGIC_SIZE) == 0;
+  close(fd);
+  return result;
+}
+
+#endif
@@ -0,0 +1,249 @@
+#ifndef CRYPTOPALS_CRIB_H
+#define CRYPTOPALS_CRIB_H
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "bytes.h"
+#include "instrument.h"
+#include "ngram.h"
+#include "xor.h"
+
+// offsets of the ciphertext a thread drags the cribs over at a time
+#define CRIB_UNIT_SIZE 256
+// ciphertext bytes decrypted to judge one crib placement
+#define CRIB_SAMPLE_SIZE 4096
+// average byte model log2 probability below which a placement is dropped
+#define CRIB_MIN_SCORE -8.0
+
+// a crib placed at an offset that implies a self-consistent key for one keysize
+struct CribHit {
+  size_t keysize;
+  size_t offset;
+  size_t crib;
+  // average byte model log2 probability of the ciphertext the implied key bytes decrypt
+  double score;
+};
+
+// a repeating key put together from crib hits; bytes no crib reached are filled in from
+// the byte model and marked unknown
+struct CribKey {
+  Bytes key;
+  std::vector<bool> known;
+  double score;
+};
+
+// slide every crib over every offset of the ciphertext on num_threads threads and return the
+// placements whose implied key bytes agree with themselves modulo a keysize in
+// [min_keysize, max_keysize] and decrypt the rest of the ciphertext to plausible text
+std::vector<CribHit> drag_cribs(ByteSpan ciphertext, const std::vector<Bytes>& cribs,
+				size_t min_keysize, size_t max_keysize, unsigned num_threads);
+
+// merge the hits for one keysize into a key, best hit first, skipping hits that contradict
+// the key bytes found so far, then fill the remaining key bytes column by column
+CribKey assemble_crib_key(ByteSpan ciphertext, const std::vector<Bytes>& cribs,
+			  const std::vector<CribHit>& hits, size_t keysize);
+
+// the most english decryption over every keysize with a crib hit, reduced to its shortest period
+CribKey crack_with_cribs(ByteSpan ciphertext, const std::vector<Bytes>& cribs,
+			 size_t min_keysize, size_t max_keysize, unsigned num_threads);
+
+
+// key byte for each residue of the keysize that crib implies at offset, or -1 where it says
+// nothing; false if the crib implies two different bytes for one residue
+inline bool implied_key(ByteSpan ciphertext, ByteSpan crib, size_t offset, size_t keysize, int* key)
+{
+  std::fill(key, key + keysize, -1);
+  for (size_t i = 0; i < crib.size(); i++) {
+    size_t residue = (offset + i) % keysize;
+    int k = ciphertext[offset + i] ^ crib[i];
+    if (key[residue] >= 0 && key[residue] != k) {
+      return false;
+    }
+    key[residue] = k;
+  }
+  return true;
+}
+
+// average byte model log2 probability of the ciphertext decrypted under the known key bytes,
+// over at most CRIB_SAMPLE_SIZE bytes
+inline double score_partial_key(ByteSpan ciphertext, const int* key, size_t keysize)
+{
+  int64_t sum = 0;
+  size_t count = 0;
+  for (size_t block = 0; block < ciphertext.size() && count < CRIB_SAMPLE_SIZE; block += keysize) {
+    size_t end = std::min(block + keysize, ciphertext.size());
+    for (size_t i = block; i < end; i++) {
+      if (key[i - block] >= 0) {
+	sum += NGRAM_BYTE_LOG_PROB[ciphertext[i] ^ key[i - block]];
+	count++;
+      }
+    }
+  }
+  return count ? (double) sum / NGRAM_SCALE / count : -INFINITY;
+}
+
+inline std::vector<CribHit> drag_cribs(ByteSpan ciphertext, const std::vector<Bytes>& cribs,
+				       size_t min_keysize, size_t max_keysize, unsigned num_threads)
+{
+  if (min_keysize == 0 || min_keysize > max_keysize) {
+    throw std::invalid_argument("bad keysize range");
+  }
+
+  std::atomic<size_t> next_unit{0};
+  std::mutex mutex;
+  std::vector<CribHit> hits;
+  size_t num_units = (ciphertext.size() + CRIB_UNIT_SIZE - 1) / CRIB_UNIT_SIZE;
+
+  auto worker = [&] {
+    INSTRUMENT_STAGE("key_search");
+    std::vector<CribHit> local_hits;
+    std::vector<int> key(max_keysize);
+    uint64_t placements = 0;
+    size_t unit;
+    while ((unit = next_unit.fetch_add(1, std::memory_order_relaxed)) < num_units) {
+      size_t begin = unit * CRIB_UNIT_SIZE;
+      size_t end = std::min(begin + CRIB_UNIT_SIZE, ciphertext.size());
+      for (size_t c = 0; c < cribs.size(); c++) {
+	for (size_t offset = begin; offset < end && offset + cribs[c].size() <= ciphertext.size(); offset++) {
+	  for (size_t keysize = min_keysize; keysize <= max_keysize; keysize++) {
+	    placements++;
+	    if (!implied_key(ciphertext, cribs[c], offset, keysize, key.data())) {
+	      continue;
+	    }
+	    double score = score_partial_key(ciphertext, key.data(), keysize);
+	    if (score >= CRIB_MIN_SCORE) {
+	      local_hits.push_back({keysize, offset, c, score});
+	    }
+	  }
+	}
+      }
+    }
+    INSTRUMENT_COUNT("keys_tried", placements);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    hits.insert(hits.end(), local_hits.begin(), local_hits.end());
+  };
+
+  std::vector<std::thread> workers;
+  for (unsigned i = 1; i < num_threads; i++) {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (auto& t : workers) {
+    t.join();
+  }
+
+  // best first, in the same order whatever the thread timing
+  std::sort(hits.begin(), hits.end(), [](const CribHit& h1, const CribHit& h2) {
+    if (h1.score != h2.score)
+      return h1.score > h2.score;
+    if (h1.keysize != h2.keysize)
+      return h1.keysize < h2.keysize;
+    if (h1.crib != h2.crib)
+      return h1.crib < h2.crib;
+    return h1.offset < h2.offset;
+  });
+  return hits;
+}
+
+inline CribKey assemble_crib_key(ByteSpan ciphertext, const std::vector<Bytes>& cribs,
+				 const std::vector<CribHit>& hits, size_t keysize)
+{
+  std::vector<int> key(keysize, -1);
+  std::vector<int> implied(keysize);
+  for (auto& hit : hits) {
+    if (hit.keysize != keysize) {
+      continue;
+    }
+    implied_key(ciphertext, cribs[hit.crib], hit.offset, keysize, implied.data());
+
+    bool consistent = true;
+    for (size_t r = 0; r < keysize && consistent; r++) {
+      consistent = implied[r] < 0 || key[r] < 0 || implied[r] == key[r];
+    }
+    if (!consistent) {
+      continue;
+    }
+    for (size_t r = 0; r < keysize; r++) {
+      if (implied[r] >= 0) {
+	key[r] = implied[r];
+      }
+    }
+  }
+
+  // columns no crib reached get their most likely byte on its own
+  CribKey result;
+  result.key.resize(keysize);
+  result.known.resize(keysize);
+  std::vector<Bytes> blocks = generate_blocks(ciphertext, keysize);
+  for (size_t r = 0; r < keysize; r++) {
+    result.known[r] = key[r] >= 0;
+    if (result.known[r]) {
+      result.key[r] = key[r];
+      continue;
+    }
+    Bytes decrypted(blocks[r].size());
+    int32_t best_score = INT32_MIN;
+    for (unsigned k = 0; k <= UINT8_MAX; k++) {
+      single_byte_xor(blocks[r], k, decrypted);
+      int32_t score = ngram_byte_log_prob(decrypted);
+      if (score > best_score) {
+	best_score = score;
+	result.key[r] = k;
+      }
+    }
+  }
+
+  result.score = ngram_score(repeating_key_xor(ciphertext, result.key));
+  return result;
+}
+
+inline CribKey crack_with_cribs(ByteSpan ciphertext, const std::vector<Bytes>& cribs,
+				size_t min_keysize, size_t max_keysize, unsigned num_threads)
+{
+  std::vector<CribHit> hits = drag_cribs(ciphertext, cribs, min_keysize, max_keysize, num_threads);
+  if (hits.empty()) {
+    throw std::runtime_error("no crib fits the ciphertext");
+  }
+
+  // a multiple of the keysize decrypts just as well, so only a strictly better score replaces
+  // a shorter key
+  std::vector<bool> tried(max_keysize + 1, false);
+  CribKey best;
+  best.score = -INFINITY;
+  for (auto& hit : hits) {
+    if (tried[hit.keysize]) {
+      continue;
+    }
+    tried[hit.keysize] = true;
+    CribKey candidate = assemble_crib_key(ciphertext, cribs, hits, hit.keysize);
+    if (candidate.score > best.score
+	|| (candidate.score == best.score && candidate.key.size() < best.key.size())) {
+      best = std::move(candidate);
+    }
+  }
+
+  // keep one period of a key that repeats within itself
+  for (size_t period = 1; period < best.key.size(); period++) {
+    if (best.key.size() % period == 0
+	&& memcmp(best.key.data(), best.key.data() + period, best.key.size() - period) == 0) {
+      best.key.resize(period);
+      for (size_t r = period; r < best.known.size(); r++) {
+	best.known[r % period] = best.known[r % period] || best.known[r];
+      }
+      best.known.resize(period);
+      break;
+    }
+  }
+  return best;
+}
+
+#endif
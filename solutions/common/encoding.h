@@ -0,0 +1,241 @@
+#ifndef CRYPTOPALS_ENCODING_H
+#define CRYPTOPALS_ENCODING_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "bytes.h"
+
+#define NUM_HEX_BITS 4
+#define NUM_BASE64_BITS 6
+#define BASE64_CHARS_IN_CHUNK 4
+#define BYTES_IN_BASE64_CHUNK 3
+
+// convert a hex character to its 4 bit value
+inline byte hex_to_bin(const char ch)
+{
+  switch(ch) {
+  case '0': return 0;
+  case '1': return 1;
+  case '2': return 2;
+  case '3': return 3;
+  case '4': return 4;
+  case '5': return 5;
+  case '6': return 6;
+  case '7': return 7;
+  case '8': return 8;
+  case '9': return 9;
+  case 'a': case 'A': return 10;
+  case 'b': case 'B': return 11;
+  case 'c': case 'C': return 12;
+  case 'd': case 'D': return 13;
+  case 'e': case 'E': return 14;
+  case 'f': case 'F': return 15;
+  default: throw std::invalid_argument("character is not a hex value");
+  }
+}
+
+// convert a 4 bit value to a hex character
+inline char int_to_hex(const unsigned decimal)
+{
+  if (decimal <= 9) {
+    return '0' + decimal;
+  } else if (decimal <= 15) {
+    return 'a' + decimal - 10;
+  } else {
+    throw std::invalid_argument("value is not a hex digit");
+  }
+}
+
+// decode a hex string into out, returning false if it is malformed
+inline bool hex_decode(std::string_view hex, Bytes& out)
+{
+  static const std::array<int8_t, 256> table = [] {
+    std::array<int8_t, 256> t;
+    t.fill(-1);
+    for (int i = 0; i < 10; i++) t['0' + i] = i;
+    for (int i = 0; i < 6; i++) t['a' + i] = t['A' + i] = 10 + i;
+    return t;
+  }();
+
+  if (hex.size() % 2 != 0) {
+    return false;
+  }
+
+  out.resize(hex.size() / 2);
+  byte* bytes = out.data();
+  for (size_t i = 0; i < out.size(); i++) {
+    int upper = table[(uint8_t) hex[2 * i]];
+    int lower = table[(uint8_t) hex[2 * i + 1]];
+    if ((upper | lower) < 0) {
+      return false;
+    }
+    bytes[i] = (upper << NUM_HEX_BITS) | lower;
+  }
+
+  return true;
+}
+
+// convert a hex string to bytes
+inline Bytes hex_str_to_bytes(std::string_view hex)
+{
+  Bytes bytes;
+  if (!hex_decode(hex, bytes)) {
+    throw std::invalid_argument("bad hex string input");
+  }
+  return bytes;
+}
+
+// encode bytes as 2 * bytes.size() hex characters at out
+inline void hex_encode(ByteSpan bytes, char* out)
+{
+  static const char digits[] = "0123456789abcdef";
+  for (size_t i = 0; i < bytes.size(); i++) {
+    out[2 * i] = digits[bytes[i] >> NUM_HEX_BITS];
+    out[2 * i + 1] = digits[bytes[i] & ((1 << NUM_HEX_BITS) - 1)];
+  }
+}
+
+// convert bytes to a hex string
+inline std::string bytes_to_hex(ByteSpan bytes)
+{
+  std::string hex(bytes.size() * 2, '\0');
+  hex_encode(bytes, &hex[0]);
+  return hex;
+}
+
+// convert a 6 bit value to a base64 character
+inline char base64_to_char(const unsigned base64_decimal)
+{
+  static const char alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  if (base64_decimal >= 64) {
+    throw std::invalid_argument("not a base64 value");
+  }
+  return alphabet[base64_decimal];
+}
+
+// convert a base64 character to its 6 bit value; padding decodes to 0
+inline byte base64_char_to_bits(const char base64_char)
+{
+  if (base64_char >= 'A' && base64_char <= 'Z') {
+    return base64_char - 'A';
+  } else if (base64_char >= 'a' && base64_char <= 'z') {
+    return base64_char - 'a' + 26;
+  } else if (base64_char >= '0' && base64_char <= '9') {
+    return base64_char - '0' + 52;
+  } else if (base64_char == '+') {
+    return 62;
+  } else if (base64_char == '/') {
+    return 63;
+  } else if (base64_char == '=') {
+    return 0;
+  } else {
+    throw std::invalid_argument("base64_char is not a base64 value");
+  }
+}
+
+// encode up to 3 bytes as 4 base64 characters, padding with '=' when short
+inline void chunk_to_base64(const byte* chunk, size_t num_bytes, char* base64_chars)
+{
+  uint32_t bits = 0;
+  for (size_t i = 0; i < BYTES_IN_BASE64_CHUNK; i++) {
+    bits = (bits << 8) | (i < num_bytes ? chunk[i] : 0);
+  }
+
+  for (int i = 0; i < BASE64_CHARS_IN_CHUNK; i++) {
+    unsigned shift = NUM_BASE64_BITS * (BASE64_CHARS_IN_CHUNK - 1 - i);
+    base64_chars[i] = base64_to_char((bits >> shift) & ((1 << NUM_BASE64_BITS) - 1));
+  }
+
+  // handle incomplete chunk
+  if (num_bytes == 1) {
+    base64_chars[2] = '=';
+    base64_chars[3] = '=';
+  } else if (num_bytes == 2) {
+    base64_chars[3] = '=';
+  }
+}
+
+// number of base64 characters needed for size bytes, including padding
+inline size_t base64_encoded_size(size_t size)
+{
+  return (size + 2) / BYTES_IN_BASE64_CHUNK * BASE64_CHARS_IN_CHUNK;
+}
+
+// encode bytes as base64_encoded_size(bytes.size()) characters at out
+inline void base64_encode(ByteSpan bytes, char* out)
+{
+  for (size_t i = 0, j = 0; i < bytes.size(); i += BYTES_IN_BASE64_CHUNK, j += BASE64_CHARS_IN_CHUNK) {
+    size_t num_bytes = std::min<size_t>(BYTES_IN_BASE64_CHUNK, bytes.size() - i);
+    chunk_to_base64(bytes.data() + i, num_bytes, out + j);
+  }
+}
+
+// convert bytes to a base64 string
+inline std::string bytes_to_base64(ByteSpan bytes)
+{
+  std::string base64(base64_encoded_size(bytes.size()), '\0');
+  base64_encode(bytes, &base64[0]);
+  return base64;
+}
+
+// decode a base64 string into out, returning false if it is malformed
+inline bool base64_decode(std::string_view base64, Bytes& out)
+{
+  static const std::array<int8_t, 256> table = [] {
+    std::array<int8_t, 256> t;
+    t.fill(-1);
+    for (int i = 0; i < 26; i++) t['A' + i] = i;
+    for (int i = 0; i < 26; i++) t['a' + i] = 26 + i;
+    for (int i = 0; i < 10; i++) t['0' + i] = 52 + i;
+    t['+'] = 62;
+    t['/'] = 63;
+    return t;
+  }();
+
+  size_t length = base64.size();
+  if (length % BASE64_CHARS_IN_CHUNK != 0) {
+    return false;
+  }
+
+  size_t padding = 0;
+  while (padding < 2 && length > padding && base64[length - 1 - padding] == '=') {
+    padding++;
+  }
+
+  out.resize(length / BASE64_CHARS_IN_CHUNK * BYTES_IN_BASE64_CHUNK);
+  byte* bytes = out.data();
+  for (size_t i = 0, j = 0; i < length; i += BASE64_CHARS_IN_CHUNK, j += BYTES_IN_BASE64_CHUNK) {
+    int c[BASE64_CHARS_IN_CHUNK];
+    for (int n = 0; n < BASE64_CHARS_IN_CHUNK; n++) {
+      c[n] = (i + n >= length - padding) ? 0 : table[(uint8_t) base64[i + n]];
+    }
+    if ((c[0] | c[1] | c[2] | c[3]) < 0) {
+      return false;
+    }
+    uint32_t chunk = (c[0] << 18) | (c[1] << 12) | (c[2] << 6) | c[3];
+    bytes[j] = chunk >> 16;
+    bytes[j + 1] = chunk >> 8;
+    bytes[j + 2] = chunk;
+  }
+  out.resize(out.size() - padding);
+
+  return true;
+}
+
+// convert a base64 string to bytes
+inline Bytes base64_str_to_bytes(std::string_view base64)
+{
+  Bytes bytes;
+  if (!base64_decode(base64, bytes)) {
+    throw std::invalid_argument("bad base64 string input");
+  }
+  return bytes;
+}
+
+#endif
@@ -0,0 +1,287 @@
+#ifndef CRYPTOPALS_INPUT_H
+#define CRYPTOPALS_INPUT_H
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "bytes.h"
+
+#define INPUT_BUFFER_SIZE (4ul << 20)
+
+// reads a file descriptor as string_view chunks or lines without going through iostreams.
+// Regular files are memory-mapped and come back as a single chunk. Pipes and terminals are
+// read by a background thread into two large buffers in turn, so the next buffer fills
+// while the consumer works on the current one.
+class Input {
+public:
+  explicit Input(int fd = STDIN_FILENO);
+  ~Input();
+  Input(const Input&) = delete;
+  Input& operator=(const Input&) = delete;
+
+  // the next chunk of input, or false at the end; the view is valid until the next call
+  bool next_chunk(std::string_view& chunk);
+
+  // the next line without its '\n', or false at the end; valid until the next call
+  bool next_line(std::string_view& line);
+
+  // the whole remaining input as one view, valid for the life of the Input
+  std::string_view read_all();
+
+  // pass over the next count bytes and return how many there were before the end
+  size_t skip(size_t count);
+
+  // bytes handed out or skipped so far
+  size_t position() const { return chunks_total - rest.size(); }
+
+private:
+  // pipe reader thread: fill buffers[0], buffers[1], buffers[0], ... until end of input
+  void fill_buffers();
+
+  int fd;
+
+  // regular files
+  const char* mapping;
+  size_t mapping_size;
+  bool mapping_served;
+
+  // pipes
+  std::thread reader;
+  std::mutex mutex;
+  std::condition_variable changed;
+  Bytes buffers[2];
+  size_t sizes[2];
+  bool filled[2];
+  bool stopping;
+  int read_error;
+  int current;
+  bool holding;
+
+  // size of every chunk returned so far
+  size_t chunks_total;
+  // what is left of the current chunk for next_line, and a line that crossed chunks
+  std::string_view rest;
+  std::string carry;
+  std::string all;
+};
+
+// text with all whitespace removed; a view of text itself unless it has whitespace
+// before its end, in which case the filtered copy is built in scratch
+inline std::string_view strip_whitespace(std::string_view text, std::string& scratch)
+{
+  size_t end = text.size();
+  while (end > 0 && isspace((unsigned char) text[end - 1])) {
+    end--;
+  }
+  text = text.substr(0, end);
+
+  size_t start = 0;
+  while (start < text.size() && !isspace((unsigned char) text[start])) {
+    start++;
+  }
+  if (start == text.size()) {
+    return text;
+  }
+
+  scratch.assign(text.substr(0, start));
+  for (size_t i = start; i < text.size(); i++) {
+    if (!isspace((unsigned char) text[i])) {
+      scratch.push_back(text[i]);
+    }
+  }
+  return scratch;
+}
+
+inline Input::Input(int fd)
+  : fd(fd), mapping(NULL), mapping_size(0), mapping_served(false), sizes{0, 0}, filled{false, false},
+    stopping(false), read_error(0), current(0), holding(false), chunks_total(0)
+{
+  struct stat st;
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+    void* p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p != MAP_FAILED) {
+      madvise(p, st.st_size, MADV_SEQUENTIAL);
+      mapping = static_cast<const char*>(p);
+      mapping_size = st.st_size;
+      return;
+    }
+  }
+
+  // not mappable: a pipe, a terminal or an empty file
+  buffers[0].resize(INPUT_BUFFER_SIZE);
+  buffers[1].resize(INPUT_BUFFER_SIZE);
+  reader = std::thread(&Input::fill_buffers, this);
+}
+
+inline Input::~Input()
+{
+  if (mapping != NULL) {
+    munmap(const_cast<char*>(mapping), mapping_size);
+  }
+  if (reader.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    changed.notify_all();
+    reader.join();
+  }
+}
+
+inline void Input::fill_buffers()
+{
+  bool eof = false;
+  int error = 0;
+  for (int i = 0; ; i ^= 1) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      changed.wait(lock, [&] { return !filled[i] || stopping; });
+      if (stopping) {
+	return;
+      }
+    }
+
+    // fill the whole buffer, since pipes hand over at most their capacity per read; once
+    // the input has ended one empty buffer tells the consumer so
+    size_t size = 0;
+    while (!eof && size < buffers[i].size()) {
+      ssize_t n = read(fd, buffers[i].data() + size, buffers[i].size() - size);
+      if (n < 0 && errno == EINTR) {
+	continue;
+      }
+      if (n <= 0) {
+	eof = true;
+	error = n < 0 ? errno : 0;
+	break;
+      }
+      size += n;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      sizes[i] = size;
+      filled[i] = true;
+      read_error = error;
+    }
+    changed.notify_all();
+    if (eof && size == 0) {
+      return;
+    }
+  }
+}
+
+inline bool Input::next_chunk(std::string_view& chunk)
+{
+  if (mapping != NULL) {
+    if (mapping_served) {
+      return false;
+    }
+    mapping_served = true;
+    chunk = std::string_view(mapping, mapping_size);
+    chunks_total += chunk.size();
+    return true;
+  }
+  if (!reader.joinable()) {
+    return false;
+  }
+
+  std::unique_lock<std::mutex> lock(mutex);
+  // hand the buffer the consumer was working on back to the reader
+  if (holding) {
+    filled[current] = false;
+    current ^= 1;
+    holding = false;
+    changed.notify_all();
+  }
+
+  changed.wait(lock, [&] { return filled[current]; });
+  if (read_error != 0 && sizes[current] == 0) {
+    throw std::runtime_error(std::string("read failed: ") + strerror(read_error));
+  }
+  if (sizes[current] == 0) {
+    return false;
+  }
+  holding = true;
+  chunk = std::string_view((const char*) buffers[current].data(), sizes[current]);
+  chunks_total += chunk.size();
+  return true;
+}
+
+inline bool Input::next_line(std::string_view& line)
+{
+  carry.clear();
+  for (;;) {
+    const char* newline = rest.empty() ? NULL : static_cast<const char*>(memchr(rest.data(), '\n', rest.size()));
+    if (newline != NULL) {
+      size_t length = newline - rest.data();
+      if (carry.empty()) {
+	line = rest.substr(0, length);
+      } else {
+	carry.append(rest.data(), length);
+	line = carry;
+      }
+      rest.remove_prefix(length + 1);
+      return true;
+    }
+
+    // the line continues in the next chunk, which replaces the current buffer
+    carry.append(rest.data(), rest.size());
+    rest = std::string_view();
+    std::string_view chunk;
+    if (!next_chunk(chunk)) {
+      line = carry;
+      return !carry.empty();
+    }
+    rest = chunk;
+  }
+}
+
+inline std::string_view Input::read_all()
+{
+  if (mapping != NULL && !mapping_served && rest.empty()) {
+    mapping_served = true;
+    chunks_total += mapping_size;
+    return std::string_view(mapping, mapping_size);
+  }
+
+  all.assign(rest.data(), rest.size());
+  rest = std::string_view();
+  std::string_view chunk;
+  while (next_chunk(chunk)) {
+    all.append(chunk.data(), chunk.size());
+  }
+  return all;
+}
+
+inline size_t Input::skip(size_t count)
+{
+  // a mapped file is one chunk, so this only reads through pipes
+  size_t skipped = 0;
+  while (skipped < count) {
+    if (rest.empty()) {
+      std::string_view chunk;
+      if (!next_chunk(chunk)) {
+	break;
+      }
+      rest = chunk;
+    }
+    size_t n = std::min(count - skipped, rest.size());
+    rest.remove_prefix(n);
+    skipped += n;
+  }
+  return skipped;
+}
+
+#endif
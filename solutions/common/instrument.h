@@ -0,0 +1,216 @@
+#ifndef CRYPTOPALS_INSTRUMENT_H
+#define CRYPTOPALS_INSTRUMENT_H
+
+// Build with -DCRYPTOPALS_INSTRUMENT to time stages and count events. The report is
+// printed to stderr at exit: a text summary, or JSON when CRYPTOPALS_STATS=json.
+// Without the flag every macro below expands to nothing.
+//
+//   INSTRUMENT_STAGE("name")      time the rest of the enclosing scope as a stage
+//   INSTRUMENT_COUNT("name", n)   add n to a counter
+//
+// Stages may nest, in which case the inner stage's time is also counted in the outer.
+//
+// The instrumented build also replaces the global operator new and delete, to count
+// allocations. Those are ordinary definitions, so an instrumented program must include this
+// header in one translation unit only; every program here is a single .cpp, and a second
+// unit including it fails to link with duplicate definitions.
+
+#ifdef CRYPTOPALS_INSTRUMENT
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <sys/resource.h>
+#include <time.h>
+
+namespace instrument {
+
+// kept outside the registry, which allocates while it is being built
+inline std::atomic<uint64_t> allocations{0};
+
+struct StageStats {
+  std::atomic<uint64_t> calls{0};
+  std::atomic<uint64_t> wall_ns{0};
+  std::atomic<uint64_t> cpu_ns{0};
+};
+
+// all stages and counters of the process; entries are created once per call site and
+// never removed, so call sites keep a pointer and only touch atomics afterwards
+class Registry {
+public:
+  static Registry& get() {
+    static Registry* registry = new Registry();
+    return *registry;
+  }
+
+  StageStats* stage(const char* name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& entry : stages) {
+      if (entry.first == name)
+	return entry.second.get();
+    }
+    stages.emplace_back(name, std::unique_ptr<StageStats>(new StageStats()));
+    return stages.back().second.get();
+  }
+
+  std::atomic<uint64_t>* counter(const char* name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& entry : counters) {
+      if (entry.first == name)
+	return entry.second.get();
+    }
+    counters.emplace_back(name, std::unique_ptr<std::atomic<uint64_t> >(new std::atomic<uint64_t>(0)));
+    return counters.back().second.get();
+  }
+
+  // remember each thread that runs a stage, for the utilization figure
+  void register_thread() {
+    thread_local bool registered = false;
+    if (!registered) {
+      registered = true;
+      num_threads.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  void report();
+
+private:
+  Registry() : start(std::chrono::steady_clock::now()), cpu_start(process_cpu_s()) {
+    std::atexit([] { Registry::get().report(); });
+  }
+
+  static double process_cpu_s() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec
+      + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+  }
+
+  std::mutex mutex;
+  std::vector<std::pair<std::string, std::unique_ptr<StageStats> > > stages;
+  std::vector<std::pair<std::string, std::unique_ptr<std::atomic<uint64_t> > > > counters;
+  std::atomic<uint64_t> num_threads{0};
+  std::chrono::steady_clock::time_point start;
+  double cpu_start;
+};
+
+inline uint64_t thread_cpu_ns()
+{
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// times the scope it lives in and adds the result to a stage
+class ScopeTimer {
+public:
+  explicit ScopeTimer(StageStats* stats)
+    : stats(stats), wall_start(std::chrono::steady_clock::now()), cpu_start(thread_cpu_ns()) {
+    Registry::get().register_thread();
+  }
+  ~ScopeTimer() {
+    uint64_t wall = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - wall_start).count();
+    stats->calls.fetch_add(1, std::memory_order_relaxed);
+    stats->wall_ns.fetch_add(wall, std::memory_order_relaxed);
+    stats->cpu_ns.fetch_add(thread_cpu_ns() - cpu_start, std::memory_order_relaxed);
+  }
+
+private:
+  StageStats* stats;
+  std::chrono::steady_clock::time_point wall_start;
+  uint64_t cpu_start;
+};
+
+inline void Registry::report()
+{
+  std::chrono::duration<double> wall = std::chrono::steady_clock::now() - start;
+  double cpu = process_cpu_s() - cpu_start;
+  uint64_t threads = std::max<uint64_t>(1, num_threads.load());
+  double utilization = cpu / (wall.count() * threads);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  const char* format = std::getenv("CRYPTOPALS_STATS");
+  if (format != NULL && strcmp(format, "json") == 0) {
+    std::cerr << "{\"wall_s\": " << wall.count() << ", \"cpu_s\": " << cpu
+	      << ", \"threads\": " << threads << ", \"utilization\": " << utilization
+	      << ", \"allocations\": " << instrument::allocations.load() << ", \"stages\": {";
+    for (size_t i = 0; i < stages.size(); i++) {
+      StageStats& s = *stages[i].second;
+      std::cerr << (i ? ", " : "") << "\"" << stages[i].first << "\": {\"calls\": " << s.calls.load()
+		<< ", \"wall_s\": " << s.wall_ns.load() / 1e9 << ", \"cpu_s\": " << s.cpu_ns.load() / 1e9 << "}";
+    }
+    std::cerr << "}, \"counters\": {";
+    for (size_t i = 0; i < counters.size(); i++) {
+      std::cerr << (i ? ", " : "") << "\"" << counters[i].first << "\": " << counters[i].second->load();
+    }
+    std::cerr << "}}" << std::endl;
+  } else {
+    std::cerr << "stats: " << wall.count() << " s wall, " << cpu << " s cpu, " << threads << " threads ("
+	      << (int) (utilization * 100) << "% busy), " << instrument::allocations.load() << " allocations" << std::endl;
+    for (auto& entry : stages) {
+      StageStats& s = *entry.second;
+      std::cerr << "  " << entry.first << ": " << s.calls.load() << " calls, "
+		<< s.wall_ns.load() / 1e9 << " s wall, " << s.cpu_ns.load() / 1e9 << " s cpu" << std::endl;
+    }
+    for (auto& entry : counters) {
+      std::cerr << "  " << entry.first << ": " << entry.second->load() << std::endl;
+    }
+  }
+}
+
+} // namespace instrument
+
+// every allocation of an instrumented program is counted
+inline void* instrument_allocate(size_t size, size_t alignment)
+{
+  instrument::allocations.fetch_add(1, std::memory_order_relaxed);
+  void* p = alignment ? std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)
+    : std::malloc(size ? size : 1);
+  if (p == NULL)
+    throw std::bad_alloc();
+  return p;
+}
+
+// kept out of line so gcc pairs each new with a delete, not an inlined malloc or free with
+// its counterpart; the sized forms are defined so none falls through to the library's
+__attribute__((noinline)) void* operator new(size_t size) { return instrument_allocate(size, 0); }
+__attribute__((noinline)) void* operator new(size_t size, std::align_val_t align) { return instrument_allocate(size, (size_t) align); }
+__attribute__((noinline)) void operator delete(void* p) noexcept { std::free(p); }
+__attribute__((noinline)) void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept { std::free(p); }
+__attribute__((noinline)) void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+
+#define INSTRUMENT_CONCAT_(a, b) a##b
+#define INSTRUMENT_CONCAT(a, b) INSTRUMENT_CONCAT_(a, b)
+
+#define INSTRUMENT_STAGE(name)						\
+  static instrument::StageStats* INSTRUMENT_CONCAT(instrument_stage_, __LINE__) = \
+    instrument::Registry::get().stage(name);				\
+  instrument::ScopeTimer INSTRUMENT_CONCAT(instrument_timer_, __LINE__)(INSTRUMENT_CONCAT(instrument_stage_, __LINE__))
+
+#define INSTRUMENT_COUNT(name, n)					\
+  do {									\
+    static std::atomic<uint64_t>* instrument_counter = instrument::Registry::get().counter(name); \
+    instrument_counter->fetch_add((n), std::memory_order_relaxed);	\
+  } while (0)
+
+#else
+
+#define INSTRUMENT_STAGE(name) do {} while (0)
+#define INSTRUMENT_COUNT(name, n) do {} while (0)
+
+#endif
+
+#endif
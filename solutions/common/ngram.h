@@ -0,0 +1,91 @@
+#ifndef CRYPTOPALS_NGRAM_H
+#define CRYPTOPALS_NGRAM_H
+
+#include <array>
+#include <cstdint>
+
+#include "bytes.h"
+
+// bytes are folded into 32 classes for the bigram and trigram tables
+#define NGRAM_CLASS_BITS 5
+#define NGRAM_NUM_CLASSES (1 << NGRAM_CLASS_BITS)
+// table entries are log2 probabilities times NGRAM_SCALE
+#define NGRAM_SCALE 256
+// average log2 probability per byte above which text is taken to be english
+#define NGRAM_ENGLISH_THRESHOLD -14.0
+
+enum NgramClass {
+  // 0 to 25 are the letters, case folded
+  NGRAM_SPACE = 26,
+  NGRAM_LINE_BREAK = 27,
+  NGRAM_DIGIT = 28,
+  NGRAM_PUNCTUATION = 29,
+  NGRAM_OTHER_PRINTABLE = 30,
+  NGRAM_UNPRINTABLE = 31
+};
+
+// class of every byte value
+constexpr std::array<uint8_t, 256> NGRAM_CLASS = [] {
+  std::array<uint8_t, 256> classes{};
+  for (int ch = 0; ch < 256; ch++) {
+    if (ch >= 'a' && ch <= 'z') {
+      classes[ch] = ch - 'a';
+    } else if (ch >= 'A' && ch <= 'Z') {
+      classes[ch] = ch - 'A';
+    } else if (ch == ' ') {
+      classes[ch] = NGRAM_SPACE;
+    } else if (ch == '\n' || ch == '\r' || ch == '\t') {
+      classes[ch] = NGRAM_LINE_BREAK;
+    } else if (ch >= '0' && ch <= '9') {
+      classes[ch] = NGRAM_DIGIT;
+    } else if (ch == '.' || ch == ',' || ch == '\'' || ch == '"' || ch == '-' || ch == ';'
+	       || ch == ':' || ch == '!' || ch == '?' || ch == '(' || ch == ')') {
+      classes[ch] = NGRAM_PUNCTUATION;
+    } else if (ch > ' ' && ch < 127) {
+      classes[ch] = NGRAM_OTHER_PRINTABLE;
+    } else {
+      classes[ch] = NGRAM_UNPRINTABLE;
+    }
+  }
+  return classes;
+}();
+
+#ifndef NGRAM_NO_TABLES
+#include "ngram_tables.h"
+
+// sum of the log2 probabilities of each byte on its own, in NGRAM_SCALE units
+inline int32_t ngram_byte_log_prob(ByteSpan text)
+{
+  int32_t sum = 0;
+  for (size_t i = 0; i < text.size(); i++) {
+    sum += NGRAM_BYTE_LOG_PROB[text[i]];
+  }
+  return sum;
+}
+
+// average log2 probability per byte of text under the byte and trigram models; higher is
+// more english. Every step is a table lookup, so there are no data dependent branches and
+// each trigram index is computed on its own, which leaves the loop open to vectorizing.
+inline double ngram_score(ByteSpan text)
+{
+  size_t n = text.size();
+  if (n == 0) {
+    return NGRAM_BYTE_LOG_PROB[0] / (double) NGRAM_SCALE;
+  }
+
+  const byte* p = text.data();
+  int32_t sum = ngram_byte_log_prob(text);
+  if (n >= 2) {
+    sum += NGRAM_BIGRAM_LOG_PROB[(NGRAM_CLASS[p[0]] << NGRAM_CLASS_BITS) | NGRAM_CLASS[p[1]]];
+  }
+  for (size_t i = 2; i < n; i++) {
+    unsigned index = (NGRAM_CLASS[p[i - 2]] << (2 * NGRAM_CLASS_BITS))
+      | (NGRAM_CLASS[p[i - 1]] << NGRAM_CLASS_BITS) | NGRAM_CLASS[p[i]];
+    sum += NGRAM_TRIGRAM_LOG_PROB[index];
+  }
+
+  return (double) sum / NGRAM_SCALE / n;
+}
+#endif
+
+#endif
@@ -0,0 +1,2144 @@
+// generated by gen/ngrams.cpp from Isaac Newton, Opticks (Project Gutenberg) (567198 bytes); do not edit
+#ifndef CRYPTOPALS_NGRAM_TABLES_H
+#define CRYPTOPALS_NGRAM_TABLES_H
+
+#include <cstdint>
+
+constexpr int16_t NGRAM_BYTE_LOG_PROB[256] = {
+  -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -1519, -4893, -4893, -4893, -4893, -4893,
+  -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893,
+  -650, -4893, -4893, -4893, -4893, -4893, -3448, -2435, -3010, -3010, -4008, -3270, -1581, -2038, -1932, -2645,
+  -2505, -2339, -2529, -2643, -2739, -2726, -2895, -2767, -2834, -2988, -2800, -2522, -4893, -4893, -4893, -3189,
+  -4893, -2165, -2333, -2088, -2537, -2417, -2275, -2420, -2699, -2090, -3560, -3053, -2207, -2427, -2712, -2424,
+  -2039, -3035, -2075, -2097, -2344, -3719, -2792, -2553, -3261, -3257, -3919, -2891, -4637, -2891, -4893, -2063,
+  -4893, -1082, -1606, -1447, -1333, -853, -1431, -1599, -1131, -1099, -2951, -2151, -1319, -1533, -1111, -1066,
+  -1635, -2453, -1127, -1137, -948, -1474, -1946, -1642, -2268, -1628, -3394, -3580, -2612, -4893, -4893, -4893,
+  -4893, -4893, -4893, -4893, -4893, -4893, -3719, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893,
+  -4893, -4893, -4893, -4893, -4893, -4893, -4893, -3919, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893,
+  -4893, -4893, -4893, -4893, -4893, -4893, -3420, -4299, -4893, -4893, -4175, -4893, -4893, -4893, -4893, -4893,
+  -4893, -4893, -4893, -4893, -3407, -4893, -4893, -4231, -4893, -4893, -4893, -4637, -4893, -4893, -4893, -4893,
+  -4893, -4893, -3351, -3204, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893,
+  -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893,
+  -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893,
+  -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893, -4893
+};
+
+constexpr int16_t NGRAM_BIGRAM_LOG_PROB[1024] = {
+  -4376, -2565, -2105, -2401, -4291, -2889, -2628, -4228, -2462, -3975, -2648, -1963, -2399, -1581, -4480, -2431,
+  -3826, -1871, -1945, -1800, -2920, -2703, -3147, -3257, -2258, -4299, -2237, -3045, -4298, -3549, -3427, -7655,
+  -3207, -3324, -3448, -3768, -1979, -4633, -4888, -3825, -2904, -3090, -7013, -2307, -4379, -4376, -2358, -6421,
+  -4892, -2704, -2710, -3559, -2571, -4636, -6505, -4125, -2177, -8212, -3399, -4380, -6691, -3479, -3893, -7655,
+  -2423, -3751, -2861, -3805, -2053, -4173, -4380, -2099, -2389, -4231, -2591, -2618, -6394, -4172, -1927, -4230,
+  -4231, -2760, -3868, -2088, -2575, -6803, -6505, -4892, -3869, -8212, -3308, -4380, -6691, -3200, -3690, -4299,
+  -3035, -4380, -4379, -3019, -2061, -4485, -3207, -4041, -2063, -4125, -4231, -3055, -4173, -4295, -2638, -4634,
+  -4892, -3101, -2752, -3239, -3005, -4125, -6505, -7137, -3090, -8212, -1568, -2488, -6691, -2350, -3893, -7655,
+  -2065, -3203, -2176, -1880, -2233, -2113, -2765, -3569, -2319, -4174, -3219, -2330, -2446, -1820, -3203, -2741,
+  -2778, -1609, -1758, -2161, -4379, -2685, -2920, -2413, -2489, -4299, -1254, -2105, -6691, -2149, -3463, -4637,
+  -2576, -4888, -4633, -6212, -2566, -2756, -3751, -4876, -2305, -7781, -4487, -2512, -4042, -4875, -2196, -6421,
+  -4892, -2110, -4295, -2763, -3110, -6803, -6505, -7137, -3805, -8212, -1719, -2640, -6691, -3223, -3662, -7655,
+  -2938, -6451, -6280, -4230, -2298, -4885, -3613, -2172, -2667, -7781, -4636, -2422, -3637, -3178, -2880, -6421,
+  -4487, -2355, -2819, -3181, -2916, -6803, -6505, -4892, -4081, -8212, -2147, -3045, -6691, -2778, -3676, -7655,
+  -1946, -4380, -6280, -4632, -1351, -4379, -4888, -6019, -1957, -4299, -4892, -4173, -3719, -4628, -2295, -4634,
+  -4637, -2689, -3624, -2263, -3076, -6803, -6505, -7137, -3289, -4893, -1955, -2889, -6691, -2735, -3676, -3531,
+  -2765, -2600, -2096, -2321, -2434, -2392, -2181, -4876, -3324, -7781, -2979, -2274, -2406, -1570, -2013, -3200,
+  -2994, -2125, -1889, -1839, -2998, -2645, -6505, -2788, -6517, -3522, -2537, -3406, -4890, -3164, -3662, -4174,
+  -3892, -6451, -6280, -6212, -3037, -6288, -6454, -6019, -5967, -7781, -4487, -6180, -6394, -5999, -3845, -6421,
+  -7277, -5992, -6003, -4623, -3825, -6803, -6505, -7137, -6517, -8212, -4117, -4887, -6691, -4080, -4636, -7655,
+  -4295, -6451, -4885, -6212, -2552, -4885, -6454, -4377, -2967, -7781, -4892, -3945, -4485, -2813, -4006, -4887,
+  -4381, -5992, -3357, -4623, -6366, -6803, -4486, -7137, -4380, -8212, -2709, -3580, -6691, -2846, -3893, -7655,
+  -2150, -6451, -3975, -2666, -1877, -3068, -3869, -6019, -2060, -4637, -4081, -2023, -3504, -4041, -2122, -3549,
+  -7277, -4079, -2725, -2934, -2459, -3095, -3637, -7137, -2280, -8212, -2069, -2965, -4636, -2854, -3637, -7655,
+  -2175, -2979, -4042, -4883, -2019, -3625, -4486, -4628, -2356, -7781, -4636, -4080, -3185, -3495, -2295, -2655,
+  -4892, -4079, -2817, -4121, -2741, -4891, -6505, -4637, -3289, -8212, -2173, -3167, -4890, -2672, -3427, -4893,
+  -2639, -6451, -2105, -1704, -2022, -3040, -1904, -4876, -2546, -4381, -3719, -3042, -4124, -2936, -2242, -4380,
+  -4082, -4295, -2142, -2027, -2861, -3110, -3751, -4892, -2648, -8212, -1681, -2673, -6691, -2327, -3637, -7655,
+  -3021, -2511, -3045, -2578, -3426, -1723, -2888, -3786, -2827, -4487, -3016, -2114, -2126, -1746, -2733, -2426,
+  -7277, -1887, -2255, -2115, -1903, -2773, -2294, -4892, -3918, -4487, -1887, -2855, -4636, -3101, -3787, -7655,
+  -2152, -6451, -4885, -6212, -2093, -6288, -4634, -2918, -2849, -7781, -7013, -2490, -6394, -4481, -2197, -2563,
+  -4082, -2230, -3351, -2811, -2983, -6803, -3975, -7137, -6517, -8212, -3007, -4081, -4890, -3141, -3363, -7655,
+  -5956, -6451, -4484, -6212, -4858, -4633, -6454, -6019, -5967, -7781, -4487, -6180, -4887, -4875, -5950, -6421,
+  -7277, -3719, -6003, -4623, -2448, -6803, -6505, -7137, -6517, -8212, -3822, -4887, -6691, -3768, -3363, -7655,
+  -1914, -3479, -2637, -2514, -1593, -2831, -2880, -3734, -2073, -4082, -3038, -3090, -2701, -2940, -2031, -2910,
+  -4637, -3079, -2207, -2193, -2824, -2766, -3319, -7137, -2524, -8212, -1757, -2692, -4890, -2227, -3448, -7655,
+  -2518, -4888, -2771, -4883, -1901, -3892, -4634, -2485, -2151, -7781, -3649, -3087, -2501, -4172, -2222, -2444,
+  -3375, -5992, -2157, -1962, -2279, -4125, -3513, -7137, -3294, -8212, -1511, -2450, -6691, -2019, -3231, -4893,
+  -2278, -6451, -3649, -6212, -1855, -6288, -6454, -1261, -1892, -7781, -7013, -2702, -3487, -3751, -1950, -4380,
+  -4082, -2316, -2286, -2565, -2575, -4298, -2553, -4125, -2707, -4637, -1570, -2520, -6691, -2291, -3073, -7655,
+  -2567, -2844, -2511, -3275, -2544, -3265, -2659, -6019, -2857, -7781, -4636, -2418, -2475, -2375, -3231, -2547,
+  -7277, -2068, -2334, -2242, -3689, -4487, -6505, -4487, -4889, -4893, -3323, -4485, -6691, -3649, -4298, -7655,
+  -2643, -6451, -6280, -6212, -2089, -6288, -6454, -6019, -2514, -7781, -7013, -6180, -6394, -4481, -3413, -6421,
+  -7277, -5992, -4481, -4293, -3945, -6803, -4888, -4298, -4174, -8212, -4366, -4485, -6691, -3504, -3751, -7655,
+  -2301, -6451, -6280, -3613, -2380, -6288, -6454, -2038, -2237, -7781, -7013, -3786, -6394, -3084, -2611, -6421,
+  -7277, -3805, -3207, -4478, -6366, -6803, -4486, -7137, -6517, -8212, -2626, -3471, -6691, -2803, -4380, -7655,
+  -3718, -6451, -3203, -6212, -3569, -6288, -6454, -3406, -2798, -7781, -7013, -4484, -6394, -5999, -4873, -2770,
+  -7277, -4376, -6003, -2934, -4886, -4042, -6505, -4487, -3869, -8212, -3226, -4007, -6691, -3101, -3869, -7655,
+  -4376, -4486, -4885, -4883, -2596, -4885, -4634, -4876, -3393, -7781, -4487, -4124, -3945, -4628, -3154, -3735,
+  -7277, -4481, -2416, -5832, -6366, -6803, -6505, -4637, -6517, -4893, -1785, -2690, -6691, -2585, -4042, -7655,
+  -4376, -6451, -6280, -4883, -3845, -6288, -6454, -6019, -4295, -7781, -7013, -4882, -6394, -5999, -3892, -6421,
+  -7277, -5992, -6003, -5832, -4634, -6803, -6505, -7137, -4889, -8212, -3970, -6412, -6691, -4042, -4636, -7655,
+  -1450, -1710, -1887, -2056, -2142, -1902, -2244, -2252, -1638, -3676, -2981, -2018, -1932, -2264, -1550, -1884,
+  -2981, -1871, -1740, -1271, -2442, -2359, -1783, -3504, -2671, -4125, -1737, -6412, -2154, -2998, -2232, -3559,
+  -2412, -2670, -2668, -2811, -2886, -2827, -3087, -3164, -2585, -4381, -3946, -2894, -2813, -3101, -2583, -2636,
+  -3735, -2662, -2559, -2216, -3289, -3284, -2649, -4892, -3602, -4893, -3106, -2417, -3239, -3521, -2703, -4893,
+  -4079, -6451, -6280, -3945, -4619, -6288, -6454, -6019, -4295, -7781, -4487, -4378, -4379, -4481, -4480, -4007,
+  -4637, -4376, -4377, -3055, -6366, -6803, -6505, -7137, -6517, -8212, -2471, -3200, -2121, -2323, -2650, -3540,
+  -3559, -3786, -3704, -2570, -4291, -4042, -3319, -4628, -3786, -7781, -4892, -3918, -3137, -4628, -4294, -3846,
+  -7277, -3917, -2885, -3329, -4886, -6803, -3676, -7137, -6517, -8212, -1481, -2245, -2745, -2168, -2583, -7655,
+  -3368, -3540, -3261, -3649, -3374, -3289, -3137, -3846, -3026, -4125, -4043, -3637, -3487, -3846, -3374, -2994,
+  -3266, -3495, -3463, -3192, -4173, -3441, -4081, -3869, -4174, -4637, -2345, -2832, -2649, -2581, -3181, -4231,
+  -5956, -6451, -6280, -6212, -5741, -6288, -6454, -6019, -4627, -7781, -7013, -6180, -6394, -3530, -4873, -6421,
+  -4637, -4172, -4875, -3891, -6366, -6803, -6505, -7137, -6517, -8212, -3647, -4887, -4298, -3719, -3975, -2973
+};
+
+constexpr int16_t NGRAM_TRIGRAM_LOG_PROB[32768] = {
+  -3908, -2096, -77, -1933, -3823, -2421, -2160, -3760, -1993, -3507, -2180, -1495, -1931, -1113, -4012, -1963,
+  -3357, -1403, -1477, -1332, -2452, -2235, -2679, -2788, -1789, -3830, -1769, -2577, -3830, -3081, -2958, -7186,
+  -3979, -4096, -1085, -2328, -1402, -5404, -2329, -4596, -1666, -3861, -7785, -514, -5151, -5148, -196, -7193,
+  -5664, -1813, -1608, -4330, -3342, -5408, -7277, -1923, -2948, -8983, -1610, -2329, -7463, -1382, -1735, -8426,
+  -3824, -1977, -1002, -2788, -541, -5574, -5781, -1193, -1235, -5633, -966, -1870, -7795, -5573, -2256, -2532,
+  -2383, -4162, -5269, -250, -1497, -8205, -7906, -6293, -5270, -9613, -1841, -5781, -8092, -1938, -2532, -5700,
+  -2489, -2236, -5553, -1275, -352, -2087, -2490, -2087, -1129, -1831, -5405, -4229, -1774, -5469, -788, -2492,
+  -2492, -2235, -2233, -856, -1492, -1724, -7679, -8311, -1575, -9386, -653, -1573, -7865, -1070, -2087, -8828,
+  -1879, -3017, -1990, -640, -2047, -1927, -2579, -3383, -2133, -3988, -3033, -2144, -2260, -1634, -3017, -2555,
+  -2592, -618, -1572, -1975, -4193, -2499, -2734, -2227, -2303, -4113, -556, -1919, -6505, -1963, -406, -4451,
+  -3186, -5498, -5243, -6822, -3176, -1087, -4361, -5486, -2915, -8391, -5097, -3122, -4652, -5485, -1281, -7031,
+  -5502, -2720, -4905, -54, -3720, -7413, -7115, -7747, -4415, -8822, -1457, -3250, -7301, -1599, -1493, -8265,
+  -480, -7156, -6985, -1860, -291, -5590, -4318, -2877, -1022, -8486, -5342, -3127, -1604, -860, -1751, -7126,
+  -5192, -1176, -3524, -3886, -2257, -7509, -7210, -5597, -4786, -8917, -1974, -2259, -7396, -1602, -1454, -8360,
+  -1539, -3973, -5874, -4225, -944, -3972, -4481, -5612, -682, -3892, -4485, -3766, -3312, -4221, -1889, -4227,
+  -4230, -2282, -3217, -1856, -2669, -6397, -6098, -6730, -2882, -4486, -444, -2483, -6284, -460, -718, -3124,
+  -4123, -3958, -3453, -1002, -3792, -3749, -1767, -6234, -4681, -9139, -4337, -1484, -3763, -225, -3371, -4557,
+  -4352, -388, -1830, -1828, -4356, -4003, -7863, -4145, -7874, -4879, -3894, -4764, -6248, -4521, -5020, -5532,
+  -1951, -4510, -4340, -4271, -73, -4348, -4514, -4078, -4027, -5840, -2546, -4239, -4454, -4058, -678, -4481,
+  -5337, -4052, -4063, -2682, -1885, -4863, -4565, -5196, -4576, -6271, -2177, -2947, -4751, -2140, -2695, -5714,
+  -4420, -6576, -5010, -6337, -150, -5010, -6579, -4502, -477, -7906, -5017, -4070, -4610, -1720, -4131, -5012,
+  -4506, -6117, -2233, -4748, -6491, -6929, -4611, -7262, -4505, -8337, -1240, -1986, -6816, -1823, -4018, -7780,
+  -2041, -8094, -2162, -2669, -1710, -1229, -2674, -7662, -1355, -6280, -2674, -318, -1577, -2524, -1449, -5193,
+  -8920, -2335, -886, -1135, -2666, -4739, -1674, -8780, -2159, -9855, -525, -1361, -6279, -1165, -5280, -9298,
+  -1889, -1080, -5035, -5876, -129, -4618, -5479, -5622, -1386, -8774, -5630, -5074, -2491, -4489, -1351, -1681,
+  -5886, -5073, -1114, -5115, -3735, -5885, -7499, -5630, -4282, -9205, -812, -2088, -5884, -1725, -2238, -5886,
+  -2206, -8657, -1028, -223, -1544, -5247, -951, -7083, -1570, -6588, -2906, -3055, -6331, -1520, -1220, -6586,
+  -6288, -6502, -1183, -1411, -3309, -5317, -5958, -7099, -1086, -10419, -833, -1776, -8898, -2648, -3312, -9861,
+  -2476, -1966, -2500, -2034, -2881, -1179, -2343, -3241, -2282, -3943, -2472, -491, -1582, -1202, -2188, -1881,
+  -6733, -1342, -249, -1570, -1358, -2229, -1750, -4348, -3374, -3943, -1343, -2311, -4091, -2556, -3242, -7110,
+  -1335, -7385, -5819, -7146, -367, -7223, -5569, -2054, -1611, -8715, -7948, -3425, -7329, -5416, -1108, -273,
+  -5016, -2411, -1321, -1462, -3918, -7738, -4909, -8071, -7451, -9146, -1694, -5015, -5825, -4075, -4297, -8589,
+  -4659, -5154, -3188, -4915, -3561, -3336, -5157, -4722, -4671, -6484, -3190, -4883, -3590, -3578, -4653, -5125,
+  -5981, -2422, -4706, -3326, -3, -5507, -5208, -5840, -5220, -6915, -2525, -3591, -5395, -2472, -2066, -6358,
+  -1106, -2616, -1516, -966, -521, -4754, -1464, -3022, -1007, -3022, -1195, -1293, -1898, -2210, -2207, -2765,
+  -6560, -1608, -1492, -505, -3019, -4689, -5242, -9060, -1310, -10135, -828, -1679, -6813, -1469, -5371, -9578,
+  -2688, -6725, -1841, -6721, -1085, -5730, -6472, -1901, -1400, -9619, -2353, -4925, -2939, -6010, -1290, -4281,
+  -5213, -7830, -521, -880, -1302, -5963, -5350, -8975, -1412, -10050, -298, -1180, -8529, -2027, -5069, -6731,
+  -2175, -8605, -2282, -8366, -519, -8442, -8608, -1492, -719, -9935, -9167, -4856, -2069, -2837, -1986, -6534,
+  -6236, -2430, -2579, -1207, -1448, -6452, -4707, -6279, -4861, -6791, -273, -1233, -8845, -1813, -5227, -9809,
+  -3068, -3345, -3013, -1972, -3045, -3767, -1205, -6520, -3359, -8283, -1975, -1947, -2977, -1944, -3733, -3049,
+  -7779, -2570, -57, -926, -4191, -4988, -7007, -4989, -5390, -5395, -3825, -4987, -7193, -4151, -4800, -8156,
+  -2143, -6731, -6561, -6492, -85, -6569, -6735, -6299, -690, -8061, -7294, -6460, -6675, -4762, -1216, -6702,
+  -7558, -6273, -4762, -4573, -4226, -7084, -5169, -4579, -4454, -8492, -4646, -4766, -6972, -1784, -2188, -7935,
+  -456, -6588, -6418, -3750, -1706, -6426, -6591, -2175, -1221, -7918, -7151, -3923, -6531, -532, -2748, -6559,
+  -7414, -3942, -681, -4615, -6503, -6941, -4623, -7274, -6654, -8349, -531, -1492, -6828, -1735, -4518, -7792,
+  -3115, -5848, -2600, -5609, -1380, -5685, -5851, -2803, -98, -7178, -6410, -1640, -5791, -5396, -4270, -2167,
+  -6674, -1129, -5400, -2331, -4283, -3439, -5902, -3884, -3266, -7609, -1372, -3404, -6088, -787, -3266, -7052,
+  -5388, -2636, -5897, -5895, -2221, -5897, -5646, -5888, -1824, -8793, -5499, -5136, -4957, -5640, -4166, -4747,
+  -8289, -5493, -206, -6844, -7378, -7816, -7517, -5649, -7529, -5905, -395, -1510, -7703, -1066, -2635, -8667,
+  -1719, -3794, -3623, -2226, -1188, -3631, -3797, -3362, -636, -5124, -4356, -2225, -3737, -3342, -1235, -3764,
+  -4620, -3335, -3346, -3175, -401, -4146, -3848, -4480, -2232, -5555, -1313, -3755, -4034, -381, -1979, -4998,
+  -1802, -1103, -914, -971, -4148, -1011, -907, -1413, -2388, -2656, -4988, -775, -1038, -1738, -1452, -864,
+  -1569, -1043, -864, -1162, -4449, -1204, -1176, -5511, -2250, -6132, -2391, -8418, -2650, -5005, -1888, -5566,
+  -2743, -1081, -803, -902, -3218, -999, -903, -1338, -1831, -4713, -4277, -903, -999, -1846, -1438, -902,
+  -1256, -1253, -874, -1033, -3620, -1188, -1586, -5224, -1849, -5225, -3438, -1820, -3571, -3853, -3035, -5225,
+  -2943, -5314, -5144, -2809, -3483, -5152, -5318, -4882, -3158, -6645, -3351, -3242, -3243, -3345, -3344, -2871,
+  -3501, -3240, -3240, -1919, -5230, -5667, -5369, -6001, -5380, -7076, -135, -2063, -533, -1187, -1514, -2404,
+  -3577, -3804, -3722, -2588, -4309, -4060, -3336, -4646, -3803, -7799, -4910, -3935, -3155, -4646, -4312, -3864,
+  -7295, -3935, -690, -3347, -4904, -6821, -1097, -7155, -6534, -8230, -114, -1323, -1345, -2185, -2600, -7672,
+  -1214, -3152, -2873, -3261, -2986, -2901, -1064, -3458, -2637, -3737, -3654, -3248, -3099, -3458, -2986, -2606,
+  -2877, -3107, -3075, -2804, -3785, -3053, -3693, -1472, -3786, -4249, -613, -1204, -2261, -169, -1463, -3843,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -5003, -714, -387, -3028, -4918, -3516, -3255, -4855, -3089, -4602, -3275, -1170, -3026, -1156, -5107, -3058,
+  -4453, -1021, -445, -1165, -3547, -3330, -3774, -3884, -2885, -4926, -2864, -3672, -4925, -4176, -1689, -8282,
+  -1570, -3341, -3465, -3785, -1264, -4650, -4905, -3841, -1060, -3107, -7030, -61, -4396, -4393, -2375, -6438,
+  -4909, -2721, -2727, -3576, -2588, -4653, -6522, -4142, -2193, -8229, -3416, -4396, -6708, -1168, -3910, -7671,
+  -2488, -3816, -2926, -1046, -1396, -4238, -4445, -2164, -2454, -4296, -2656, -2682, -6459, -4237, -1992, -1452,
+  -4296, -2825, -3933, -2153, -2640, -6868, -6570, -4957, -3934, -8277, -249, -1452, -6756, -534, -790, -4364,
+  -2858, -4203, -1142, -2841, -1884, -4307, -3030, -3864, -1885, -3948, -4054, -2878, -3996, -4118, -2460, -4457,
+  -4715, -2924, -2575, -3062, -167, -3948, -6328, -6960, -2913, -8035, -511, -2310, -6514, -1120, -3716, -7477,
+  -1155, -5270, -912, -1455, -1421, -1137, -1408, -1697, -921, -6241, -5286, -1790, -4513, -1492, -5270, -4808,
+  -4844, -1128, -1590, -883, -6446, -4751, -4986, -4479, -1581, -6365, -320, -1125, -8758, -1711, -5530, -6703,
+  -1587, -3898, -3643, -5222, -1576, -1766, -149, -3886, -1315, -6791, -3497, -1522, -3053, -3886, -1206, -5432,
+  -3903, -1121, -3306, -1773, -2120, -5814, -5516, -6147, -2816, -7222, -729, -1651, -5702, -2233, -2673, -6665,
+  -1633, -5146, -4975, -2925, -993, -3580, -2308, -867, -1362, -6476, -3331, -1117, -2332, -1873, -1575, -5116,
+  -3182, -1050, -1514, -1876, -1611, -5498, -5200, -3587, -2776, -6907, -842, -1740, -5386, -1473, -255, -6350,
+  -1908, -4342, -6242, -4594, -1313, -4341, -4850, -5981, -1919, -4261, -4854, -4135, -3681, -4590, -2257, -4596,
+  -4599, -2651, -3586, -2225, -3038, -6765, -6467, -7099, -3251, -4855, -812, -2851, -6653, -319, -319, -3493,
+  -3681, -1984, -1577, -1978, -1327, -3308, -484, -5792, -4240, -8697, -3895, -416, -3322, -1313, -2929, -4116,
+  -3910, -1724, -1174, -477, -3915, -3561, -7421, -3704, -7433, -4438, -3453, -4322, -5806, -4080, -4578, -5090,
+  -2810, -5369, -5199, -5130, -7, -5207, -5372, -4937, -4886, -6699, -3405, -5098, -5313, -4917, -1537, -5340,
+  -6195, -4911, -4921, -3541, -2743, -5722, -5423, -6055, -5435, -7130, -3036, -3805, -5609, -2999, -3554, -6573,
+  -2174, -4330, -2764, -4092, -432, -2764, -4334, -2256, -847, -5661, -2772, -1825, -2365, -693, -1885, -2767,
+  -2261, -3872, -1237, -2503, -4246, -4683, -2366, -5017, -2260, -6092, -589, -1460, -4571, -726, -1772, -5534,
+  -864, -7751, -5275, -3966, -326, -4368, -5169, -7319, -719, -5937, -5382, -3323, -4804, -5341, -1180, -4850,
+  -8577, -5380, -4026, -4235, -476, -4396, -4937, -8437, -1295, -9512, -3369, -4265, -5936, -2582, -4937, -8955,
+  -1268, -2073, -3135, -3976, -160, -2718, -3579, -3722, -1449, -6874, -3730, -3174, -2278, -2588, -1388, -1749,
+  -3986, -3173, -1910, -3215, -1835, -3984, -5598, -3730, -2382, -7305, -539, -2260, -3984, -1765, -2520, -3986,
+  -2128, -5939, -1594, -1192, -323, -592, -1393, -4365, -587, -3870, -3208, -2531, -3613, -2425, -1731, -3868,
+  -3570, -3784, -1631, -1516, -2350, -2599, -3240, -4381, -2137, -7701, -1170, -2162, -6180, -1816, -3126, -7143,
+  -1332, -3990, -4524, -380, -4905, -3202, -4367, -5265, -2023, -5966, -4495, -1722, -3605, -2482, -956, -3904,
+  -8756, -1376, -3734, -780, -525, -838, -1267, -6371, -2130, -5966, -3366, -4334, -6115, -4580, -5265, -9133,
+  -624, -4922, -3356, -4683, -565, -4760, -3106, -1390, -1321, -6253, -5485, -962, -4866, -2953, -668, -1034,
+  -2553, -702, -1823, -1282, -1455, -5275, -2447, -5609, -4988, -6683, -1479, -2553, -3362, -1612, -1834, -6126,
+  -3828, -4323, -2356, -4084, -2730, -2505, -4326, -3891, -3839, -5653, -2359, -4052, -2759, -2747, -3822, -4293,
+  -5149, -1590, -3875, -2495, -320, -4675, -4377, -5009, -4389, -6084, -1694, -2759, -4563, -247, -1235, -5527,
+  -580, -4570, -3728, -3604, -453, -3922, -3971, -4825, -536, -5172, -4128, -4180, -3792, -4031, -536, -4000,
+  -5728, -4169, -3298, -3284, -1932, -3857, -4410, -8228, -3615, -9303, -1764, -3783, -5981, -1525, -4539, -8745,
+  -3592, -5962, -1184, -5957, -225, -4966, -5708, -3559, -1771, -8855, -4723, -4161, -3576, -5246, -1463, -3518,
+  -4449, -7066, -3231, -552, -3353, -5199, -4587, -8211, -4368, -9286, -1321, -3524, -7765, -739, -4305, -5967,
+  -747, -6855, -4054, -6616, -423, -6693, -6858, -1665, -423, -8185, -7418, -1340, -3891, -4155, -2354, -4784,
+  -4486, -2721, -2690, -2969, -830, -4703, -2957, -4529, -3111, -5041, -1974, -2924, -7095, -935, -3478, -8059,
+  -3417, -811, -3361, -4124, -3394, -4115, -3509, -6869, -3707, -8631, -5486, -1148, -3325, -3225, -4081, -3397,
+  -8127, -1272, -1905, -80, -4539, -5337, -7355, -5337, -5739, -5743, -4173, -5335, -7541, -4499, -5148, -8505,
+  -1139, -4946, -4776, -4707, -584, -4784, -4949, -4514, -115, -6276, -5509, -4675, -4890, -2977, -1908, -4917,
+  -5772, -4488, -2977, -2788, -2441, -5299, -3384, -2794, -2669, -6707, -2861, -2981, -5186, -1999, -2247, -6150,
+  -689, -4839, -4668, -2001, -768, -4676, -4842, -426, -625, -6169, -5401, -2174, -4782, -1472, -999, -4809,
+  -5665, -2193, -1595, -2866, -4754, -5192, -2874, -5525, -4905, -6600, -1014, -1859, -5079, -1191, -2768, -6043,
+  -2286, -5018, -1771, -4780, -2136, -4856, -5022, -1974, -1365, -6349, -5581, -3051, -4962, -4566, -3440, -1337,
+  -5845, -2944, -4571, -1502, -811, -554, -5073, -3055, -2436, -6780, -787, -2575, -5259, -538, -553, -6222,
+  -5469, -5579, -5978, -5976, -3689, -5978, -5727, -5969, -4486, -8874, -5580, -5217, -5038, -5721, -4247, -4828,
+  -8370, -5574, -2440, -6925, -7459, -7897, -7598, -5730, -7610, -5986, -33, -933, -7784, -2117, -5135, -8748,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -549, -729, -2737, -1492, -2991, -2752, -3094, -3101, -834, -4525, -3831, -2867, -2781, -1495, -776, -1487,
+  -3831, -1486, -983, -827, -3292, -3208, -983, -1499, -3521, -4975, -2587, -7262, -3004, -3848, -986, -4409,
+  -563, -1746, -1743, -1886, -1962, -1902, -2163, -2239, -574, -3457, -3021, -1970, -1889, -2177, -1658, -577,
+  -2811, -1738, -1635, -1292, -2364, -2360, -1725, -3968, -2677, -3969, -2182, -1493, -2315, -2597, -580, -3969,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -3646, -3873, -3791, -825, -4378, -4128, -3405, -4715, -3872, -7868, -4979, -4004, -3224, -4715, -4381, -3933,
+  -7364, -4004, -2971, -3416, -4973, -6890, -3762, -7224, -6603, -8298, -102, -902, -2831, -1385, -1410, -7741,
+  -2531, -1020, -1016, -2812, -2537, -1016, -1013, -3008, -2188, -3288, -3205, -2799, -2650, -3008, -2537, -2157,
+  -2428, -2658, -2626, -2355, -3336, -2604, -3244, -3032, -3336, -3800, -586, -755, -1812, -354, -2344, -3394,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -5784, -2212, -3513, -3809, -5699, -4298, -4036, -5636, -3870, -5383, -4056, -656, -901, -730, -5888, -1552,
+  -5234, -952, -777, -928, -553, -1011, -4555, -4665, -1750, -5707, -1750, -4453, -5706, -2470, -2470, -9063,
+  -2808, -2924, -3049, -752, -1579, -4233, -4488, -3425, -2505, -2690, -6614, -1907, -3980, -3977, -1959, -6022,
+  -4493, -2305, -2311, -3159, -2171, -4237, -6106, -3726, -1777, -7812, -183, -1158, -6292, -752, -1157, -7255,
+  -1766, -4397, -3507, -4451, -293, -4819, -5026, -1983, -1765, -4877, -3237, -3264, -7040, -4818, -358, -4876,
+  -4877, -2024, -4514, -2734, -730, -7450, -7151, -2033, -4515, -8858, -3954, -5026, -7337, -3846, -4336, -4945,
+  -2823, -4167, -4167, -2806, -1849, -4272, -2995, -3829, -1850, -3913, -4019, -2843, -3961, -4083, -2425, -4422,
+  -4680, -2889, -2540, -3027, -2793, -3912, -6293, -6925, -2877, -7999, -238, -2275, -6479, -385, -850, -7442,
+  -1864, -5196, -4168, -952, -1292, -4105, -4757, -5561, -1410, -6166, -5211, -1772, -2327, -997, -5195, -1276,
+  -4770, -1333, -604, -4153, -6371, -4677, -4912, -4405, -4481, -6291, -338, -1373, -8683, -820, -2434, -6629,
+  -1949, -4260, -4006, -5585, -1939, -2129, -3124, -4249, -738, -7154, -768, -1885, -3415, -4248, -1568, -5794,
+  -4265, -1483, -3668, -2135, -2483, -6176, -5878, -6510, -3178, -7585, -639, -2013, -6064, -361, -767, -7027,
+  -1971, -5484, -5314, -3263, -1332, -3918, -2646, -1205, -1700, -6814, -3670, -1455, -2670, -2211, -1913, -5455,
+  -3521, -1389, -1852, -2214, -1950, -5837, -5538, -3926, -3114, -7245, -526, -588, -5724, -1811, -338, -6688,
+  -908, -2794, -7949, -2794, -1024, -2538, -6556, -7687, -1791, -5967, -6560, -5841, -2388, -6297, -1747, -6303,
+  -6305, -4357, -5293, -3932, -2792, -8472, -8174, -8805, -2132, -6562, -128, -1020, -8360, -1061, -2388, -5199,
+  -1236, -2498, -3526, -391, -758, -1908, -3611, -6306, -4753, -9211, -4409, -2490, -3836, -1283, -1837, -1059,
+  -4424, -489, -1554, -962, -4428, -4075, -7935, -4218, -7946, -4951, -1457, -2503, -6320, -2503, -1692, -5604,
+  -1722, -4281, -4111, -4043, -868, -4119, -4285, -3849, -3798, -5612, -2318, -4010, -4225, -3830, -1676, -4252,
+  -5108, -3823, -3834, -2454, -1656, -4634, -4336, -4968, -4348, -6043, -706, -2718, -4522, -121, -2467, -5485,
+  -4477, -6633, -5067, -6394, -1249, -5067, -6636, -4559, -2028, -7963, -5074, -1583, -4668, -472, -1417, -5070,
+  -4563, -6175, -913, -4805, -6548, -6986, -1897, -7319, -4562, -8394, -380, -1384, -6873, -648, -2045, -7837,
+  -1675, -7440, -4964, -3656, -134, -4058, -4859, -7008, -691, -5627, -5071, -3012, -4494, -5031, -886, -4539,
+  -8267, -5069, -3715, -3924, -1151, -4085, -4627, -8127, -3270, -9202, -2234, -3955, -5625, -2271, -4627, -8644,
+  -674, -1478, -2541, -3382, -518, -2123, -2984, -3127, -855, -6280, -3135, -2579, -1684, -1994, -794, -1154,
+  -3391, -2578, -1316, -2620, -1240, -3390, -5004, -3136, -1788, -6711, -671, -1666, -3389, -1171, -1926, -3392,
+  -2302, -6113, -1768, -1366, -1684, -2702, -1567, -4538, -2208, -4043, -3382, -2705, -3787, -2599, -1904, -4042,
+  -3744, -3957, -1804, -1689, -2524, -2772, -3414, -4555, -2311, -7874, -158, -2335, -6353, -505, -3299, -7317,
+  -1686, -4421, -2454, -4488, -5336, -3633, -4798, -2019, -2709, -6397, -4926, -400, -629, -424, -2559, -1160,
+  -9187, -1157, -4165, -4025, -1204, -1529, -4204, -6802, -5828, -6397, -2929, -2964, -6546, -2198, -5696, -9565,
+  -1343, -5641, -4075, -5402, -1284, -5479, -3825, -2108, -2040, -6971, -6204, -1681, -5585, -3672, -1387, -1753,
+  -718, -1421, -2541, -2001, -2174, -5994, -3165, -6327, -5707, -7402, -123, -3271, -4081, -2331, -2553, -6845,
+  -4290, -4785, -2819, -4546, -3192, -2968, -4789, -4353, -4302, -6116, -2822, -4514, -3221, -3210, -4284, -4756,
+  -5612, -2053, -4338, -2957, -222, -5138, -4840, -5472, -4851, -6546, -2157, -3222, -5026, -710, -450, -5989,
+  -1131, -4514, -3671, -3548, -440, -3866, -3915, -4769, -586, -5116, -4072, -4124, -3736, -3975, -653, -3944,
+  -5672, -4113, -3242, -3228, -1621, -3801, -4353, -8172, -511, -9247, -1708, -3727, -5925, -3262, -4483, -8689,
+  -2455, -4824, -2707, -4819, -1838, -3829, -4571, -2422, -2087, -7717, -3586, -3023, -2438, -4108, -2158, -2380,
+  -3311, -5929, -2094, -1899, -2215, -4061, -3449, -7073, -3230, -8148, -118, -2386, -6627, -527, -3168, -4829,
+  -1663, -8317, -5515, -8078, -521, -8154, -8320, -3127, -335, -9647, -8879, -1236, -5353, -2143, -2537, -6246,
+  -5948, -1056, -1201, -4431, -1471, -6164, -4419, -5991, -4573, -6503, -803, -1737, -8557, -1010, -4939, -9521,
+  -2300, -1400, -3357, -4120, -3389, -4111, -3505, -6864, -1599, -8627, -5482, -274, -832, -3220, -1194, -3393,
+  -8123, -686, -812, -1159, -1295, -5332, -7351, -5333, -5734, -5739, -4169, -5331, -7537, -4495, -5144, -8500,
+  -733, -4540, -4370, -4301, -179, -4378, -4544, -4108, -604, -5871, -5103, -4269, -4484, -2571, -1502, -4511,
+  -5367, -4082, -2571, -2382, -2035, -4893, -2978, -2388, -2263, -6301, -2455, -2575, -4781, -1593, -1841, -5744,
+  -689, -4839, -4668, -2001, -768, -4676, -4842, -426, -625, -6169, -5401, -2174, -4782, -1472, -999, -4809,
+  -5665, -2193, -1595, -2866, -4754, -5192, -2874, -5525, -4905, -6600, -1014, -1859, -5079, -1191, -2768, -6043,
+  -1731, -4463, -1216, -4224, -1581, -4301, -4466, -1418, -810, -5793, -5026, -2496, -4406, -4011, -2885, -782,
+  -5289, -2389, -4015, -946, -2898, -2055, -4517, -255, -1881, -6224, -1239, -2019, -4703, -1113, -1881, -5667,
+  -3799, -3908, -4307, -4306, -2018, -4307, -4057, -4299, -2816, -7204, -3910, -452, -3368, -4051, -2576, -3158,
+  -6700, -3904, -1839, -5255, -5789, -6226, -5928, -4059, -5939, -4316, -295, -2112, -6114, -528, -3465, -7077,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -563, -868, -1577, -2996, -3081, -2842, -3184, -3191, -640, -4615, -3921, -2957, -1328, -1182, -1318, -1180,
+  -871, -1327, -1177, -982, -3382, -3298, -1178, -4444, -3611, -5065, -2677, -7351, -3094, -3938, -927, -4499,
+  -1487, -1746, -1743, -1886, -1962, -1902, -2163, -2239, -574, -3457, -3021, -1970, -1889, -2177, -1658, -1712,
+  -188, -1738, -1635, -1292, -2364, -2360, -1725, -3968, -2677, -3969, -2182, -1493, -2315, -2597, -1779, -3969,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -3921, -4148, -4066, -2932, -4653, -4404, -3680, -4990, -4147, -8143, -5254, -4279, -3499, -4990, -4656, -4208,
+  -7639, -4279, -1692, -3691, -5248, -7165, -4037, -7499, -6878, -8574, -45, -1281, -3106, -973, -2944, -8016,
+  -2724, -2896, -957, -3005, -2730, -2645, -2493, -3202, -1202, -3481, -1216, -1214, -2843, -960, -2730, -2350,
+  -1209, -2851, -2819, -1207, -3529, -2797, -3437, -3225, -3530, -3993, -539, -948, -2005, -400, -2537, -3587,
+  -3856, -4351, -4181, -4112, -3641, -4189, -4354, -3919, -2527, -5681, -4914, -4080, -4294, -1430, -2773, -4322,
+  -2537, -2072, -2775, -1791, -4266, -4704, -4405, -5037, -4417, -6112, -1547, -2787, -2198, -1619, -1875, -28,
+  -5174, -3362, -2902, -3199, -5089, -3687, -3426, -5026, -3259, -4773, -3446, -2761, -1599, -1779, -5278, -1851,
+  -4623, -48, -1443, -1813, -3718, -3501, -3945, -4054, -1008, -5096, -3034, -3843, -5096, -4347, -4224, -8452,
+  -2244, -2361, -337, -2805, -1016, -3670, -3925, -2862, -1941, -2127, -6050, -1344, -3416, -3413, -1395, -5458,
+  -3929, -1741, -1747, -2596, -1608, -3673, -5542, -3162, -1214, -7249, -592, -3416, -5728, -2516, -594, -6692,
+  -1630, -2958, -588, -3012, -1260, -3380, -3587, -1306, -1597, -3438, -1798, -1825, -5601, -3379, -1134, -3438,
+  -3438, -1967, -3075, -1295, -1782, -6011, -5712, -4099, -3076, -7419, -592, -3587, -5898, -337, -2897, -3506,
+  -3593, -4938, -4937, -3577, -806, -5042, -3765, -4599, -926, -4683, -4789, -124, -4731, -4853, -3195, -5192,
+  -5450, -3659, -3310, -3797, -3563, -4683, -7063, -7695, -1874, -8770, -1086, -1361, -7249, -1855, -4451, -8213,
+  -1884, -5187, -1563, -928, -1410, -1508, -969, -5553, -4303, -6158, -5203, -1884, -2020, -627, -5187, -1451,
+  -2575, -628, -784, -1643, -6363, -4669, -1832, -4397, -4473, -6283, -587, -1690, -8675, -1284, -1832, -6621,
+  -1693, -4004, -512, -5329, -1683, -1873, -2868, -3993, -1422, -6898, -3604, -1629, -3159, -3992, -1312, -5538,
+  -4009, -1227, -3412, -1879, -2227, -5920, -5622, -6254, -2922, -7329, -836, -1757, -5808, -255, -2779, -6771,
+  -3067, -6579, -6409, -4358, -35, -5013, -3741, -2300, -2795, -7910, -4765, -2551, -3765, -3306, -3008, -6550,
+  -4616, -2484, -2947, -3310, -3045, -6932, -6634, -5021, -4210, -8340, -1159, -3174, -6820, -1427, -1433, -7783,
+  -1706, -4140, -6040, -4392, -418, -4139, -4648, -5779, -1718, -4059, -4652, -3933, -3479, -4388, -2056, -4394,
+  -4397, -2449, -3384, -2023, -2836, -6564, -6265, -6897, -3049, -4653, -217, -2650, -6451, -881, -3436, -3291,
+  -824, -4356, -1108, -1312, -816, -887, -1350, -6632, -2830, -9537, -4736, -1141, -1517, -872, -3769, -2236,
+  -4751, -1450, -437, -1853, -1030, -1256, -8261, -4544, -8273, -5278, -4293, -5163, -6647, -4920, -2575, -5931,
+  -146, -4374, -4204, -4136, -961, -4212, -4378, -3942, -3891, -5705, -2411, -4103, -4318, -3922, -1769, -4345,
+  -5201, -3916, -3927, -2546, -1749, -4727, -4429, -5061, -4440, -6135, -798, -810, -4615, -2004, -2560, -5578,
+  -2893, -5049, -3483, -4810, -1150, -3483, -5052, -2975, -1565, -6379, -3490, -2543, -3084, -1412, -2604, -3486,
+  -2979, -4591, -1955, -3221, -4965, -5402, -3084, -5735, -2978, -6810, -1307, -2178, -5290, -296, -312, -6253,
+  -2704, -7005, -4529, -3220, -42, -3622, -4423, -6573, -1420, -5191, -4636, -2577, -4058, -4595, -2676, -4104,
+  -7831, -4634, -3279, -3488, -3013, -3649, -4191, -7691, -921, -8766, -2623, -3519, -5190, -3408, -4191, -8209,
+  -1442, -2246, -3309, -4150, -1286, -2891, -3752, -3895, -100, -7048, -3903, -3347, -2452, -2762, -727, -1922,
+  -4159, -3346, -2084, -3388, -2008, -4158, -5772, -3904, -2556, -7479, -1439, -2434, -4157, -1939, -2694, -4160,
+  -2195, -6007, -1661, -1260, -61, -2596, -1460, -4432, -2102, -3937, -3275, -2599, -3680, -2492, -1798, -3936,
+  -3638, -3851, -1698, -1583, -2417, -2666, -3307, -4448, -2205, -7768, -1237, -2229, -6247, -1883, -3193, -7211,
+  -4221, -3711, -4245, -3778, -1132, -2923, -2254, -4986, -1999, -5687, -4216, -3314, -1209, -1080, -1849, -3625,
+  -8477, -1981, -3455, -1149, -1148, -3973, -313, -6092, -5118, -5687, -482, -1594, -5835, -1210, -2256, -8854,
+  -1030, -5328, -3762, -5089, -971, -5166, -3512, -1796, -1727, -6658, -5891, -1368, -5272, -3359, -350, -1440,
+  -2959, -1108, -2228, -1688, -1861, -5681, -2852, -6014, -5394, -7089, -1884, -2958, -3768, -401, -2240, -6532,
+  -3828, -4323, -2356, -4084, -2730, -2505, -4326, -3891, -3839, -5653, -2359, -4052, -2759, -2747, -3822, -4293,
+  -5149, -1590, -3875, -2495, -320, -4675, -4377, -5009, -4389, -6084, -1694, -2759, -4563, -1640, -231, -5527,
+  -335, -4175, -3332, -3209, -649, -3527, -3576, -4430, -1129, -4777, -3733, -3785, -3397, -3636, -432, -3605,
+  -5333, -3774, -2903, -2889, -3520, -3462, -4014, -7833, -1075, -8908, -2453, -3388, -5586, -1778, -4144, -8350,
+  -3550, -5919, -3803, -5915, -2933, -4924, -5666, -3517, -3183, -8813, -4681, -4119, -3533, -5204, -3253, -3475,
+  -4407, -7024, -3189, -1724, -3311, -5157, -4544, -8169, -4325, -9244, -101, -1223, -7723, -617, -2141, -5925,
+  -2997, -7169, -4368, -6931, -2574, -7007, -7173, -2, -2611, -8500, -7732, -3421, -4206, -4469, -2668, -5098,
+  -4800, -3035, -3004, -3283, -3294, -5017, -3271, -4844, -3426, -5356, -2289, -3238, -7410, -3010, -3792, -8373,
+  -889, -3261, -232, -3692, -701, -3683, -3076, -6436, -3274, -8198, -5054, -1002, -2892, -1289, -3648, -1076,
+  -7694, -1071, -1617, -1847, -4107, -4904, -6922, -4904, -5306, -5310, -3740, -4903, -7108, -4066, -4715, -8072,
+  -389, -5352, -5181, -5113, -174, -5189, -5355, -4920, -1415, -6682, -5914, -5081, -5295, -3382, -2314, -5323,
+  -6178, -4893, -3382, -3194, -2846, -5705, -3790, -3200, -3075, -7113, -3267, -3386, -5592, -2405, -2652, -6556,
+  -689, -4839, -4668, -2001, -768, -4676, -4842, -426, -625, -6169, -5401, -2174, -4782, -1472, -999, -4809,
+  -5665, -2193, -1595, -2866, -4754, -5192, -2874, -5525, -4905, -6600, -1014, -1859, -5079, -1191, -2768, -6043,
+  -1475, -4207, -960, -3968, -1325, -4045, -4210, -1162, -554, -5537, -4770, -2240, -4150, -3755, -2629, -526,
+  -5033, -2133, -3759, -690, -2642, -1799, -4261, -2243, -1625, -5968, -983, -1763, -4447, -857, -1625, -5411,
+  -4558, -4668, -5067, -5065, -2778, -5067, -4817, -5058, -3576, -7963, -4669, -4306, -4128, -4810, -3336, -3917,
+  -7460, -4664, -2599, -6015, -6549, -6986, -6688, -4819, -6699, -5076, -180, -1208, -6874, -392, -4225, -7837,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -842, -856, -1285, -1439, -1487, -1204, -1688, -1547, -891, -2663, -2813, -1275, -1307, -1428, -1045, -1250,
+  -2350, -1310, -1073, -578, -1711, -1582, -1105, -3325, -1795, -3325, -2437, -9087, -1697, -2557, -1628, -6234,
+  -939, -976, -1175, -1431, -1318, -1114, -1811, -1431, -984, -2406, -2406, -1217, -1555, -1406, -1188, -1082,
+  -2405, -1264, -870, -583, -1594, -1638, -1092, -5780, -1811, -5780, -3994, -3305, -1594, -4409, -1742, -5780,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -4767, -4994, -1825, -3778, -5499, -5250, -4527, -2287, -4994, -8989, -6100, -5126, -1419, -5836, -5503, -5054,
+  -8485, -5125, -4093, -4537, -6094, -8012, -2287, -8345, -7725, -9420, -56, -865, -3953, -2125, -1774, -8863,
+  -2531, -2703, -2424, -2812, -765, -2451, -2300, -3008, -2188, -3288, -3205, -2799, -2650, -3008, -2537, -2157,
+  -616, -2658, -2626, -2355, -3336, -2604, -3244, -3032, -3336, -3800, -488, -998, -1812, -419, -2344, -3394,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -6141, -1721, -1286, -869, -6057, -1942, -4393, -5994, -4227, -5741, -1475, -1209, -1014, -1165, -6246, -2314,
+  -5591, -492, -539, -639, -2826, -1548, -4913, -5022, -4023, -6064, -2312, -4810, -6064, -2316, -2572, -9420,
+  -3343, -3460, -3584, -3904, -2115, -4769, -5024, -3960, -3040, -3226, -7149, -1648, -4515, -4512, -1025, -6557,
+  -5028, -1282, -1677, -3695, -971, -4772, -6641, -4261, -79, -8348, -3535, -4515, -6827, -3615, -4029, -7790,
+  -900, -5081, -4191, -5135, -1158, -5503, -5710, -2192, -1085, -5561, -1769, -1997, -7724, -5502, -628, -5560,
+  -2717, -1559, -5198, -219, -1122, -8133, -7835, -6222, -5199, -9542, -2715, -5709, -8021, -2714, -5020, -5629,
+  -4729, -6074, -6073, -2418, -1598, -6179, -1386, -5735, -981, -5819, -5925, -2201, -5868, -2607, -2094, -6328,
+  -6587, -4795, -2065, -2756, -2351, -5819, -8199, -8831, -2756, -9906, -151, -1093, -8385, -674, -3013, -9349,
+  -2397, -2659, -2650, -1032, -4045, -3925, -4577, -5381, -1809, -5986, -986, -1809, -1006, -334, -5015, -1080,
+  -4590, -2616, -951, -859, -6191, -4497, -4732, -4225, -4301, -2254, -767, -1535, -8503, -1741, -2660, -6449,
+  -2010, -6272, -2780, -7597, -2264, -1536, -2118, -6261, -1488, -9166, -2780, -494, -5427, -6260, -653, -7806,
+  -2780, -254, -5680, -1779, -2267, -8188, -7890, -8522, -2524, -9597, -1915, -4025, -8076, -2267, -2779, -9039,
+  -940, -7019, -6849, -4798, -1126, -5453, -1723, -2740, -699, -8349, -5205, -1856, -1535, -1722, -1181, -6990,
+  -5055, -304, -1867, -3749, -740, -7372, -7073, -5460, -4649, -8780, -1699, -3613, -7259, -1128, -2128, -8223,
+  -2154, -4588, -6488, -4840, -500, -1334, -5096, -6227, -143, -4507, -5100, -4381, -3927, -4836, -2504, -4842,
+  -4845, -2897, -3832, -2471, -3284, -7012, -6713, -7345, -3497, -5101, -2164, -3098, -6899, -1329, -3884, -3739,
+  -4265, -2568, -3596, -3821, -3934, -3891, -859, -6376, -4824, -9281, -4479, -3774, -3906, -527, -3513, -4700,
+  -4494, -235, -2298, -916, -4498, -1144, -8005, -4288, -8017, -5021, -4036, -4906, -6390, -2573, -5162, -5674,
+  -1772, -4331, -4160, -4092, -67, -4168, -4334, -3899, -3847, -5661, -2367, -4060, -4274, -3879, -1726, -4302,
+  -5157, -3872, -3883, -2503, -740, -4684, -4385, -5017, -4397, -6092, -1997, -2767, -4571, -1961, -2516, -5535,
+  -3852, -6008, -4442, -5770, -2110, -4442, -6012, -3934, -2525, -7339, -4450, -3503, -4043, -2371, -3563, -4445,
+  -3939, -5550, -2915, -4181, -5924, -6361, -4043, -6695, -3938, -7770, -1148, -3138, -6249, -20, -3450, -7212,
+  -1331, -7727, -5251, -1104, -963, -1201, -5145, -7295, -1473, -5914, -5358, -377, -4781, -5318, -1209, -2157,
+  -8554, -5356, -1295, -1795, -3736, -1272, -4913, -8414, -594, -9489, -877, -1795, -5912, -1517, -2157, -8931,
+  -953, -1561, -4988, -5829, -616, -4571, -5432, -5575, -1017, -8727, -5583, -5027, -2444, -2446, -1103, -1305,
+  -5839, -5026, -961, -5068, -2435, -5837, -7451, -5583, -4235, -9158, -432, -1258, -5837, -685, -4373, -5839,
+  -1621, -8418, -795, -849, -1095, -5008, -1340, -6844, -1711, -6349, -5687, -2223, -6092, -2667, -1701, -6347,
+  -2479, -6263, -811, -510, -1986, -5077, -5719, -6860, -4616, -10179, -519, -1549, -8659, -1176, -5604, -9622,
+  -3658, -3148, -3682, -3215, -4063, -423, -3525, -4423, -3464, -5124, -3653, -2751, -1674, -1167, -3370, -1684,
+  -7914, -461, -2892, -2752, -436, -1690, -2931, -5529, -4555, -5124, -1656, -3492, -5272, -3738, -4423, -8291,
+  -714, -7075, -5509, -6836, -520, -6913, -5259, -1557, -1744, -8405, -7638, -2126, -7019, -5106, -2821, -3187,
+  -4706, -594, -1746, -539, -1557, -7428, -4599, -7761, -7141, -8836, -840, -1641, -5515, -1640, -3987, -8279,
+  -5688, -6183, -4217, -5944, -4590, -4365, -6186, -5751, -5700, -7513, -4219, -5912, -4619, -4607, -5682, -6154,
+  -7009, -3451, -5735, -4355, 0, -6536, -6237, -6869, -6249, -7944, -3554, -4619, -6423, -3500, -3095, -7387,
+  -1221, -2472, -1572, -4698, -624, -1497, -1423, -2142, -1108, -2516, -5222, -2771, -1396, -1804, -2052, -1500,
+  -6821, -2015, -1132, -1423, -5009, -1172, -1731, -9321, -1128, -10396, -438, -1433, -7075, -779, -2398, -9839,
+  -2415, -6913, -1386, -6908, -901, -5918, -6660, -2621, -1494, -9806, -5675, -5112, -4527, -6197, -2724, -1662,
+  -5400, -8018, -683, -959, -2283, -6150, -5538, -9162, -5319, -10237, -313, -1259, -8716, -676, -2416, -6918,
+  -1047, -8244, -5443, -8005, -756, -8082, -8248, -771, -1050, -9574, -8807, -4496, -5281, -5544, -2465, -6173,
+  -5875, -1732, -1246, -1158, -1280, -6092, -724, -5918, -1921, -6431, -484, -1419, -8485, -967, -2731, -9448,
+  -1688, -1965, -1632, -188, -1665, -2387, -1780, -5140, -1978, -6902, -3758, -1540, -1597, -1496, -2352, -575,
+  -6399, -1189, -1455, -1363, -2811, -3608, -5626, -3608, -4010, -4014, -2444, -3607, -5812, -2770, -3420, -6776,
+  -1539, -6749, -6579, -6511, -29, -6587, -6753, -6317, -1204, -8080, -7312, -6478, -6693, -4780, -1397, -6720,
+  -7576, -6291, -4780, -4592, -4244, -7102, -5187, -4597, -4472, -8511, -4664, -4784, -6990, -3802, -4050, -7953,
+  -996, -6813, -6643, -3976, -743, -6651, -6817, -1665, -704, -8144, -7376, -1718, -6757, -1312, -2973, -6784,
+  -7640, -4167, -1000, -1569, -6729, -7166, -4849, -7500, -6880, -8575, -433, -1207, -7054, -651, -4743, -8017,
+  -1307, -6687, -791, -6449, -2220, -6525, -6691, -994, -538, -8018, -7250, -4720, -6631, -6236, -2480, -357,
+  -7514, -4613, -6240, -822, -5123, -4279, -6742, -4724, -4106, -8449, -1188, -1968, -6928, -1531, -4106, -7891,
+  -5157, -5267, -5666, -5664, -519, -5666, -5416, -5657, -2147, -8562, -5268, -4905, -4727, -5409, -1071, -4516,
+  -8058, -5262, -2364, -6614, -7147, -7585, -7286, -5418, -7298, -5674, -172, -1124, -7472, -1485, -2404, -8436,
+  -1719, -3794, -3623, -656, -364, -3631, -3797, -3362, -636, -5124, -4356, -2225, -3737, -3342, -1235, -3764,
+  -4620, -3335, -3346, -3175, -1977, -4146, -3848, -4480, -2232, -5555, -1313, -3755, -4034, -613, -1979, -4998,
+  -952, -1109, -1037, -1247, -1333, -1101, -1425, -1516, -1077, -3044, -2016, -1161, -1179, -1568, -882, -1013,
+  -2267, -943, -861, -861, -1798, -1611, -1227, -3638, -2054, -3639, -2435, -9400, -1753, -2615, -1941, -2788,
+  -987, -1130, -940, -1114, -1213, -1203, -1435, -1584, -1106, -2788, -1976, -1208, -1151, -1570, -987, -898,
+  -2276, -918, -854, -944, -1741, -1663, -1246, -6161, -2069, -2788, -2275, -2065, -1937, -2786, -1936, -6162,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -2338, -2744, -2744, -3979, -2488, -5451, -1976, -6037, -5194, -9190, -6301, -2488, -1364, -6037, -5703, -5255,
+  -8686, -2338, -2149, -4738, -6295, -8212, -2744, -8546, -7926, -9621, -63, -818, -4153, -2707, -1825, -9063,
+  -2944, -3116, -2837, -3225, -2950, -2865, -2713, -3422, -2602, -3701, -3619, -3213, -3063, -3422, -2950, -2570,
+  -2842, -3071, -1433, -1427, -3749, -3017, -3657, -1436, -3750, -4213, -364, -919, -2225, -293, -1427, -3807,
+  -3600, -4095, -3925, -3856, -3385, -3933, -4098, -3663, -2271, -5425, -4658, -3824, -4038, -1174, -2517, -4066,
+  -2281, -1816, -2519, -1535, -4010, -4448, -4149, -4781, -4161, -5856, -1291, -2531, -1942, -1363, -1619, -58,
+  -5631, -3819, -455, -2308, -5546, -4144, -3883, -5483, -743, -5230, -3903, -506, -2308, -2836, -5735, -2308,
+  -5080, -495, -1464, -1592, -4175, -3958, -4402, -4511, -3512, -5554, -2302, -4300, -5553, -2061, -1599, -8909,
+  -1906, -2022, -2147, -2467, -677, -3331, -3586, -2523, -1603, -1788, -5712, -1005, -256, -3075, -1057, -5120,
+  -3591, -1403, -1409, -2257, -1269, -3335, -5204, -2823, -875, -6910, -2097, -3078, -5390, -2177, -2591, -6353,
+  -1441, -2770, -1880, -2824, -1072, -3192, -3398, -1118, -1408, -3250, -1610, -1636, -5413, -3190, -945, -3249,
+  -3250, -1779, -2886, -1107, -1593, -5822, -5524, -3911, -2887, -7230, -404, -3398, -5710, -403, -2708, -3317,
+  -1716, -3061, -3060, -1700, -743, -3166, -1888, -2722, -744, -2806, -2912, -1736, -2855, -2976, -1319, -3315,
+  -3574, -1782, -1434, -1920, -1686, -2806, -5186, -5818, -1771, -6893, -250, -1169, -5372, -1031, -2574, -6336,
+  -1441, -2327, -687, -3360, -748, -3593, -4245, -5049, -1814, -5654, -4699, -1004, -3926, -2302, -4683, -4221,
+  -4258, -291, -913, -3641, -5859, -4165, -1516, -3893, -3969, -5779, -1319, -3585, -8171, -1303, -2327, -6117,
+  -3319, -5631, -5376, -6955, -174, -3499, -4494, -5619, -502, -8524, -5230, -1727, -4785, -2138, -1719, -7165,
+  -5636, -2853, -5038, -3506, -1731, -7547, -7248, -7880, -4549, -8955, -1007, -2126, -7434, -1476, -4405, -8398,
+  -1149, -6048, -5877, -3827, -1895, -4482, -3210, -1769, -2264, -7378, -1158, -2019, -3234, -2775, -2477, -6018,
+  -4084, -1952, -2416, -2778, -2513, -6401, -6102, -4489, -3678, -7809, -205, -2642, -6288, -494, -1157, -7252,
+  -1076, -3510, -5411, -3762, -481, -3509, -4018, -5149, -1088, -3429, -4022, -3303, -2850, -3758, -1426, -3765,
+  -3767, -1819, -2755, -1394, -2206, -5934, -5636, -6267, -2419, -4024, -219, -2020, -5822, -1865, -2806, -2661,
+  -4279, -1670, -730, -3835, -1332, -1115, -692, -6390, -4838, -9295, -4493, -1446, -3920, -752, -3527, -4714,
+  -4508, -405, -2066, -969, -4513, -1371, -8019, -1235, -8031, -5036, -4051, -4920, -6404, -2587, -5177, -5689,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -2686, -4842, -3276, -4604, -944, -3276, -4846, -2768, -1359, -6173, -3284, -2337, -2877, -1205, -2397, -3279,
+  -2773, -4384, -1749, -512, -4758, -5195, -2878, -5529, -2772, -6604, -444, -1972, -5083, -464, -2284, -6046,
+  -1000, -7546, -5070, -3761, -78, -4163, -4964, -7114, -1859, -5732, -5177, -3118, -4599, -5136, -1089, -4645,
+  -8372, -5175, -3821, -4030, -1048, -4191, -4732, -8232, -1864, -9307, -3164, -4060, -5731, -3949, -4732, -8750,
+  -1560, -2364, -3426, -4267, -1404, -3009, -3870, -4013, -1741, -7165, -4021, -3465, -2569, -2880, -1679, -2040,
+  -4277, -3464, -2202, -3506, -2126, -4275, -5890, -4021, -2673, -7596, -279, -2552, -4275, -622, -479, -4277,
+  -1790, -5601, -1256, -854, -226, -2190, -1055, -4026, -1696, -3531, -2870, -2193, -3275, -2087, -1392, -3530,
+  -3232, -3445, -1292, -1177, -2012, -2260, -2902, -4043, -1799, -7362, -832, -1823, -5841, -1477, -2787, -6805,
+  -4662, -4152, -1108, -4220, -5067, -3364, -4529, -5427, -4468, -6129, -4658, -1012, -3767, -3387, -1697, -4067,
+  -8918, -118, -2684, -3756, -707, -4414, -3936, -6533, -5559, -6129, -2661, -4497, -6277, -4742, -5428, -9296,
+  -624, -4922, -3356, -4683, -565, -4760, -3106, -1390, -1321, -6253, -5485, -962, -4866, -2953, -668, -1034,
+  -2553, -702, -1823, -1282, -1455, -5275, -2447, -5609, -4988, -6683, -1479, -2553, -3362, -1612, -1834, -6126,
+  -3828, -4323, -2356, -4084, -2730, -2505, -4326, -3891, -3839, -5653, -2359, -4052, -2759, -2747, -3822, -4293,
+  -5149, -1590, -3875, -2495, -320, -4675, -4377, -5009, -4389, -6084, -1694, -2759, -4563, -1640, -231, -5527,
+  -253, -5163, -4321, -4198, -1536, -4515, -4564, -5418, -1054, -5765, -4721, -4774, -4385, -4624, -319, -4593,
+  -6321, -4762, -3891, -3877, -4508, -4450, -5003, -8821, -4208, -9896, -3441, -4376, -6574, -3911, -5132, -9338,
+  -2070, -4439, -2323, -4435, -1453, -3444, -4186, -2037, -1703, -7333, -3201, -2639, -2053, -3724, -1773, -1995,
+  -2927, -5544, -1709, -1514, -1831, -3677, -3064, -6689, -2845, -7764, -120, -2002, -6243, -631, -2783, -4445,
+  -3471, -7643, -4842, -7404, -120, -7481, -7647, -655, -1613, -8973, -8206, -2128, -4679, -1875, -3142, -5572,
+  -5274, -3509, -3478, -3757, -3767, -5491, -3745, -5317, -2128, -5830, -1004, -3712, -7884, -1535, -4266, -8847,
+  -2880, -3157, -2824, -3588, -2857, -3579, -2972, -6332, -3170, -8094, -4950, -261, -784, -2688, -3544, -2860,
+  -7590, -1357, -379, -2555, -4003, -4800, -6818, -4800, -5202, -5206, -3636, -4798, -7004, -3962, -4611, -7968,
+  -733, -4540, -4370, -4301, -179, -4378, -4544, -4108, -604, -5871, -5103, -4269, -4484, -2571, -1502, -4511,
+  -5367, -4082, -2571, -2382, -2035, -4893, -2978, -2388, -2263, -6301, -2455, -2575, -4781, -1593, -1841, -5744,
+  -689, -4839, -4668, -2001, -768, -4676, -4842, -426, -625, -6169, -5401, -2174, -4782, -1472, -999, -4809,
+  -5665, -2193, -1595, -2866, -4754, -5192, -2874, -5525, -4905, -6600, -1014, -1859, -5079, -1191, -2768, -6043,
+  -1475, -4207, -960, -3968, -1325, -4045, -4210, -1162, -554, -5537, -4770, -2240, -4150, -3755, -2629, -526,
+  -5033, -2133, -3759, -690, -2642, -1799, -4261, -2243, -1625, -5968, -983, -1763, -4447, -857, -1625, -5411,
+  -3859, -3968, -4367, -4366, -2078, -4368, -4117, -4359, -511, -7264, -3970, -3606, -3428, -4111, -2636, -3218,
+  -6760, -3964, -1899, -5315, -5849, -6286, -5988, -4119, -5999, -4376, -233, -1086, -6174, -692, -3525, -7137,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -801, -1610, -1349, -1985, -1508, -1752, -1463, -1821, -1135, -6200, -5506, -1291, -1687, -1768, -1374, -1744,
+  -2662, -1216, -1282, -230, -2199, -1777, -1314, -6028, -1971, -3174, -2762, -8936, -1872, -5523, -2000, -2918,
+  -855, -1402, -1185, -1590, -1367, -1845, -1658, -2250, -1146, -5116, -2253, -1335, -1441, -1995, -1334, -1367,
+  -4470, -951, -1165, -312, -1996, -1535, -1278, -5627, -4337, -5628, -1995, -1587, -1847, -4256, -1990, -5628,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -3898, -4125, -4043, -2909, -4630, -4381, -1672, -4967, -4124, -8120, -5231, -4256, -3476, -4967, -4633, -4185,
+  -7616, -4256, -3223, -3668, -5225, -7142, -4014, -7476, -6855, -8551, -43, -859, -3083, -2506, -2921, -7993,
+  -2751, -2922, -2643, -3031, -2757, -1236, -523, -3228, -2408, -3507, -3425, -3019, -2869, -3228, -2757, -2376,
+  -984, -2877, -2845, -2574, -3556, -2823, -3463, -3251, -3556, -4019, -630, -725, -2032, -426, -2564, -3614,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -5270, -1951, -2999, -3295, -5186, -3784, -1952, -5123, -367, -4870, -3543, -2858, -1947, -795, -5375, -3325,
+  -4720, -867, -2840, -367, -3814, -1699, -4041, -4151, -3152, -5193, -1942, -3939, -5192, -1701, -1956, -8549,
+  -1650, -1766, -1891, -2211, -421, -3075, -3330, -2267, -1347, -1532, -5456, -749, -2822, -2819, -801, -4864,
+  -3335, -1147, -1153, -2001, -1013, -3079, -4948, -2567, -619, -6654, -1841, -2822, -5134, -1921, -2335, -6097,
+  -1036, -2364, -1474, -2418, -666, -2786, -2992, -712, -1002, -2844, -1204, -1230, -5007, -2785, -539, -2843,
+  -2844, -1373, -2481, -701, -1188, -5416, -5118, -3505, -2482, -6825, -1920, -2992, -5304, -1812, -2302, -2911,
+  -2435, -719, -3779, -2418, -1461, -3884, -2607, -3441, -1462, -3525, -3631, -2455, -3573, -3695, -2037, -719,
+  -4292, -2501, -2152, -2639, -2405, -3525, -5905, -6537, -2490, -7612, -379, -1887, -6091, -697, -718, -7054,
+  -1874, -2594, -3923, -917, -3981, -3860, -4512, -2595, -4066, -5922, -4966, -4077, -2000, -696, -2339, -4489,
+  -4525, -929, -649, -827, -6127, -4432, -4667, -4160, -4236, -2595, -450, -1406, -8438, -981, -2595, -6384,
+  -1437, -3748, -3494, -5073, -1427, -1617, -2612, -3737, -1166, -6642, -3348, -1373, -2903, -3736, -1056, -5282,
+  -3753, -971, -3156, -1623, -1971, -5664, -5366, -5998, -2666, -7073, -580, -1501, -5552, -253, -2523, -6515,
+  -2668, -6181, -6011, -3960, -46, -4615, -3343, -1902, -1273, -7511, -4367, -2152, -3367, -2908, -2610, -6152,
+  -4218, -2086, -1279, -2911, -2647, -6534, -6235, -4623, -3811, -7942, -1877, -2775, -6421, -1278, -3406, -7385,
+  -3542, -2316, -7876, -6228, -1759, -5975, -6484, -7615, -3554, -5895, -6488, -2466, -5315, -2722, -2706, -6230,
+  -6233, -4285, -5220, -92, -4672, -8400, -8101, -8733, -4885, -6489, -612, -1615, -8287, -2002, -5272, -5127,
+  -1820, -265, -3249, -3474, -3588, -3545, -3334, -6029, -4477, -8934, -4132, -3427, -3559, -415, -1561, -4353,
+  -4147, -2206, -3042, -1101, -4151, -821, -7658, -3941, -7670, -4675, -3690, -4559, -6043, -2226, -4815, -5327,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -2580, -4736, -3170, -4497, -837, -3170, -4740, -2662, -1252, -6066, -3177, -2230, -2771, -1099, -2291, -3173,
+  -2666, -4278, -1642, -2908, -4652, -5089, -2771, -5422, -2665, -6497, -994, -1865, -4977, -125, -2178, -5940,
+  -195, -7636, -5160, -3851, -493, -4253, -5054, -7204, -1868, -5822, -5267, -3208, -4689, -5226, -1108, -4735,
+  -8462, -5265, -3910, -4119, -2456, -2469, -4822, -8322, -913, -9397, -3254, -4150, -5821, -2466, -2215, -8840,
+  -1213, -2746, -3809, -4650, -262, -3392, -4253, -4396, -1233, -7548, -4404, -3847, -2952, -3262, -2062, -2422,
+  -4660, -3847, -2584, -1268, -2508, -4658, -6272, -4404, -3056, -7979, -983, -2934, -4657, -752, -606, -4660,
+  -868, -7064, -2718, -2317, -312, -3653, -2517, -5489, -439, -4994, -4332, -3656, -4737, -3549, -2855, -4993,
+  -4695, -4908, -2755, -2640, -1206, -3723, -4364, -5505, -3262, -8825, -941, -3286, -7304, -1122, -4250, -8268,
+  -3979, -3469, -4003, -1295, -1015, -1959, -3846, -2015, -681, -5446, -3975, -758, -3084, -1962, -784, -3384,
+  -8235, -1740, -3214, -1602, -1979, -2011, -3253, -5851, -4876, -5446, -472, -1608, -5594, -671, -4745, -8613,
+  -624, -4922, -3356, -4683, -565, -4760, -3106, -1390, -1321, -6253, -5485, -962, -4866, -2953, -668, -1034,
+  -2553, -702, -1823, -1282, -1455, -5275, -2447, -5609, -4988, -6683, -1479, -2553, -3362, -1612, -1834, -6126,
+  -4084, -4579, -2612, -4340, -2986, -2761, -4582, -4147, -4095, -5909, -2615, -4308, -3015, -3003, -4078, -4549,
+  -5405, -1846, -4131, -2751, -576, -4931, -4633, -5265, -4645, -6340, -1950, -3015, -4819, -503, -243, -5783,
+  -1031, -4918, -4076, -3953, -89, -4270, -4319, -5173, -1618, -5521, -4477, -4529, -4140, -4379, -802, -4348,
+  -6076, -4517, -3646, -3632, -4263, -4205, -4758, -8576, -3963, -9651, -2481, -4131, -6329, -1364, -4887, -9094,
+  -3484, -5853, -3737, -5849, -2867, -4858, -5600, -3451, -3117, -8747, -4615, -4053, -3467, -5138, -3187, -3409,
+  -4341, -6958, -3123, -1658, -3245, -5091, -4478, -8103, -4259, -9178, -102, -1075, -7657, -645, -4197, -5859,
+  -3054, -7227, -4425, -6988, -2631, -7065, -7230, -2, -2668, -8557, -7790, -3478, -4263, -4527, -2726, -5156,
+  -4858, -3092, -3062, -3341, -3351, -5074, -3329, -4901, -3483, -5413, -2346, -3296, -7467, -3068, -3849, -8431,
+  -1713, -3349, -3016, -3780, -890, -3771, -3164, -6524, -644, -8286, -5142, -511, -1164, -1206, -837, -3052,
+  -7782, -459, -2839, -2747, -4195, -4992, -7010, -4992, -5394, -5398, -3828, -4991, -7196, -4154, -4804, -8160,
+  -733, -4540, -4370, -4301, -179, -4378, -4544, -4108, -604, -5871, -5103, -4269, -4484, -2571, -1502, -4511,
+  -5367, -4082, -2571, -2382, -2035, -4893, -2978, -2388, -2263, -6301, -2455, -2575, -4781, -1593, -1841, -5744,
+  -689, -4839, -4668, -2001, -768, -4676, -4842, -426, -625, -6169, -5401, -2174, -4782, -1472, -999, -4809,
+  -5665, -2193, -1595, -2866, -4754, -5192, -2874, -5525, -4905, -6600, -1014, -1859, -5079, -1191, -2768, -6043,
+  -1731, -4463, -1216, -4224, -1581, -4301, -4466, -1418, -810, -5793, -5026, -2496, -4406, -4011, -2885, -782,
+  -5289, -2389, -4015, -946, -2898, -2055, -4517, -2499, -1881, -6224, -1239, -2019, -4703, -221, -1881, -5667,
+  -3603, -3712, -4111, -4110, -1822, -4112, -3861, -4103, -2620, -7008, -3714, -3350, -3172, -3855, -2380, -2962,
+  -6504, -850, -1643, -5059, -5593, -6030, -5732, -3863, -5743, -4120, -54, -1916, -5918, -1812, -3269, -6881,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -841, -1240, -1393, -1529, -1280, -1183, -1679, -1640, -935, -5772, -2746, -1588, -1177, -1605, -893, -1210,
+  -2746, -1152, -1080, -469, -1529, -1722, -1234, -5601, -2234, -6222, -2481, -8508, -1896, -2490, -2233, -2490,
+  -930, -1586, -1130, -1336, -1187, -1187, -1337, -1443, -1037, -4713, -4277, -1336, -1254, -1846, -1185, -1186,
+  -1850, -1130, -803, -496, -1338, -3616, -1439, -5224, -3933, -5225, -3438, -2749, -1847, -1849, -1836, -5225,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -4340, -4567, -4485, -2103, -5072, -4823, -1231, -5409, -4567, -8562, -5673, -4699, -3918, -5409, -5075, -4627,
+  -8058, -4698, -3666, -4110, -5667, -7584, -4457, -7918, -7298, -8993, -100, -1196, -3526, -2949, -679, -8436,
+  -2738, -2909, -2630, -3018, -2744, -2658, -1219, -3215, -2395, -3494, -3412, -3006, -2856, -3215, -2744, -2363,
+  -822, -2864, -2832, -2561, -3543, -2810, -3450, -1229, -3543, -4006, -498, -1205, -2019, -252, -2551, -3601,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -6261, -4450, -3990, -1044, -6176, -4774, -4513, -6113, -1481, -5860, -2285, -917, -1624, -610, -2691, -1435,
+  -5710, -1423, -1533, -261, -2690, -933, -5032, -5142, -2933, -6184, -4122, -4930, -6183, -5434, -5312, -9539,
+  -2244, -2361, -2485, -2805, -1016, -3670, -3925, -2862, -585, -2127, -6050, -1344, -3416, -3413, -175, -5458,
+  -3929, -1741, -1747, -2596, -1608, -3673, -5542, -3162, -1214, -7249, -2436, -3416, -5728, -2516, -2930, -6692,
+  -1036, -2364, -1474, -2418, -666, -2786, -2992, -712, -1002, -2844, -1204, -1230, -5007, -2785, -539, -2843,
+  -2844, -1373, -2481, -701, -1188, -5416, -5118, -3505, -2482, -6825, -1920, -2992, -5304, -1812, -2302, -2911,
+  -2122, -3467, -3466, -2106, -1148, -3571, -404, -3128, -1150, -3212, -3318, -2142, -3260, -3382, -1724, -3721,
+  -3979, -2188, -1839, -2326, -2092, -3212, -5592, -6224, -2177, -7299, -254, -1575, -5778, -1437, -2980, -6742,
+  -1868, -5898, -4871, -2179, -2624, -3530, -5459, -6263, -1190, -6869, -5913, -2120, -1361, -1186, -2339, -5436,
+  -5472, -739, -1257, -2076, -7074, -5379, -2136, -5107, -1288, -6993, -186, -989, -9385, -3281, -3136, -7331,
+  -1775, -4087, -3832, -5411, -1765, -1955, -594, -4075, -1504, -6980, -3686, -1711, -3241, -4074, -1395, -5621,
+  -4092, -1309, -3494, -1962, -2309, -6003, -5704, -6336, -3005, -7411, -269, -1839, -5890, -592, -2861, -6854,
+  -1633, -5146, -4975, -2925, -993, -3580, -2308, -867, -1362, -6476, -3331, -1117, -2332, -1873, -1575, -5116,
+  -3182, -1050, -1514, -1876, -1611, -5498, -5200, -3587, -2776, -6907, -187, -1740, -5386, -1473, -2371, -6350,
+  -820, -3254, -5155, -3506, -225, -3253, -3762, -4893, -832, -3173, -3766, -3047, -2594, -3502, -1170, -3509,
+  -3511, -1563, -2499, -1138, -1950, -5678, -5380, -6011, -2163, -3768, -830, -1764, -5566, -1609, -2550, -2405,
+  -2678, -1522, -329, -2673, -2421, -4253, -1934, -6737, -5185, -9642, -2341, -1361, -1889, -721, -2908, -2530,
+  -4856, -1129, -571, -762, -4860, -4506, -8367, -4649, -8378, -2935, -4398, -5268, -2936, -2934, -2680, -6036,
+  -1665, -4224, -4054, -3986, -811, -4062, -4228, -3792, -3741, -5555, -254, -3953, -4168, -3773, -1619, -4195,
+  -5051, -3766, -3777, -2397, -1599, -4577, -4279, -4911, -4291, -5986, -399, -2661, -4465, -1854, -2410, -5428,
+  -2430, -4586, -3020, -4348, -688, -3020, -4590, -2512, -1103, -5917, -3028, -2081, -2621, -949, -2141, -3023,
+  -2517, -4128, -1493, -2759, -4502, -4939, -2622, -5273, -2516, -6348, -188, -1716, -4827, -982, -2028, -5790,
+  -1632, -5932, -3456, -2147, -700, -2549, -3350, -5500, -1541, -4118, -3563, -1504, -2985, -3522, -1604, -3031,
+  -6759, -3561, -2207, -2416, -1941, -2577, -3118, -6618, -169, -7693, -1551, -2446, -4117, -763, -3118, -7136,
+  -1863, -2667, -3729, -4571, -43, -3312, -4173, -4316, -2044, -7469, -4324, -3768, -2873, -3183, -1982, -2343,
+  -4580, -3767, -2505, -3809, -2429, -4579, -6193, -4324, -2976, -7899, -1133, -1185, -4578, -2360, -3114, -4581,
+  -1939, -5751, -1405, -1004, -376, -2340, -1204, -4176, -1846, -3681, -3019, -2343, -3424, -2236, -1542, -3680,
+  -3382, -3595, -1442, -1327, -2161, -2410, -3051, -4192, -1949, -7512, -335, -1973, -5991, -1627, -2937, -6955,
+  -4562, -4052, -2596, -1597, -2597, -3265, -4429, -5327, -2340, -6029, -4558, -643, -1145, -1742, -1879, -2338,
+  -8819, -1079, -331, -1306, -596, -4315, -1160, -6434, -5460, -6029, -1782, -2595, -6177, -2086, -5328, -9196,
+  -1030, -5328, -3762, -5089, -971, -5166, -3512, -1796, -1727, -6658, -5891, -1368, -5272, -3359, -1074, -1440,
+  -2959, -1108, -2228, -1688, -1861, -5681, -2852, -6014, -5394, -7089, -399, -2958, -3768, -401, -2240, -6532,
+  -3977, -4472, -2506, -4234, -2879, -2655, -4476, -4040, -3989, -5803, -2509, -4201, -2908, -2897, -3971, -4443,
+  -5299, -1740, -4025, -2645, -180, -4825, -4527, -5159, -4538, -6234, -398, -2909, -4713, -1790, -1385, -5676,
+  -3020, -4585, -3743, -3620, -462, -3937, -3986, -4841, -1434, -5188, -4144, -4196, -3807, -4046, -138, -4016,
+  -5743, -4185, -3313, -3299, -2202, -3872, -4425, -8243, -3631, -9318, -2863, -3799, -5996, -3333, -4554, -8761,
+  -2688, -5058, -2941, -5053, -2071, -4062, -4804, -2655, -2321, -7951, -3819, -3257, -2672, -4342, -2392, -2614,
+  -3545, -6162, -2327, -678, -2449, -4295, -3683, -7307, -3464, -8382, -226, -1270, -6861, -508, -3401, -5063,
+  -3969, -8142, -5340, -7903, -1327, -7979, -8145, -1597, -2603, -9472, -8704, -2373, -5178, -2118, -3641, -6071,
+  -5773, -4007, -1412, -2626, -4266, -5989, -4244, -5816, -4398, -6328, -119, -1056, -8382, -704, -2629, -9346,
+  -2913, -3190, -2857, -3621, -2890, -3612, -1304, -6365, -3203, -8128, -4983, -2765, -1154, -694, -3578, -2894,
+  -7624, -484, -405, -676, -4036, -4833, -6852, -4834, -1820, -5240, -3670, -4832, -7038, -3996, -4645, -8001,
+  -733, -4540, -4370, -4301, -179, -4378, -4544, -4108, -604, -5871, -5103, -4269, -4484, -2571, -1502, -4511,
+  -5367, -4082, -2571, -2382, -2035, -4893, -2978, -2388, -2263, -6301, -2455, -2575, -4781, -1593, -1841, -5744,
+  -689, -4839, -4668, -2001, -768, -4676, -4842, -426, -625, -6169, -5401, -2174, -4782, -1472, -999, -4809,
+  -5665, -2193, -1595, -2866, -4754, -5192, -2874, -5525, -4905, -6600, -1014, -1859, -5079, -1191, -2768, -6043,
+  -1475, -4207, -960, -3968, -1325, -4045, -4210, -1162, -554, -5537, -4770, -2240, -4150, -3755, -2629, -526,
+  -5033, -2133, -3759, -690, -2642, -1799, -4261, -2243, -1625, -5968, -983, -1763, -4447, -857, -1625, -5411,
+  -4361, -4471, -4870, -4868, -2581, -4870, -4620, -4861, -3379, -7766, -4472, -4109, -947, -4613, -3139, -451,
+  -7263, -4467, -1189, -5818, -6352, -6789, -6490, -4622, -6502, -4878, -289, -1197, -6677, -886, -4028, -7640,
+  -1313, -3388, -3218, -1820, -782, -3226, -3391, -2956, -1232, -4718, -3951, -1819, -3331, -2936, -829, -3359,
+  -4214, -2929, -2940, -2769, -1571, -3741, -3442, -4074, -1826, -5149, -907, -3349, -3628, -979, -246, -4592,
+  -641, -1166, -1226, -1493, -1379, -1324, -1625, -1604, -901, -5964, -2681, -1575, -1264, -1734, -873, -1090,
+  -2219, -1458, -1244, -562, -2087, -1734, -1012, -5792, -2276, -2682, -4025, -8700, -2530, -2219, -2275, -5847,
+  -702, -1341, -1086, -1409, -1154, -1342, -1492, -1492, -774, -4867, -4432, -1597, -1409, -2000, -958, -1029,
+  -4221, -1594, -1086, -606, -2002, -2002, -1004, -5379, -4088, -5379, -3593, -2904, -2002, -2004, -3190, -5379,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -4383, -4610, -4528, -629, -5115, -4866, -4143, -5452, -4610, -8605, -5716, -1753, -3961, -5452, -5118, -4670,
+  -8101, -4741, -2154, -4153, -5710, -7627, -2159, -7961, -7341, -9036, -121, -955, -3569, -2122, -2147, -8479,
+  -2738, -2909, -2630, -3018, -2744, -2658, -2507, -3215, -2395, -3494, -3412, -3006, -2856, -3215, -2744, -2363,
+  -2635, -2864, -2832, -2561, -3543, -2810, -3450, -3238, -3543, -4006, -249, -2202, -2019, -279, -2551, -3601,
+  -4566, -5061, -4890, -4822, -4351, -4898, -5064, -4629, -3237, -6391, -5623, -4790, -5004, -2140, -3483, -5031,
+  -3247, -2782, -3485, -2501, -4976, -5414, -5115, -5747, -5127, -6822, -2257, -3497, -2908, -2329, -2585, -4,
+  -5443, -2123, -1464, -3468, -5358, -3956, -3694, -5295, -3528, -5042, -3715, -815, -286, -1078, -5547, -3497,
+  -4892, -2938, -3012, -424, -3987, -3770, -4214, -4323, -3324, -5365, -1866, -4112, -5365, -1723, -1467, -8721,
+  -3943, -2291, -4184, -4504, -812, -5369, -5624, -4561, -538, -3826, -7750, -246, -5116, -2294, -3094, -7158,
+  -5629, -794, -3446, -4295, -1523, -5372, -7241, -4861, -2913, -8948, -4135, -5116, -7427, -2037, -4629, -8391,
+  -994, -5161, -4272, -5215, -1359, -5583, -5790, -250, -1108, -5642, -646, -1023, -7805, -5582, -2501, -5641,
+  -5642, -2028, -5278, -1637, -928, -8214, -7915, -6303, -5279, -9622, -1912, -2392, -8101, -2029, -5100, -2285,
+  -4289, -5634, -5633, -817, -183, -5738, -2571, -5295, -1651, -5379, -5485, -4309, -5427, -5549, -3892, -5888,
+  -6146, -2570, -1466, -4493, -4259, -5379, -7759, -8391, -4344, -9466, -610, -1448, -7945, -1210, -5147, -8909,
+  -3676, -4815, -1458, -793, -3845, -1944, -4376, -5180, -3930, -5786, -4830, -1647, -4057, -797, -4814, -4353,
+  -4389, -1685, -194, -1317, -5991, -2052, -912, -4024, -4100, -5910, -1597, -3717, -8302, -3760, -5074, -6248,
+  -3683, -5994, -5739, -7319, -927, -588, -4858, -5983, -971, -8888, -5594, -1837, -5149, -5982, -1148, -7528,
+  -5999, -3217, -5402, -917, -4216, -7910, -7612, -8244, -1502, -9319, -288, -1271, -7798, -4330, -4769, -8761,
+  -2703, -7601, -7431, -5381, -2108, -6036, -1468, -102, -1468, -8932, -2712, -3573, -4788, -1232, -1219, -7572,
+  -5638, -2671, -3969, -4332, -1080, -7954, -7656, -6043, -5232, -9363, -2420, -4196, -7842, -979, -4827, -8805,
+  -1076, -3510, -5411, -3762, -96, -3509, -4018, -5149, -1088, -3429, -4022, -3303, -2850, -3758, -1426, -3765,
+  -3767, -1819, -2755, -1394, -2206, -5934, -5636, -6267, -2419, -4024, -1086, -2020, -5822, -1865, -2806, -2661,
+  -3265, -3100, -2596, -2821, -2935, -2892, -2681, -5376, -507, -8281, -3479, -2774, -2906, -2070, -2513, -3700,
+  -3494, -2625, -1536, -2339, -3498, -3145, -7005, -3288, -7017, -4022, -1061, -1318, -5390, -168, -4162, -4674,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -4090, -6246, -4680, -6007, -23, -4680, -6250, -4172, -1395, -7577, -4687, -3740, -4281, -2609, -3801, -4683,
+  -4177, -5788, -3152, -1915, -6162, -6599, -4281, -6932, -4176, -8007, -1386, -3375, -6487, -1867, -3688, -7450,
+  -1167, -7784, -5308, -2359, -1131, -4401, -5202, -7352, -870, -5970, -2107, -231, -2619, -5374, -1493, -4882,
+  -8610, -5412, -1257, -4267, -1328, -1167, -4970, -8470, -1061, -9545, -987, -1851, -2619, -1446, -2619, -8988,
+  -502, -1569, -5028, -5869, -296, -4611, -5472, -5615, -945, -8768, -5623, -5067, -1107, -2486, -1439, -814,
+  -5879, -5066, -2079, -5108, -3728, -5878, -7492, -5623, -4275, -9198, -1712, -4154, -5877, -1823, -4413, -5879,
+  -1448, -8668, -863, -1308, -918, -1885, -455, -7093, -1577, -6598, -2323, -2405, -3323, -1805, -1951, -6597,
+  -3323, -6512, -1475, -827, -1607, -2375, -2405, -7109, -4866, -10429, -490, -1428, -8908, -1525, -5854, -9872,
+  -4845, -4334, -4869, -2621, -5250, -3547, -4712, -5609, -4650, -6311, -4840, -858, -2028, -72, -4556, -4249,
+  -9101, -1508, -2866, -2860, -1079, -4597, -4118, -6716, -5742, -6311, -2462, -4679, -6459, -2879, -2474, -9478,
+  -878, -6619, -5053, -6381, -717, -6457, -4803, -3087, -977, -7950, -7182, -479, -6563, -4650, -1412, -1032,
+  -4250, -775, -1102, -884, -3152, -6972, -4144, -7306, -6685, -8381, -1183, -4250, -5059, -3309, -1291, -7823,
+  -5473, -5968, -4002, -5729, -4375, -4150, -5971, -5536, -5484, -7298, -4004, -5697, -4404, -4392, -5467, -5939,
+  -6794, -3236, -5520, -4140, -5, -6321, -6022, -6654, -6034, -7729, -1894, -4404, -6208, -1893, -2880, -7172,
+  -2730, -5148, -754, -982, -1042, -4500, -4549, -5404, -1136, -5751, -4707, -4759, -1794, -4609, -1564, -4579,
+  -6306, -1610, -623, -1488, -4493, -4436, -4988, -8806, -2509, -9881, -378, -1275, -6560, -1026, -2363, -9324,
+  -2117, -6781, -1552, -3004, -1195, -2118, -6528, -1027, -1434, -9675, -2236, -2086, -776, -6066, -2739, -1574,
+  -2492, -7886, -1326, -646, -4173, -6019, -5406, -9031, -5187, -10106, -318, -1189, -8585, -1200, -1748, -3004,
+  -1731, -8566, -1967, -8327, -774, -8404, -8570, -551, -949, -9896, -9129, -2797, -5603, -2799, -2787, -6495,
+  -6197, -1649, -789, -1014, -1432, -6414, -4668, -6241, -968, -3055, -573, -1561, -8807, -1137, -5189, -9770,
+  -2990, -3267, -2934, -3698, -2967, -3689, -3083, -6442, -3281, -8205, -5060, -2842, -64, -2798, -3655, -2971,
+  -7701, -2492, -692, -2666, -4113, -4910, -6929, -4911, -5312, -5317, -3747, -4909, -7115, -4073, -4722, -8078,
+  -1724, -6789, -6619, -6550, -65, -6627, -6793, -6357, -803, -8119, -7352, -6518, -6733, -4820, -3751, -6760,
+  -7616, -6331, -4820, -4631, -4284, -7142, -5227, -4637, -4512, -8550, -4704, -4824, -7030, -1202, -4090, -7993,
+  -689, -4839, -4668, -2001, -768, -4676, -4842, -426, -625, -6169, -5401, -2174, -4782, -1472, -999, -4809,
+  -5665, -2193, -1595, -2866, -4754, -5192, -2874, -5525, -4905, -6600, -1014, -1859, -5079, -1191, -2768, -6043,
+  -3581, -6313, -3066, -6075, -838, -6151, -6317, -3269, -900, -7644, -6876, -4346, -6257, -5861, -4735, -2632,
+  -7140, -4239, -5866, -363, -4749, -3905, -6368, -4350, -3732, -8075, -692, -1387, -6554, -502, -3732, -7517,
+  -2752, -2862, -3261, -3259, -972, -3261, -3011, -3252, -1769, -6157, -2863, -2500, -2322, -3004, -1530, -2111,
+  -5653, -2857, -793, -4209, -4742, -5180, -4881, -3013, -4893, -3269, -161, -1066, -5067, -961, -2419, -6031,
+  -968, -4512, -4342, -2945, -374, -4350, -4516, -4080, -1112, -5843, -5075, -2944, -4456, -4060, -375, -4483,
+  -5339, -4054, -4065, -3894, -2695, -4865, -4567, -5199, -2950, -6274, -2032, -4474, -4753, -710, -2698, -5716,
+  -1166, -2091, -695, -1077, -2098, -833, -1471, -721, -1586, -5383, -1545, -1438, -1013, -1762, -1214, -1088,
+  -1762, -1438, -890, -1032, -1357, -1545, -1198, -5211, -4378, -5832, -3444, -8119, -3861, -1845, -3939, -5266,
+  -2386, -2645, -896, -978, -1484, -897, -1086, -774, -2559, -4355, -3920, -1484, -724, -1488, -1473, -977,
+  -3709, -1229, -976, -1069, -3263, -1236, -1229, -4867, -3576, -4867, -3081, -1077, -3214, -3496, -2678, -4867,
+  -2537, -4909, -4738, -2403, -3077, -4746, -4912, -4477, -2753, -6239, -2945, -2836, -2837, -2939, -2938, -2465,
+  -3095, -2834, -2835, -1513, -4824, -5261, -4963, -5595, -4975, -6670, -929, -1658, -579, -176, -1108, -1998,
+  -3956, -4184, -4101, -814, -4689, -4439, -3716, -5026, -4183, -8178, -5289, -4315, -3535, -5025, -4692, -4244,
+  -7674, -4314, -3282, -3726, -5284, -7201, -4073, -7534, -6914, -8609, -313, -343, -3142, -2565, -1012, -8052,
+  -2751, -2922, -2643, -3031, -2757, -2671, -2520, -3228, -2408, -3507, -3425, -3019, -2869, -3228, -2757, -2376,
+  -2648, -2877, -2845, -2574, -3556, -2823, -3463, -1242, -3556, -4019, -630, -1218, -2032, -117, -2564, -3614,
+  -3962, -4457, -4287, -4218, -3747, -4295, -4461, -4025, -2634, -5787, -5020, -4186, -4401, -1537, -2879, -4428,
+  -2643, -2178, -2882, -1897, -4373, -4810, -4512, -5143, -4523, -6218, -1654, -2894, -2305, -1725, -1982, -21,
+  -4337, -2526, -48, -2362, -4253, -2851, -2589, -4190, -2423, -3937, -2610, -1925, -2360, -1542, -4442, -2392,
+  -3787, -1832, -1907, -1761, -1022, -2664, -3108, -3218, -2219, -4260, -2198, -3006, -4259, -3511, -3388, -7616,
+  -1650, -1766, -1891, -2211, -421, -3075, -3330, -2267, -1347, -1532, -5456, -749, -2822, -2819, -801, -4864,
+  -3335, -1147, -1153, -2001, -1013, -3079, -4948, -2567, -619, -6654, -1841, -2822, -5134, -1921, -2335, -6097,
+  -1036, -2364, -1474, -2418, -666, -2786, -2992, -712, -1002, -2844, -1204, -1230, -5007, -2785, -539, -2843,
+  -2844, -1373, -2481, -701, -1188, -5416, -5118, -3505, -2482, -6825, -1920, -2992, -5304, -1812, -2302, -2911,
+  -1716, -3061, -3060, -1700, -743, -3166, -1888, -2722, -744, -2806, -2912, -1736, -2855, -2976, -1319, -3315,
+  -3574, -1782, -1434, -1920, -1686, -2806, -5186, -5818, -1771, -6893, -250, -1169, -5372, -1031, -2574, -6336,
+  -3075, -4213, -5, -2890, -3243, -3123, -3775, -4579, -3329, -5184, -4229, -3340, -3456, -2830, -4213, -3751,
+  -3788, -2619, -2768, -3171, -5389, -3695, -3930, -3423, -3499, -5309, -1752, -3115, -7701, -3159, -4473, -5647,
+  -1181, -3492, -3238, -4817, -1171, -1361, -2356, -3481, -910, -6386, -3092, -1117, -2647, -3480, -800, -5026,
+  -3497, -715, -2900, -1367, -1715, -5408, -5110, -5742, -2410, -6817, -324, -1245, -5296, -1828, -2267, -6259,
+  -1377, -4890, -4719, -2669, -737, -3324, -2052, -611, -1106, -6220, -3075, -861, -2076, -1617, -1319, -4860,
+  -2926, -794, -1258, -1620, -1355, -5242, -4944, -3331, -2520, -6651, -586, -1484, -5130, -1217, -2115, -6094,
+  -820, -3254, -5155, -3506, -225, -3253, -3762, -4893, -832, -3173, -3766, -3047, -2594, -3502, -1170, -3509,
+  -3511, -1563, -2499, -1138, -1950, -5678, -5380, -6011, -2163, -3768, -830, -1764, -5566, -1609, -2550, -2405,
+  -1691, -1526, -1021, -1246, -1360, -1317, -1107, -3802, -2249, -6707, -1905, -1200, -1332, -496, -939, -2125,
+  -1920, -1050, -815, -764, -1924, -1571, -5431, -1713, -5442, -2447, -1462, -2332, -3816, -2089, -2588, -3100,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -2686, -4842, -3276, -4604, -944, -3276, -4846, -2768, -1359, -6173, -3284, -2337, -2877, -1205, -2397, -3279,
+  -2773, -4384, -1749, -3015, -4758, -5195, -2878, -5529, -2772, -6604, -82, -1972, -5083, -1238, -2284, -6046,
+  -864, -5164, -2688, -1379, -590, -1781, -2582, -4732, -773, -3350, -2795, -736, -2217, -2754, -836, -2263,
+  -5991, -2793, -1439, -1648, -1173, -1809, -2350, -5850, -994, -6925, -783, -1678, -3349, -1567, -2350, -6368,
+  -674, -1478, -2541, -3382, -518, -2123, -2984, -3127, -855, -6280, -3135, -2579, -1684, -1994, -794, -1154,
+  -3391, -2578, -1316, -2620, -1240, -3390, -5004, -3136, -1788, -6711, -671, -1666, -3389, -1171, -1926, -3392,
+  -1534, -5345, -1000, -598, -916, -1934, -799, -3770, -1440, -3275, -2614, -1937, -3019, -1831, -1136, -3274,
+  -2976, -3189, -1036, -921, -1756, -2004, -2646, -3787, -1543, -7106, -576, -1567, -5585, -1221, -2531, -6549,
+  -3032, -2522, -3056, -2589, -3437, -1734, -2899, -3797, -120, -4498, -3027, -2125, -2137, -1757, -2744, -2437,
+  -7288, -649, -1053, -2126, -1914, -2784, -2305, -4903, -3929, -4498, -1898, -2866, -4647, -3112, -3798, -7666,
+  -624, -4922, -3356, -4683, -565, -4760, -3106, -1390, -1321, -6253, -5485, -962, -4866, -2953, -668, -1034,
+  -2553, -702, -1823, -1282, -1455, -5275, -2447, -5609, -4988, -6683, -1479, -2553, -3362, -1612, -1834, -6126,
+  -3572, -4067, -2100, -3828, -2474, -2249, -4070, -3635, -3583, -5397, -2103, -3796, -2503, -2491, -3566, -4037,
+  -4893, -1334, -3619, -2239, -64, -4419, -4121, -4753, -4133, -5828, -1438, -2503, -4307, -1384, -979, -5271,
+  -815, -2380, -1538, -1415, -494, -1732, -1781, -2635, -973, -2982, -1938, -1990, -1602, -1841, -932, -1810,
+  -3538, -1979, -1108, -1094, -1725, -1667, -2220, -6038, -1425, -7113, -658, -1593, -3791, -1128, -2349, -6555,
+  -1408, -3778, -1661, -3773, -791, -2782, -3524, -1375, -1041, -6671, -2539, -1977, -1392, -3062, -1112, -1334,
+  -2265, -4882, -1047, -852, -1169, -3015, -2403, -6027, -2184, -7102, -401, -1340, -5581, -909, -2121, -3783,
+  -1745, -5917, -3116, -5679, -1322, -5755, -5921, -727, -1359, -7248, -6480, -2169, -2954, -3217, -1416, -3846,
+  -3548, -1783, -1752, -2031, -2042, -3765, -2019, -3592, -2174, -4104, -118, -1986, -6158, -1758, -2540, -7121,
+  -2181, -2458, -2125, -575, -2158, -2880, -2273, -5633, -1079, -7395, -4251, -1060, -2090, -816, -2845, -570,
+  -6892, -1682, -420, -1857, -3304, -4101, -6120, -4101, -4503, -4507, -2938, -4100, -6306, -3264, -3913, -7269,
+  -733, -4540, -4370, -4301, -179, -4378, -4544, -4108, -604, -5871, -5103, -4269, -4484, -2571, -1502, -4511,
+  -5367, -4082, -2571, -2382, -2035, -4893, -2978, -2388, -2263, -6301, -2455, -2575, -4781, -1593, -1841, -5744,
+  -689, -4839, -4668, -2001, -768, -4676, -4842, -426, -625, -6169, -5401, -2174, -4782, -1472, -999, -4809,
+  -5665, -2193, -1595, -2866, -4754, -5192, -2874, -5525, -4905, -6600, -1014, -1859, -5079, -1191, -2768, -6043,
+  -1475, -4207, -960, -3968, -1325, -4045, -4210, -1162, -554, -5537, -4770, -2240, -4150, -3755, -2629, -526,
+  -5033, -2133, -3759, -690, -2642, -1799, -4261, -2243, -1625, -5968, -983, -1763, -4447, -857, -1625, -5411,
+  -2752, -2862, -3261, -3259, -972, -3261, -3011, -3252, -1769, -6157, -2863, -2500, -2322, -3004, -1530, -2111,
+  -5653, -2857, -793, -4209, -4742, -5180, -4881, -3013, -4893, -3269, -161, -1066, -5067, -961, -2419, -6031,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -535, -545, -2049, -2218, -2303, -2064, -2406, -2413, -787, -3837, -3143, -2179, -2093, -2425, -1712, -2045,
+  -3143, -2032, -1901, -383, -2604, -2520, -1945, -3665, -2833, -4287, -1899, -6573, -2316, -3160, -2394, -3721,
+  -224, -1407, -1405, -1548, -1623, -1564, -1824, -1901, -1322, -3118, -2683, -1632, -1550, -1838, -1320, -1373,
+  -2472, -1399, -1296, -954, -2026, -2021, -1386, -3629, -2339, -3630, -1844, -1155, -1977, -2259, -1440, -3630,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -3074, -3301, -3219, -2085, -3806, -3557, -2834, -4143, -3301, -7296, -4407, -3433, -2652, -4143, -3810, -3361,
+  -6792, -3432, -2400, -2844, -4401, -6319, -3191, -6652, -6032, -7727, -12, -1760, -2260, -1683, -2098, -7170,
+  -1913, -2084, -1805, -2193, -1919, -1833, -1682, -2390, -1570, -2669, -2587, -2181, -2031, -2390, -1919, -1538,
+  -1810, -2039, -2007, -1736, -2718, -1985, -2625, -2413, -2718, -3181, -318, -380, -1194, -1126, -1726, -2776,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -3975, -403, -1704, -2000, -3890, -2489, -2227, -3828, -2061, -3574, -2248, -1563, -1998, -1180, -4079, -2030,
+  -3425, -1470, -245, -1399, -2519, -2302, -2746, -2856, -1857, -3898, -1836, -2644, -3897, -3148, -3026, -7254,
+  -1650, -1766, -1891, -2211, -421, -3075, -3330, -2267, -1347, -1532, -5456, -749, -2822, -2819, -801, -4864,
+  -3335, -1147, -1153, -2001, -1013, -3079, -4948, -2567, -619, -6654, -1841, -2822, -5134, -1921, -2335, -6097,
+  -1292, -2620, -1730, -2674, -922, -3042, -3248, -968, -1258, -3100, -1460, -243, -5263, -3041, -795, -3099,
+  -3100, -1629, -2737, -957, -1444, -5672, -5374, -3761, -2738, -7081, -2176, -3248, -5560, -2068, -2558, -3167,
+  -1716, -3061, -3060, -1700, -743, -3166, -1888, -2722, -744, -2806, -2912, -1736, -2855, -2976, -1319, -3315,
+  -3574, -1782, -1434, -1920, -1686, -2806, -5186, -5818, -1771, -6893, -250, -1169, -5372, -1031, -2574, -6336,
+  -3559, -4697, -3670, -1050, -1235, -3607, -4259, -5063, -3813, -5668, -4713, -3824, -3940, -800, -4697, -1829,
+  -4272, -1007, -935, -3655, -5873, -4179, -2085, -3907, -2084, -5792, -220, -1073, -8185, -1341, -4957, -6131,
+  -1437, -3748, -3494, -5073, -1427, -1617, -2612, -3737, -1166, -6642, -3348, -1373, -2903, -3736, -1056, -5282,
+  -3753, -971, -3156, -1623, -1971, -5664, -5366, -5998, -2666, -7073, -580, -1501, -5552, -253, -2523, -6515,
+  -1377, -4890, -4719, -2669, -737, -3324, -2052, -611, -1106, -6220, -3075, -861, -2076, -1617, -1319, -4860,
+  -2926, -794, -1258, -1620, -1355, -5242, -4944, -3331, -2520, -6651, -586, -1484, -5130, -1217, -2115, -6094,
+  -1415, -3849, -5749, -4101, -820, -3848, -4357, -5487, -1426, -3768, -4361, -3642, -3188, -4097, -1764, -338,
+  -4106, -2158, -3093, -1732, -2545, -6272, -5974, -6606, -2758, -4362, -1424, -2358, -6160, -2204, -338, -3000,
+  -3619, -3454, -2950, -3174, -1519, -3245, -3035, -5730, -4177, -8635, -3833, -1518, -3260, -16, -2867, -4053,
+  -3848, -2979, -2743, -2692, -3852, -3499, -7359, -3642, -7370, -4375, -1921, -4260, -5744, -4018, -4516, -5028,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -2430, -4586, -3020, -4348, -688, -3020, -4590, -2512, -1103, -5917, -3028, -2081, -2621, -949, -2141, -3023,
+  -2517, -4128, -1493, -2759, -4502, -4939, -2622, -5273, -2516, -6348, -845, -1716, -4827, -208, -2028, -5790,
+  -1838, -6139, -3663, -2354, -907, -2756, -3557, -5707, -932, -4325, -3770, -1711, -3192, -3729, -1810, -3238,
+  -6965, -3768, -2413, -2622, -2147, -2784, -3325, -6825, -252, -7900, -933, -2653, -4324, -716, -974, -7343,
+  -457, -1990, -3053, -3894, -213, -2635, -3496, -3639, -1367, -6792, -3647, -3091, -2196, -2506, -1306, -1666,
+  -3903, -3090, -1828, -3132, -1752, -3902, -5516, -3648, -2300, -7223, -1183, -2178, -3901, -1683, -2438, -3904,
+  -3615, -7426, -3081, -2679, -209, -4015, -2880, -5851, -477, -5356, -4695, -4018, -5100, -3912, -709, -5355,
+  -2081, -5270, -3117, -2052, -3837, -4085, -4727, -5868, -3624, -9187, -2657, -3648, -7667, -3302, -4612, -8630,
+  -2882, -2372, -2906, -2440, -3287, -1584, -2749, -3647, -2688, -4348, -2878, -1975, -1987, -27, -2594, -2287,
+  -7138, -1748, -2117, -1976, -1764, -2634, -2156, -4753, -3779, -4349, -1749, -2717, -4497, -2962, -3648, -7516,
+  -880, -5178, -3612, -4939, -821, -5016, -3362, -1646, -1577, -6509, -5741, -1218, -5122, -3209, -924, -1290,
+  -2809, -958, -2079, -1538, -1711, -5531, -2703, -5865, -5244, -6939, -1735, -2809, -3618, -1868, -253, -6382,
+  -4166, -4661, -2695, -4422, -3068, -2843, -4664, -4229, -4178, -5991, -2697, -4390, -3097, -3085, -4160, -4632,
+  -5487, -185, -4213, -2833, -658, -5014, -4715, -5347, -4727, -6422, -2032, -3097, -4901, -1979, -569, -5865,
+  -815, -2380, -1538, -1415, -494, -1732, -1781, -2635, -973, -2982, -1938, -1990, -1602, -1841, -932, -1810,
+  -3538, -1979, -1108, -1094, -1725, -1667, -2220, -6038, -1425, -7113, -658, -1593, -3791, -1128, -2349, -6555,
+  -2950, -1542, -3203, -5315, -1501, -4324, -5066, -2917, -728, -8213, -4081, -3519, -2933, -4603, -2653, -2875,
+  -3807, -6424, -2589, -2394, -2711, -4557, -3944, -7569, -3725, -8644, -348, -822, -7123, -416, -3663, -5325,
+  -1745, -5917, -3116, -5679, -1322, -5755, -5921, -277, -1359, -7248, -6480, -2169, -2954, -3217, -1416, -3846,
+  -3548, -1783, -1752, -2031, -2042, -3765, -2019, -3592, -2174, -4104, -1036, -1986, -6158, -1758, -405, -7121,
+  -1094, -1371, -1038, -1802, -1071, -1792, -1186, -4546, -1384, -6308, -3163, -945, -1002, -902, -1758, -1074,
+  -5804, -595, -861, -769, -2216, -3014, -5032, -3014, -3416, -3420, -1850, -3012, -5218, -2176, -2825, -6182,
+  -733, -4540, -4370, -4301, -179, -4378, -4544, -4108, -604, -5871, -5103, -4269, -4484, -2571, -1502, -4511,
+  -5367, -4082, -2571, -2382, -2035, -4893, -2978, -2388, -2263, -6301, -2455, -2575, -4781, -1593, -1841, -5744,
+  -88, -5351, -5180, -2513, -1280, -5188, -5354, -938, -1137, -6681, -5913, -2686, -5294, -1984, -1511, -5321,
+  -6177, -2705, -2107, -3378, -5266, -5704, -3386, -6037, -5417, -7112, -1526, -2371, -5591, -1703, -3280, -6555,
+  -1475, -4207, -960, -3968, -1325, -4045, -4210, -1162, -554, -5537, -4770, -2240, -4150, -3755, -2629, -526,
+  -5033, -2133, -3759, -690, -2642, -1799, -4261, -2243, -1625, -5968, -983, -1763, -4447, -857, -1625, -5411,
+  -3347, -3456, -3855, -3854, -1566, -3856, -3605, -3847, -2364, -6752, -3458, -3094, -2916, -3599, -2124, -2706,
+  -6248, -3452, -1387, -4803, -5337, -5774, -5476, -3607, -5487, -3864, -410, -1660, -5662, -180, -3013, -6625,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -747, -1266, -771, -2177, -2179, -1298, -1590, -1590, -928, -5211, -4516, -941, -1465, -1299, -980, -1266,
+  -2184, -996, -893, -821, -1590, -1672, -1372, -5039, -4206, -5660, -1773, -7947, -3689, -4533, -1590, -5094,
+  -1051, -912, -912, -1312, -1063, -2631, -2892, -2968, -1303, -4186, -3750, -727, -2618, -1318, -2387, -912,
+  -3540, -1059, -910, -900, -3093, -1320, -2454, -4697, -3406, -4698, -2911, -723, -3044, -3326, -2508, -4698,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -4272, -2048, -4417, -1533, -5004, -4754, -2046, -5341, -4498, -8494, -5605, -4630, -3850, -5341, -5007, -4559,
+  -7990, -4630, -714, -4042, -5599, -7516, -4388, -7850, -7229, -8924, -121, -873, -3457, -1773, -1786, -8367,
+  -2531, -2703, -2424, -2812, -2537, -2451, -2300, -3008, -2188, -3288, -3205, -2799, -2650, -3008, -2537, -2157,
+  -2428, -2658, -2626, -2355, -3336, -2604, -3244, -3032, -3336, -3800, -410, -1995, -1812, -168, -2344, -3394,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -6056, -2335, -624, -2229, -5972, -4570, -4308, -5909, -1196, -5656, -4329, -3644, -1371, -917, -6161, -2334,
+  -5506, -713, -415, -679, -4600, -2739, -1719, -2742, -1655, -5979, -2332, -4725, -5979, -1975, -1975, -9335,
+  -1650, -1766, -1891, -2211, -421, -3075, -3330, -2267, -1347, -1532, -5456, -749, -2822, -2819, -801, -4864,
+  -3335, -1147, -1153, -2001, -1013, -3079, -4948, -2567, -619, -6654, -1841, -2822, -5134, -1921, -2335, -6097,
+  -282, -3311, -2421, -3365, -1613, -947, -3940, -1659, -429, -3791, -2151, -2178, -5954, -3732, -1487, -3790,
+  -3791, -2320, -3428, -1648, -933, -6364, -6065, -4452, -3429, -7772, -2868, -3940, -6251, -2760, -3250, -3859,
+  -3944, -5289, -5288, -3928, -1503, -5394, -4117, -4950, -1704, -5034, -5141, -3964, -5083, -5204, -1714, -5544,
+  -5802, -2225, -1377, -4149, -3914, -5034, -7414, -8046, -3999, -9121, -81, -1103, -7600, -914, -4802, -8564,
+  -1077, -3016, -852, -1504, -3008, -2015, -2354, -5738, -3010, -6343, -5388, -1267, -2130, -946, -3016, -4910,
+  -4947, -1609, -628, -825, -6548, -2422, -2760, -1079, -3012, -6467, -498, -1422, -8860, -988, -2611, -6806,
+  -3009, -5320, -5065, -6644, -2998, -3188, -4184, -5308, -2737, -8213, -4919, -2944, -4475, -5308, -2628, -6854,
+  -5325, -2543, -1233, -1231, -3542, -7236, -6938, -7569, -4238, -8644, -133, -1107, -7124, -639, -4095, -8087,
+  -71, -5936, -5766, -3715, -766, -4370, -3098, -1657, -2152, -7266, -4122, -1907, -3122, -2663, -2365, -5907,
+  -3973, -1841, -2304, -2666, -2402, -6289, -5990, -4378, -3566, -7697, -1632, -2530, -6176, -2263, -3161, -7140,
+  -820, -3254, -5155, -3506, -225, -3253, -3762, -4893, -832, -3173, -3766, -3047, -2594, -3502, -1170, -3509,
+  -3511, -1563, -2499, -1138, -1950, -5678, -5380, -6011, -2163, -3768, -830, -1764, -5566, -1609, -2550, -2405,
+  -2238, -2574, -1589, -1453, -1589, -2021, -336, -6635, -5083, -9540, -964, -4033, -1367, -646, -2563, -2022,
+  -939, -3884, -1253, -727, -2239, -1727, -8264, -4547, -8276, -2428, -2826, -5165, -6649, -4923, -5421, -5934,
+  -1409, -3968, -3798, -3730, -555, -3806, -3972, -3536, -3485, -5299, -2005, -3697, -3912, -3517, -1363, -3939,
+  -4795, -3510, -3521, -148, -1343, -4321, -4023, -4655, -4035, -5730, -1635, -2405, -4209, -1598, -2154, -5172,
+  -3025, -5181, -3615, -4942, -1282, -3615, -5184, -3107, -1697, -6511, -3622, -2675, -3215, -1543, -2736, -3617,
+  -3111, -4722, -588, -3353, -5096, -5534, -3216, -5867, -3110, -6942, -420, -2310, -5421, -326, -2623, -6385,
+  -1781, -8035, -5559, -4250, -927, -4652, -5453, -7603, -1306, -6221, -5666, -3607, -5088, -2359, -731, -5134,
+  -8861, -5664, -1764, -4518, -1008, -4680, -5221, -8721, -885, -9796, -249, -1181, -6220, -1335, -5221, -9239,
+  -2072, -2876, -3938, -4779, -1916, -3521, -4382, -4525, -1363, -7677, -1398, -3977, -3081, -1396, -53, -2552,
+  -4789, -3976, -2714, -4018, -2638, -4787, -6402, -4533, -3185, -8108, -1342, -3064, -1398, -2568, -3323, -4789,
+  -2419, -6231, -1885, -1483, -32, -2820, -1684, -4656, -2326, -4161, -3499, -2822, -3904, -2716, -2022, -4160,
+  -3861, -4075, -1922, -1807, -2641, -2890, -3531, -4672, -2428, -7992, -1461, -2453, -6471, -2107, -3417, -7435,
+  -2052, -1437, -1824, -2512, -5141, -2715, -1853, -5500, -4541, -6202, -4731, -3828, -3841, -985, -1271, -2051,
+  -8992, -1821, -1153, -1852, -213, -2768, -542, -6607, -2771, -6202, -2250, -2768, -6350, -2770, -5501, -9369,
+  -1977, -6275, -4709, -6037, -1918, -6113, -4459, -40, -2674, -7606, -6838, -2315, -6219, -4306, -2021, -2387,
+  -3906, -2055, -3176, -2635, -2808, -6628, -3800, -6962, -6341, -8037, -945, -3906, -4715, -2965, -3188, -7479,
+  -3572, -4067, -2100, -3828, -2474, -2249, -4070, -3635, -3583, -5397, -2103, -3796, -2503, -2491, -3566, -4037,
+  -4893, -1334, -3619, -2239, -64, -4419, -4121, -4753, -4133, -5828, -1438, -2503, -4307, -1384, -979, -5271,
+  -1665, -3230, -2388, -2265, -237, -2582, -2631, -3486, -1824, -3833, -2789, -2841, -2452, -2691, -1782, -2661,
+  -4388, -2830, -439, -1944, -2575, -2517, -3070, -6888, -2276, -7963, -1508, -2444, -4642, -1978, -850, -7406,
+  -1909, -5946, -3830, -5942, -993, -4951, -5693, -3544, -1651, -8840, -4708, -4146, -3560, -5231, -326, -3502,
+  -4434, -7051, -3216, -888, -3338, -5184, -4571, -8196, -4352, -9271, -470, -1505, -7750, -806, -4290, -5952,
+  -3300, -7472, -4671, -7233, -523, -7310, -7475, -1001, -1011, -8802, -8035, -1075, -4508, -4772, -1443, -5401,
+  -5103, -1364, -1148, -3586, -3596, -5320, -3574, -5146, -1554, -5658, -418, -1447, -7712, -771, -4095, -8676,
+  -3528, -3805, -1054, -1434, -329, -4227, -3620, -6980, -1081, -8742, -2434, -3380, -493, -2404, -2431, -3508,
+  -8239, -3029, -830, -934, -4651, -2029, -7467, -5449, -5850, -5855, -4285, -5447, -7653, -4611, -5260, -8616,
+  -1130, -6341, -6170, -6102, -43, -6178, -6344, -5909, -1127, -7671, -6903, -6070, -6284, -4371, -3303, -6312,
+  -7167, -5882, -4371, -4183, -3835, -6694, -4779, -4189, -4064, -8102, -4256, -1800, -6581, -3394, -1798, -7545,
+  -10, -6107, -5937, -3269, -2036, -5945, -6110, -1695, -1893, -7437, -6670, -3442, -6051, -2740, -2267, -6078,
+  -6933, -3461, -2863, -4134, -6022, -6460, -4142, -6793, -6173, -7868, -2282, -3127, -6347, -2459, -4037, -7311,
+  -1475, -4207, -960, -3968, -1325, -4045, -4210, -1162, -554, -5537, -4770, -2240, -4150, -3755, -2629, -526,
+  -5033, -2133, -3759, -690, -2642, -1799, -4261, -2243, -1625, -5968, -983, -1763, -4447, -857, -1625, -5411,
+  -5365, -2613, -5874, -5872, -3585, -5874, -5624, -5865, -1665, -8770, -5476, -5113, -4935, -5617, -4143, -4724,
+  -8266, -5470, -1888, -6822, -7355, -7793, -7494, -5626, -7506, -5882, -106, -968, -7680, -679, -5032, -8644,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -932, -748, -1142, -1358, -1568, -1490, -1607, -1580, -1119, -5850, -2162, -1344, -1183, -1522, -957, -1044,
+  -2162, -1088, -1032, -578, -1300, -1800, -1379, -5678, -2823, -6299, -2805, -8586, -2818, -2824, -2566, -5734,
+  -1076, -905, -1117, -1210, -1267, -1161, -1671, -3575, -1159, -4792, -4357, -1416, -1161, -1671, -1043, -756,
+  -4146, -1043, -861, -770, -1268, -1672, -1265, -5303, -1673, -5304, -1925, -2829, -3651, -1928, -3114, -5304,
+  -2687, -5058, -4888, -2553, -3227, -4896, -5062, -4626, -2902, -6389, -3095, -2986, -2987, -3089, -3088, -2615,
+  -3245, -2984, -2984, -1663, -4974, -5411, -5113, -5745, -5124, -6820, -1079, -1807, -728, -108, -1258, -2148,
+  -1379, -4492, -4409, -1377, -2041, -4747, -1784, -5334, -4491, -8486, -5597, -4623, -2038, -5333, -5000, -2040,
+  -7983, -4622, -1321, -2039, -5592, -7509, -4381, -7842, -7222, -8917, -84, -866, -3450, -2004, -2028, -8360,
+  -2775, -2947, -2668, -3056, -2781, -2696, -1006, -3253, -2432, -3532, -3449, -3043, -2894, -3253, -2781, -2401,
+  -2672, -2902, -2870, -2599, -3580, -2848, -3488, -1267, -3581, -4044, -966, -999, -2056, -108, -2588, -3638,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -6031, -1998, -3760, -629, -5947, -4545, -740, -5884, -1304, -2462, -673, -992, -4054, -700, -6136, -4086,
+  -5481, -1592, -1903, -1028, -4575, -4359, -4803, -4912, -620, -5954, -3892, -4700, -5954, -5205, -5082, -9310,
+  -1912, -3682, -3806, -4127, -156, -4991, -5246, -4183, -1196, -3448, -7372, -994, -4738, -4735, -2716, -6780,
+  -5251, -891, -1505, -3917, -2929, -4994, -6863, -4483, -2535, -8570, -869, -1916, -7049, -1403, -4251, -8013,
+  -1921, -3250, -2360, -3303, -1552, -3672, -3878, -1598, -1888, -3730, -2090, -2116, -5893, -3670, -1425, -3729,
+  -630, -2259, -3366, -1586, -2073, -6302, -6003, -4391, -3367, -7710, -373, -3878, -6189, -883, -480, -3797,
+  -1972, -3317, -256, -1956, -999, -3422, -2144, -2978, -1000, -3062, -3168, -1992, -3111, -3232, -1575, -3571,
+  -3830, -2038, -1690, -2176, -1942, -3062, -5442, -6074, -2027, -7149, -506, -1425, -5628, -1287, -2830, -6592,
+  -995, -5230, -2360, -848, -1530, -4139, -4791, -5595, -4346, -6201, -5245, -1827, -2467, -681, -5230, -4768,
+  -4804, -962, -938, -708, -6406, -4711, -2617, -4439, -4515, -6325, -462, -1225, -8717, -1362, -5490, -6663,
+  -2461, -4772, -4518, -6097, -36, -2641, -3636, -4761, -2190, -7666, -4372, -2397, -3927, -4760, -2080, -6306,
+  -4777, -1995, -4180, -2647, -2995, -6688, -6390, -7022, -3690, -8097, -954, -2525, -6576, -3108, -3547, -7539,
+  -1889, -5402, -5231, -3181, -1249, -3836, -2564, -1123, -1618, -6732, -3587, -1373, -2588, -2129, -1831, -5372,
+  -3438, -1306, -1770, -2132, -1867, -5754, -5456, -3843, -3032, -7163, -82, -1996, -5642, -1729, -2627, -6606,
+  -1226, -3660, -5561, -3912, -631, -3659, -4168, -5299, -1238, -3579, -4172, -3453, -2999, -3908, -1576, -3914,
+  -3917, -1969, -2904, -1544, -2356, -6084, -5785, -6417, -2569, -4173, -131, -2170, -5971, -2015, -2956, -2811,
+  -4228, -4063, -1561, -760, -2277, -3855, -919, -6339, -4787, -9244, -4442, -1490, -3869, -411, -3476, -4663,
+  -4457, -3588, -1001, -686, -4461, -4108, -7968, -621, -7980, -4985, -4000, -4869, -6353, -1590, -2025, -5637,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -2580, -4736, -3170, -4497, -837, -3170, -4740, -2662, -1252, -6066, -3177, -2230, -2771, -1099, -2291, -3173,
+  -2666, -4278, -1642, -2908, -4652, -5089, -2771, -5422, -2665, -6497, -994, -1865, -4977, -1132, -148, -5940,
+  -1714, -6014, -3539, -2230, -1441, -2632, -3433, -5582, -1624, -4201, -3645, -1586, -3068, -3605, -1686, -3113,
+  -6841, -3643, -2289, -2498, -2023, -2659, -3201, -6701, -36, -7776, -1633, -2529, -4200, -2418, -3201, -7218,
+  -2386, -3190, -4252, -5093, -356, -3835, -4696, -4839, -988, -7992, -4847, -4291, -3395, -3706, -313, -2866,
+  -5103, -4290, -3028, -4332, -825, -5102, -6716, -4847, -3499, -8422, -2383, -3378, -5101, -2883, -3637, -1712,
+  -2939, -6751, -2405, -2004, -2322, -3340, -1366, -1406, -1399, -4681, -4020, -3343, -4425, -3236, -2542, -4680,
+  -4382, -4595, -993, -2327, -3162, -3410, -4052, -5193, -2949, -8512, -261, -2973, -6991, -685, -594, -7955,
+  -2342, -4053, -2597, -1474, -4968, -3265, -1154, -5328, -1748, -6029, -1937, -2332, -1828, -912, -1511, -3968,
+  -8819, -394, -531, -704, -1550, -1086, -3837, -6434, -5460, -6029, -2077, -2341, -2599, -1880, -5329, -9197,
+  -719, -7161, -5595, -6922, -968, -6999, -5345, -1830, -1320, -8491, -7724, -1034, -7105, -1983, -271, -3273,
+  -4792, -848, -1981, -1132, -1214, -7514, -4685, -7847, -7227, -8922, -1725, -4791, -5601, -1980, -4073, -8365,
+  -3828, -4323, -2356, -4084, -2730, -2505, -4326, -3891, -3839, -5653, -2359, -4052, -2759, -2747, -3822, -4293,
+  -5149, -1590, -3875, -2495, -320, -4675, -4377, -5009, -4389, -6084, -1694, -2759, -4563, -247, -1235, -5527,
+  -1665, -3230, -2388, -2265, -1344, -2582, -2631, -3486, -1824, -3833, -2789, -2841, -2452, -2691, -1782, -2661,
+  -4388, -2830, -1958, -1944, -2575, -2517, -3070, -6888, -2276, -7963, -1508, -2444, -4642, -37, -3199, -7406,
+  -3485, -5855, -3738, -5850, -902, -4859, -5602, -3452, -3118, -8748, -4617, -4054, -3469, -5139, -3189, -1816,
+  -4342, -6959, -3124, -1051, -3246, -1671, -4480, -8104, -4261, -9179, -195, -1357, -7658, -577, -1671, -5860,
+  -2151, -6323, -3522, -6084, -1727, -6161, -6326, -682, -1764, -7653, -6886, -2574, -3359, -3623, -1822, -4252,
+  -3954, -2189, -2158, -2437, -2447, -4171, -2425, -3997, -2579, -4509, -750, -2392, -6563, -215, -810, -7527,
+  -3246, -3523, -225, -2150, -3223, -3945, -3339, -6698, -3537, -8461, -5316, -1300, -3155, -1381, -3911, -3227,
+  -7957, -2748, -403, -1026, -4369, -5166, -7185, -5167, -5568, -5573, -4003, -5165, -7371, -4329, -4978, -8334,
+  -989, -4796, -4626, -4557, -435, -4634, -4800, -4364, -860, -6127, -5359, -4525, -4740, -2827, -1758, -4767,
+  -5623, -4338, -2827, -2638, -2291, -5149, -3234, -2644, -2519, -6557, -2711, -2831, -5037, -1849, -253, -6000,
+  -689, -4839, -4668, -2001, -768, -4676, -4842, -426, -625, -6169, -5401, -2174, -4782, -1472, -999, -4809,
+  -5665, -2193, -1595, -2866, -4754, -5192, -2874, -5525, -4905, -6600, -1014, -1859, -5079, -1191, -2768, -6043,
+  -1880, -4613, -1365, -4374, -1730, -4450, -4616, -1568, -960, -5943, -5175, -2646, -4556, -4161, -3034, -932,
+  -5439, -2538, -4165, -1096, -3048, -2204, -4667, -2649, -2031, -6374, -381, -2169, -4853, -371, -2031, -5817,
+  -4361, -4471, -4870, -4868, -2581, -4870, -4620, -4861, -3379, -7766, -4472, -4109, -3931, -4613, -3139, -3720,
+  -7263, -4467, -2402, -5818, -6352, -6789, -6490, -4622, -6502, -4878, -31, -944, -6677, -2570, -4028, -7640,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -901, -1141, -1614, -1562, -1653, -1578, -1909, -1517, -940, -2721, -2720, -2124, -1358, -1746, -719, -1407,
+  -2464, -1673, -1261, -366, -2058, -1773, -1050, -5575, -2208, -6196, -3808, -8483, -1834, -2315, -1614, -5630,
+  -914, -1065, -1465, -1468, -1215, -1719, -3297, -3374, -1131, -4592, -4156, -1720, -1214, -3311, -728, -1213,
+  -3945, -1213, -1064, -436, -3499, -1726, -959, -5103, -3812, -5104, -3317, -2628, -1472, -3732, -2914, -5103,
+  -2537, -4909, -4738, -2403, -3077, -4746, -4912, -4477, -2753, -6239, -2945, -2836, -2837, -2939, -2938, -2465,
+  -3095, -2834, -2835, -1513, -4824, -5261, -4963, -5595, -4975, -6670, -929, -1658, -579, -176, -1108, -1998,
+  -4446, -4673, -4591, -869, -5178, -4928, -4205, -5515, -4672, -8668, -5779, -4804, -4024, -5515, -5181, -4733,
+  -8164, -4804, -3771, -4215, -5773, -7690, -4562, -8023, -7403, -9098, -81, -919, -3631, -1803, -1707, -8541,
+  -2980, -3152, -2873, -3261, -2986, -2901, -1211, -3458, -2637, -3737, -3654, -3248, -3099, -3458, -2986, -2606,
+  -2877, -3107, -3075, -2804, -3785, -3053, -3693, -3481, -3786, -4249, -362, -1448, -2261, -215, -2793, -3843,
+  -3450, -3945, -3775, -3706, -3235, -3783, -3949, -3513, -2122, -5275, -4508, -3674, -3889, -1025, -2367, -3916,
+  -2131, -1666, -2370, -1385, -3861, -4298, -4000, -4631, -4011, -5706, -1142, -2382, -1793, -1213, -1470, -91,
+  -5568, -1230, -1186, -3593, -5483, -4082, -1996, -5420, -2246, -5167, -1230, -636, -1279, -1433, -5672, -3623,
+  -5018, -1095, -3138, -244, -4112, -3895, -4339, -4449, -3450, -5491, -1037, -1848, -5490, -1849, -1743, -8847,
+  -1650, -1766, -1891, -2211, -421, -3075, -3330, -2267, -1347, -1532, -5456, -749, -2822, -2819, -801, -4864,
+  -3335, -1147, -1153, -2001, -1013, -3079, -4948, -2567, -619, -6654, -1841, -2822, -5134, -1921, -2335, -6097,
+  -1374, -5152, -4262, -5206, -229, -5574, -5781, -761, -733, -5632, -3992, -1130, -7795, -5573, -1389, -5631,
+  -5632, -1235, -5269, -1042, -2191, -8204, -7906, -6293, -1902, -9613, -4708, -5780, -8092, -4600, -5091, -5699,
+  -4906, -6251, -6250, -4889, -1191, -6355, -5078, -5912, -1181, -5996, -6102, -2102, -6044, -6166, -1683, -6505,
+  -6763, -2048, -1540, -2933, -1986, -5996, -8376, -9008, -4961, -10083, -87, -979, -8562, -1440, -2933, -9525,
+  -920, -5227, -1765, -1074, -2275, -2462, -2359, -5593, -1804, -6198, -5243, -2612, -4470, -1922, -1847, -2359,
+  -1558, -914, -511, -1426, -6403, -1683, -1434, -1449, -2358, -6322, -409, -1267, -8715, -1186, -2615, -6661,
+  -3037, -5348, -5093, -6672, -1135, -3216, -1855, -5336, -297, -8241, -4947, -713, -4502, -5335, -829, -6882,
+  -5353, -2570, -4755, -3223, -532, -7264, -6965, -7597, -4266, -8672, -2179, -3100, -7151, -1853, -4123, -8115,
+  -2980, -7879, -7708, -5658, -793, -6313, -5041, -3600, -989, -9209, -6064, -905, -5065, -2984, -4308, -7849,
+  -2733, -2134, -921, -1277, -1559, -8231, -7933, -6320, -2989, -9640, -251, -1146, -8119, -1169, -2988, -9083,
+  -1076, -3510, -5411, -3762, -481, -3509, -4018, -5149, -1088, -3429, -4022, -3303, -2850, -3758, -1426, -3765,
+  -3767, -1819, -2755, -1394, -2206, -5934, -5636, -6267, -2419, -4024, -219, -2020, -5822, -1865, -2806, -2661,
+  -1629, -2342, -1130, -3595, -1347, -571, -1936, -6150, -4598, -9055, -4253, -3548, -1223, -497, -1829, -2347,
+  -4268, -3399, -698, -778, -1580, -855, -7779, -4062, -7791, -4795, -2341, -4680, -6164, -4438, -2348, -5448,
+  -1598, -4157, -3987, -3918, -232, -3995, -4161, -3725, -3674, -5487, -2193, -3886, -4101, -3705, -568, -4128,
+  -4984, -3699, -3710, -2329, -566, -4510, -4212, -4843, -4223, -5918, -1824, -2594, -4398, -1787, -2342, -5361,
+  -3363, -5519, -3953, -5280, -1621, -3953, -5523, -3445, -771, -6849, -3960, -932, -3554, -663, -3074, -3956,
+  -3449, -5061, -926, -3691, -5435, -5872, -3554, -6205, -3449, -7280, -331, -929, -5760, -1140, -2961, -6723,
+  -1332, -7017, -4541, -3232, -647, -3634, -4435, -6585, -1575, -5204, -4648, -2589, -4070, -4607, -2689, -4116,
+  -7844, -4646, -3292, -3501, -3026, -3662, -4203, -7703, -91, -8778, -2636, -3532, -5202, -3420, -4203, -8221,
+  -1486, -2290, -3352, -4193, -730, -2935, -3796, -3939, -394, -7091, -3947, -3391, -2495, -2805, -289, -1966,
+  -4203, -3390, -2128, -3432, -2052, -4201, -5815, -3947, -2599, -7522, -1483, -2478, -4201, -1982, -2737, -4203,
+  -1011, -7304, -2958, -2557, -147, -3893, -2757, -5729, -1011, -5234, -4572, -3895, -4977, -3789, -755, -5233,
+  -4935, -5148, -2995, -2880, -1190, -3963, -4604, -5745, -1953, -9065, -2534, -3526, -7544, -1443, -4490, -8508,
+  -2649, -2644, -2394, -4173, -5021, -3318, -4483, -5380, -2244, -6082, -4611, -3709, -1270, -1561, -4327, -4020,
+  -8872, -1337, -2637, -147, -1098, -2648, -772, -6487, -5513, -6082, -1019, -1989, -6230, -1989, -5381, -9249,
+  -1218, -5517, -3951, -5278, -1160, -5354, -3700, -586, -1915, -6847, -6079, -1556, -5460, -3547, -1263, -1629,
+  -3148, -543, -2417, -1877, -2049, -5870, -3041, -6203, -5583, -7278, -2073, -3147, -3956, -2207, -337, -6721,
+  -4422, -4917, -2951, -4678, -3324, -3099, -4920, -4485, -4434, -6247, -2953, -4646, -3353, -3341, -4416, -4888,
+  -5743, -2185, -4469, -3089, -140, -5270, -4971, -5603, -4983, -6678, -2288, -3353, -5157, -842, -582, -6121,
+  -1476, -3042, -2199, -2076, -225, -2394, -2442, -3297, -1635, -3644, -2600, -2652, -2264, -2502, -1594, -2472,
+  -4199, -2641, -1770, -1756, -2387, -2329, -2881, -6699, -2087, -7774, -1320, -2255, -4453, -1790, -405, -7217,
+  -1577, -6529, -2344, -6524, -773, -2751, -6276, -4127, -724, -9422, -5291, -1664, -956, -5813, -1547, -1147,
+  -5016, -7634, -3799, -896, -2736, -2157, -1562, -8778, -4935, -9853, -424, -1460, -8332, -768, -1940, -6534,
+  -1282, -8378, -5577, -8139, -607, -8216, -8381, -1482, -814, -9708, -8941, -1196, -5414, -5678, -729, -6307,
+  -6009, -1072, -1006, -4492, -4502, -6226, -4480, -6052, -1948, -2866, -504, -1367, -8618, -1021, -5001, -9582,
+  -720, -3404, -3071, -3835, -753, -3826, -3219, -6579, -1370, -8341, -5197, -2979, -332, -2935, -2030, -3107,
+  -7837, -2628, -670, -764, -4250, -5047, -7065, -5047, -5449, -5453, -3883, -5046, -7251, -4209, -4858, -8215,
+  -1739, -6326, -6156, -6088, -22, -6164, -6330, -5894, -1496, -7657, -6889, -6055, -6270, -4357, -1780, -6297,
+  -7153, -5868, -4357, -1380, -3821, -6679, -4764, -4174, -4050, -8088, -4241, -4361, -6567, -3379, -3627, -7530,
+  -14, -5997, -5826, -3159, -1926, -5834, -6000, -1584, -1783, -7327, -6559, -3332, -5940, -2630, -2157, -5967,
+  -6823, -3351, -2753, -4024, -5912, -6350, -4032, -6683, -6063, -7758, -2172, -3017, -6237, -2349, -3927, -7201,
+  -1731, -4463, -1216, -4224, -1581, -4301, -4466, -1418, -810, -5793, -5026, -2496, -4406, -4011, -2885, -782,
+  -5289, -2389, -4015, -946, -2898, -2055, -4517, -2499, -1881, -6224, -1239, -2019, -4703, -221, -1881, -5667,
+  -4998, -5107, -5506, -5505, -3217, -5507, -5256, -5498, -4015, -8403, -5109, -4746, -2245, -5250, -3775, -4357,
+  -7899, -5103, -2205, -6454, -6988, -7425, -7127, -5259, -7139, -5515, -58, -815, -7313, -1296, -4664, -8276,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -800, -1203, -1511, -1554, -1526, -1648, -1752, -1653, -883, -6238, -2806, -1571, -1472, -2008, -818, -1317,
+  -2237, -1612, -1276, -352, -1932, -1745, -1253, -3212, -2212, -6687, -2441, -8974, -2165, -2493, -1607, -3212,
+  -887, -1272, -1369, -1501, -1246, -1558, -1502, -1626, -867, -5083, -4648, -1409, -1812, -1963, -918, -1079,
+  -2220, -1369, -1556, -368, -1708, -3986, -1174, -5594, -4304, -5595, -3809, -1949, -3942, -2219, -1500, -2221,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -2566, -1798, -4935, -934, -5522, -5273, -4550, -5860, -5017, -9012, -6123, -5149, -1681, -5859, -5526, -1848,
+  -8508, -5148, -896, -4560, -6117, -8035, -2160, -8368, -7748, -9443, -139, -869, -3976, -2148, -1478, -8886,
+  -2775, -2947, -2668, -3056, -2781, -2696, -2544, -3253, -2432, -3532, -3449, -3043, -2894, -3253, -2781, -857,
+  -1260, -2902, -2870, -859, -3580, -2848, -3488, -3276, -3581, -4044, -536, -854, -2056, -317, -2588, -3638,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -5188, -3376, -925, -300, -5103, -3701, -1869, -1874, -3273, -4787, -1361, -925, -3211, -2393, -5292, -1360,
+  -4637, -670, -897, -953, -3732, -3515, -3959, -4068, -3069, -5110, -3049, -3857, -5110, -4361, -4238, -8466,
+  -1408, -4149, -4274, -4594, -1220, -5458, -5713, -4650, -3730, -594, -7839, -499, -5205, -5202, -3183, -7247,
+  -5718, -3529, -312, -1571, -1407, -2127, -7330, -4950, -3002, -9037, -4224, -5205, -7517, -1615, -4718, -8480,
+  -902, -4215, -903, -4268, -872, -4637, -4843, -1569, -526, -4695, -932, -3081, -6858, -4635, -2390, -4694,
+  -4695, -3224, -4331, -2551, -344, -7267, -6968, -5356, -4332, -8675, -3771, -4843, -7154, -3663, -4153, -4762,
+  -2312, -5376, -5376, -1653, -2269, -5481, -2058, -5037, -282, -5122, -5228, -4052, -5170, -2315, -3634, -5631,
+  -5889, -4098, -2308, -4236, -752, -5121, -7502, -8133, -560, -9208, -782, -2052, -7688, -1227, -4889, -8651,
+  -2691, -3829, -2802, -2506, -2859, -2739, -3390, -4194, -2945, -4800, -3844, -2956, -1468, -1448, -3829, -3367,
+  -3403, -2235, -139, -2786, -5005, -705, -3545, -3038, -3114, -4924, -1367, -2731, -7316, -877, -4089, -5262,
+  -4351, -6663, -6408, -7987, -4341, -1996, -5526, -6651, -3140, -9556, -6262, -4287, -5817, -6650, -2894, -8196,
+  -6667, -3120, -6070, -1914, -4885, -8578, -8280, -8912, -5580, -9987, -36, -948, -8466, -1953, -2764, -9429,
+  -3384, -6896, -6726, -4675, -112, -5331, -4059, -2618, -3112, -8227, -5082, -2868, -4083, -3623, -3326, -6867,
+  -4933, -617, -1745, -3627, -3362, -7249, -6951, -5338, -1288, -8658, -2593, -3491, -7137, -1286, -4122, -8100,
+  -1945, -4379, -6279, -4631, -162, -4378, -4887, -6018, -1956, -4298, -4891, -4172, -3718, -4627, -2294, -4633,
+  -4636, -2688, -3623, -2262, -3075, -6802, -6504, -7136, -3288, -4892, -1087, -2888, -6690, -462, -3675, -3530,
+  -3758, -3593, -2045, -1216, -3428, -3385, -3175, -5869, -4317, -8774, -3973, -515, -3399, -153, -3006, -4193,
+  -3988, -3118, -1117, -2832, -3992, -3638, -7498, -3781, -7510, -4515, -3530, -4400, -5884, -4157, -4656, -5168,
+  -1516, -4075, -3904, -3836, -32, -3912, -4078, -3643, -3591, -5405, -2111, -3804, -4018, -3623, -1470, -4046,
+  -4901, -3616, -3627, -2247, -1449, -4428, -4129, -4761, -4141, -5836, -1741, -2511, -4315, -1705, -2260, -5279,
+  -4053, -6209, -4643, -5971, -607, -4643, -6213, -4135, -902, -7540, -4651, -3704, -4244, -2572, -3764, -4646,
+  -4140, -5751, -931, -4382, -6125, -6562, -4245, -6896, -4139, -7971, -471, -1110, -6450, -448, -1621, -7413,
+  -1476, -7943, -5468, -1216, -579, -4561, -5362, -7511, -1030, -6130, -5574, -1011, -4997, -5534, -225, -5042,
+  -8770, -5572, -2772, -2521, -1477, -1390, -5130, -8630, -2755, -9705, -1709, -2776, -6129, -1893, -1894, -9148,
+  -3441, -1699, -5308, -6149, -478, -4890, -5751, -5894, -1413, -9047, -5902, -5346, -1280, -2765, -1300, -670,
+  -6158, -5345, -2047, -5387, -2103, -6157, -7771, -5903, -4555, -9478, -315, -1337, -6156, -1699, -4693, -6159,
+  -1775, -8492, -1346, -1115, -743, -1477, -1192, -6917, -2022, -2635, -5761, -1450, -6166, -2740, -2482, -6421,
+  -6123, -6336, -701, -1153, -4903, -1414, -5793, -6934, -2040, -10253, -388, -1450, -8732, -821, -2552, -9696,
+  -4126, -3616, -4150, -655, -4531, -1386, -3993, -4891, -3932, -5592, -328, -1749, -1114, -780, -3838, -1901,
+  -8382, -1559, -1898, -780, -3008, -3878, -3399, -5997, -5023, -5592, -1035, -1755, -5741, -4206, -4891, -8759,
+  -826, -7390, -5824, -7151, -684, -7228, -5574, -1343, -904, -8720, -7953, -2442, -7334, -5421, -450, -878,
+  -5021, -3170, -1237, -1016, -3923, -7743, -4914, -8076, -7456, -9151, -1144, -5020, -2468, -904, -2465, -8594,
+  -3572, -4067, -2100, -3828, -2474, -2249, -4070, -3635, -3583, -5397, -2103, -3796, -2503, -2491, -3566, -4037,
+  -4893, -1334, -3619, -2239, -64, -4419, -4121, -4753, -4133, -5828, -1438, -2503, -4307, -1384, -979, -5271,
+  -1332, -1882, -1533, -982, -552, -4738, -2287, -5641, -1416, -5989, -2156, -2059, -1095, -2120, -2487, -1803,
+  -6544, -1848, -1561, -858, -2599, -4673, -2494, -9044, -2088, -10119, -355, -1229, -6797, -1448, -5355, -9562,
+  -4046, -6416, -1976, -6411, -245, -5420, -6162, -4013, -665, -9309, -5177, -4615, -4030, -5700, -1513, -1591,
+  -4903, -7520, -1074, -550, -3807, -5653, -5041, -8665, -4822, -9740, -2325, -3978, -8219, -2222, -4759, -6421,
+  -1372, -8290, -5488, -8051, -1326, -8127, -8293, -268, -899, -9620, -8852, -4541, -5326, -2372, -3789, -6219,
+  -5921, -2518, -1636, -1487, -2774, -6137, -2183, -5964, -4546, -6476, -445, -1381, -8530, -1498, -4912, -9494,
+  -4084, -1832, -1772, -1884, -4061, -4783, -767, -7536, -4374, -9298, -6154, -905, -3993, -791, -4748, -4064,
+  -8795, -366, -932, -642, -5207, -6004, -8023, -6005, -6406, -6411, -1421, -2585, -8209, -5167, -5816, -9172,
+  -1699, -6661, -6491, -6423, -38, -6499, -6665, -6229, -1050, -7992, -7224, -6390, -6605, -4692, -3623, -6632,
+  -7488, -6203, -4692, -4504, -4156, -7014, -5099, -4509, -1402, -8422, -4576, -4696, -6902, -1863, -3962, -7865,
+  -880, -7438, -7267, -1319, -887, -7275, -7441, -3025, -1118, -8768, -8000, -1531, -7381, -894, -3598, -7408,
+  -8264, -4792, -1063, -5465, -7353, -7790, -2599, -8124, -7504, -9199, -414, -1265, -7678, -561, -2599, -8642,
+  -1731, -4463, -1216, -4224, -246, -4301, -4466, -1418, -810, -5793, -5026, -2496, -4406, -4011, -2885, -782,
+  -5289, -2389, -4015, -946, -2898, -2055, -4517, -2499, -1881, -6224, -1239, -2019, -4703, -1113, -1881, -5667,
+  -744, -3862, -4261, -4259, -974, -4261, -4011, -4252, -997, -7157, -3863, -594, -3322, -4004, -2530, -3111,
+  -6654, -3858, -1793, -5209, -5743, -6180, -5882, -4013, -5893, -4270, -522, -2066, -6068, -481, -3419, -7031,
+  -1569, -3644, -3474, -2076, -1038, -3482, -3647, -3212, -1488, -4974, -4207, -2075, -3587, -3192, -1085, -3615,
+  -4470, -3185, -3196, -3025, -1827, -3997, -3698, -4330, -2082, -5405, -86, -3605, -3884, -1235, -1829, -4848,
+  -905, -834, -1305, -1387, -1421, -1260, -1442, -1568, -1124, -3006, -1899, -1591, -1078, -1416, -1052, -1237,
+  -2344, -1287, -1141, -490, -1982, -1643, -1382, -2750, -2031, -6481, -1802, -8768, -1316, -2749, -1832, -3006,
+  -849, -1063, -1187, -1270, -1443, -1319, -1271, -1632, -992, -4901, -4466, -1525, -1153, -1632, -1063, -1187,
+  -2038, -1187, -1014, -508, -2036, -1782, -1269, -5413, -4122, -5413, -3627, -2938, -1377, -4042, -1629, -5413,
+  -2687, -5058, -4888, -2553, -3227, -4896, -5062, -4626, -2902, -6389, -3095, -2986, -2987, -3089, -3088, -2615,
+  -3245, -2984, -2984, -1663, -4974, -5411, -5113, -5745, -5124, -6820, -1079, -1807, -728, -108, -1258, -2148,
+  -4018, -4246, -944, -3030, -4751, -4501, -3778, -5088, -1027, -8240, -5351, -4377, -1133, -5087, -4754, -4306,
+  -7737, -4377, -3344, -1389, -5346, -7263, -4135, -7596, -6976, -8671, -122, -1023, -3204, -2627, -1782, -8114,
+  -2632, -2803, -2524, -2912, -2637, -2552, -2400, -3109, -2289, -3388, -3306, -2900, -2750, -3109, -2638, -2257,
+  -2529, -2758, -2726, -2455, -3437, -2704, -3344, -3132, -3437, -3900, -392, -1099, -1912, -202, -2444, -3494,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -6054, -2145, -1079, -4079, -5970, -4568, -1261, -5907, -1407, -5654, -1552, -1460, -4077, -1630, -2741, -703,
+  -5504, -214, -759, -2461, -2739, -4382, -4826, -4935, -3936, -2335, -3915, -4723, -5977, -5228, -5105, -9333,
+  -1650, -1766, -1891, -2211, -421, -3075, -3330, -2267, -1347, -1532, -5456, -749, -2822, -2819, -801, -4864,
+  -3335, -1147, -1153, -2001, -1013, -3079, -4948, -2567, -619, -6654, -1841, -2822, -5134, -1921, -2335, -6097,
+  -1292, -2620, -1730, -2674, -922, -3042, -3248, -968, -1258, -3100, -1460, -1486, -5263, -3041, -795, -3099,
+  -3100, -1629, -2737, -957, -1444, -5672, -5374, -3761, -2738, -7081, -2176, -3248, -5560, -2068, -255, -3167,
+  -1716, -3061, -3060, -1700, -743, -3166, -1888, -2722, -744, -2806, -2912, -1736, -2855, -2976, -1319, -3315,
+  -3574, -1782, -1434, -1920, -1686, -2806, -5186, -5818, -1771, -6893, -250, -1169, -5372, -1031, -2574, -6336,
+  -648, -5155, -697, -1711, -2539, -4065, -4717, -5521, -4271, -6126, -5171, -1569, -4398, -790, -2799, -4693,
+  -4730, -275, -1293, -1641, -6331, -4637, -4872, -4365, -4441, -6251, -1706, -2788, -8643, -2030, -2799, -6589,
+  -1181, -3492, -3238, -4817, -1171, -1361, -2356, -3481, -910, -6386, -3092, -1117, -2647, -3480, -800, -5026,
+  -3497, -715, -2900, -1367, -1715, -5408, -5110, -5742, -2410, -6817, -324, -1245, -5296, -1828, -2267, -6259,
+  -397, -5295, -5125, -405, -1143, -3729, -2458, -1016, -1511, -6626, -3481, -1267, -2481, -2022, -1725, -5266,
+  -3332, -1200, -1663, -2026, -1761, -5648, -5350, -3737, -2926, -7057, -991, -1890, -5536, -1623, -2520, -6499,
+  -1939, -5231, -7131, -5483, -375, -5230, -5739, -6870, -732, -5150, -5743, -1977, -4570, -5479, -1566, -5485,
+  -5488, -1463, -4475, -3114, -663, -7655, -7356, -7988, -930, -5744, -2807, -3741, -7542, -3586, -1465, -614,
+  -3736, -3571, -886, -1783, -1021, -3362, -3152, -5847, -4295, -8752, -3950, -1126, -1325, -798, -545, -1070,
+  -3965, -526, -1769, -800, -3969, -3616, -7476, -3759, -7488, -4492, -3507, -4377, -5861, -4135, -4633, -5145,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -2174, -4330, -2764, -4092, -432, -2764, -4334, -2256, -847, -5661, -2772, -1825, -2365, -693, -1885, -2767,
+  -2261, -3872, -1237, -2503, -4246, -4683, -2366, -5017, -2260, -6092, -589, -1460, -4571, -726, -1772, -5534,
+  -107, -7567, -5091, -3783, -657, -4185, -4986, -7135, -1122, -5754, -5198, -3139, -4621, -5158, -1549, -4666,
+  -8394, -5196, -3842, -4051, -1992, -4212, -4754, -8254, -1550, -9329, -3186, -4082, -5752, -3971, -4754, -8771,
+  -674, -1478, -2541, -3382, -518, -2123, -2984, -3127, -855, -6280, -3135, -2579, -1684, -1994, -794, -1154,
+  -3391, -2578, -1316, -2620, -1240, -3390, -5004, -3136, -1788, -6711, -671, -1666, -3389, -1171, -1926, -3392,
+  -2046, -5857, -1512, -1110, -241, -2446, -1311, -4282, -1952, -3787, -3126, -2449, -3531, -2343, -1648, -3786,
+  -3488, -3701, -1548, -1433, -2268, -2516, -3158, -4299, -2055, -7618, -441, -2079, -6097, -1733, -3043, -7061,
+  -4661, -4151, -4685, -4218, -2440, -2271, -2290, -2440, -910, -6127, -4656, -1149, -3766, -517, -4373, -4066,
+  -8917, -715, -508, -1102, -808, -4413, -1056, -6532, -5558, -6127, -3527, -4495, -6276, -4741, -5427, -9295,
+  -1802, -7253, -5687, -7015, -126, -7091, -5437, -3721, -1668, -8584, -7816, -1382, -7197, -5284, -612, -3365,
+  -4884, -1327, -4154, -3613, -3786, -7606, -4778, -7940, -7319, -9015, -3810, -4884, -5693, -1331, -4166, -8457,
+  -4422, -4917, -2951, -4678, -3324, -3099, -4920, -4485, -4434, -6247, -594, -4646, -3353, -3341, -4416, -4888,
+  -5743, -441, -4469, -3089, -914, -5270, -4971, -5603, -4983, -6678, -2288, -3353, -5157, -442, -825, -6121,
+  -2244, -5043, -4200, -4077, -634, -4395, -4444, -5298, -394, -5645, -4601, -4653, -4265, -4504, -279, -4473,
+  -6201, -4642, -2645, -2644, -4388, -4330, -4882, -8701, -4088, -9776, -2605, -2658, -2663, -3791, -5012, -9218,
+  -2956, -5325, -3208, -5320, -774, -4330, -5072, -2923, -2588, -8218, -4087, -3524, -2939, -4609, -2659, -2881,
+  -3812, -6430, -2595, -2400, -2716, -4562, -3950, -7574, -3731, -8649, -164, -1286, -7128, -659, -1291, -5330,
+  -3423, -7595, -4794, -7356, -803, -7433, -7599, -1535, -434, -8926, -8158, -3847, -2083, -4895, -1485, -5524,
+  -5226, -3461, -2074, -3709, -3720, -5443, -3697, -5270, -1272, -5782, -498, -2079, -7836, -942, -670, -8799,
+  -3005, -1143, -2949, -3713, -2982, -3704, -3097, -6457, -3295, -8220, -5075, -1058, -1888, -1640, -3670, -1313,
+  -7716, -392, -885, -326, -4128, -4925, -6944, -4926, -5327, -5332, -3762, -4924, -7130, -4088, -4737, -8093,
+  -733, -4540, -4370, -4301, -179, -4378, -4544, -4108, -604, -5871, -5103, -4269, -4484, -2571, -1502, -4511,
+  -5367, -4082, -2571, -2382, -2035, -4893, -2978, -2388, -2263, -6301, -2455, -2575, -4781, -1593, -1841, -5744,
+  -25, -5786, -5616, -2948, -1715, -5624, -5789, -1374, -1572, -7116, -6349, -3121, -5730, -2419, -1946, -5757,
+  -6612, -3140, -2542, -3813, -5701, -6139, -3821, -6472, -5852, -7547, -1961, -2806, -6026, -2138, -3716, -6990,
+  -1475, -4207, -960, -3968, -1325, -4045, -4210, -1162, -554, -5537, -4770, -2240, -4150, -3755, -2629, -526,
+  -5033, -2133, -3759, -690, -2642, -1799, -4261, -2243, -1625, -5968, -983, -1763, -4447, -857, -1625, -5411,
+  -2752, -2862, -3261, -3259, -972, -3261, -3011, -3252, -1769, -6157, -2863, -2500, -2322, -3004, -1530, -2111,
+  -5653, -2857, -793, -4209, -4742, -5180, -4881, -3013, -4893, -3269, -161, -1066, -5067, -961, -2419, -6031,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -563, -1117, -3125, -1880, -1882, -1626, -1630, -3490, -762, -4914, -1887, -1479, -1478, -3502, -729, -1626,
+  -4219, -1291, -1869, -655, -1885, -1293, -939, -4742, -3909, -5363, -2975, -7650, -1076, -4236, -3470, -4797,
+  -578, -2002, -1999, -2142, -2218, -2158, -2419, -2495, -830, -3713, -3277, -2226, -2145, -2433, -1914, -1968,
+  -3067, -1994, -1891, -245, -2620, -2616, -1981, -4224, -2933, -4225, -2438, -1749, -847, -2853, -2035, -4225,
+  -2537, -4909, -4738, -2403, -3077, -4746, -4912, -4477, -2753, -6239, -2945, -2836, -2837, -2939, -2938, -2465,
+  -3095, -2834, -2835, -1513, -4824, -5261, -4963, -5595, -4975, -6670, -929, -1658, -579, -176, -1108, -1998,
+  -3979, -4207, -4124, -687, -4712, -1755, -3739, -5049, -4206, -8201, -5312, -4338, -3558, -1756, -4715, -4267,
+  -7697, -4337, -3305, -3749, -5307, -7224, -4096, -7557, -6937, -8632, -265, -1340, -3165, -2588, -432, -8075,
+  -3043, -1532, -2936, -1533, -3049, -2963, -1274, -3520, -2700, -3800, -3717, -3311, -1532, -3520, -3049, -815,
+  -1528, -3170, -3138, -1526, -3848, -3116, -1535, -3544, -3848, -4312, -374, -1510, -2324, -360, -2856, -3906,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -3313, -1502, -1042, -1338, -3229, -1827, -1565, -3166, -1399, -2913, -1586, -901, -1336, -518, -3418, -1368,
+  -2763, -808, -883, -737, -1857, -1640, -2084, -2194, -1195, -3236, -1174, -1982, -3235, -2487, -2364, -6592,
+  -1650, -1766, -1891, -2211, -421, -3075, -3330, -2267, -1347, -1532, -5456, -749, -2822, -2819, -801, -4864,
+  -3335, -1147, -1153, -2001, -1013, -3079, -4948, -2567, -619, -6654, -1841, -2822, -5134, -1921, -2335, -6097,
+  -1548, -2876, -1986, -2930, -1178, -3298, -3504, -1224, -1514, -3356, -1716, -1742, -5519, -3297, -1051, -3355,
+  -3356, -1885, -2993, -1213, -1700, -5928, -5630, -4017, -2994, -7337, -510, -3504, -5816, -255, -2814, -3423,
+  -1716, -3061, -3060, -1700, -743, -3166, -1888, -2722, -744, -2806, -2912, -1736, -2855, -2976, -1319, -3315,
+  -3574, -1782, -1434, -1920, -1686, -2806, -5186, -5818, -1771, -6893, -250, -1169, -5372, -1031, -2574, -6336,
+  -1473, -2612, -1584, -1288, -1642, -1521, -2173, -2977, -1727, -3583, -2627, -1738, -1854, -1228, -2611, -2149,
+  -2186, -1018, -1166, -1569, -3788, -2093, -2328, -1821, -1897, -3707, -150, -1514, -6099, -1557, -2871, -4045,
+  -1587, -3898, -3643, -5222, -1576, -1766, -2762, -3886, -1315, -6791, -3497, -1522, -3053, -3886, -1206, -5432,
+  -3903, -1121, -3306, -1773, -2120, -5814, -5516, -6147, -2816, -7222, -80, -1651, -5702, -2233, -2673, -6665,
+  -1377, -4890, -4719, -2669, -737, -3324, -2052, -611, -1106, -6220, -3075, -861, -2076, -1617, -1319, -4860,
+  -2926, -794, -1258, -1620, -1355, -5242, -4944, -3331, -2520, -6651, -586, -1484, -5130, -1217, -2115, -6094,
+  -820, -3254, -5155, -3506, -225, -3253, -3762, -4893, -832, -3173, -3766, -3047, -2594, -3502, -1170, -3509,
+  -3511, -1563, -2499, -1138, -1950, -5678, -5380, -6011, -2163, -3768, -830, -1764, -5566, -1609, -2550, -2405,
+  -1691, -1526, -1021, -1246, -1360, -1317, -1107, -3802, -2249, -6707, -1905, -1200, -1332, -496, -939, -2125,
+  -1920, -1050, -815, -764, -1924, -1571, -5431, -1713, -5442, -2447, -1462, -2332, -3816, -2089, -2588, -3100,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -2686, -4842, -3276, -4604, -944, -3276, -4846, -2768, -1359, -6173, -3284, -2337, -2877, -1205, -2397, -512,
+  -2773, -4384, -1749, -3015, -4758, -5195, -2878, -5529, -2772, -6604, -444, -1972, -5083, -464, -2284, -6046,
+  -864, -5164, -2688, -1379, -590, -1781, -2582, -4732, -773, -3350, -2795, -736, -2217, -2754, -836, -2263,
+  -5991, -2793, -1439, -1648, -1173, -1809, -2350, -5850, -994, -6925, -783, -1678, -3349, -1567, -2350, -6368,
+  -930, -1734, -2797, -3638, -774, -2379, -3240, -3383, -1111, -6536, -3391, -2835, -1940, -2250, -1050, -1410,
+  -3647, -2834, -1572, -2876, -1496, -3646, -5260, -3392, -2044, -6967, -200, -1922, -3645, -1427, -2182, -3648,
+  -1790, -5601, -1256, -854, -1172, -2190, -1055, -4026, -1696, -3531, -2870, -2193, -3275, -2087, -1392, -3530,
+  -3232, -3445, -1292, -1177, -2012, -2260, -2902, -4043, -1799, -7362, -832, -1823, -5841, -243, -2787, -6805,
+  -1964, -1454, -1988, -1522, -2369, -667, -1831, -2729, -1770, -3431, -1960, -1057, -1070, -690, -1676, -1369,
+  -6221, -830, -1199, -1058, -846, -1717, -1238, -3836, -2862, -3431, -831, -1799, -3579, -2044, -2730, -6598,
+  -624, -4922, -3356, -4683, -565, -4760, -3106, -1390, -1321, -6253, -5485, -962, -4866, -2953, -668, -1034,
+  -2553, -702, -1823, -1282, -1455, -5275, -2447, -5609, -4988, -6683, -1479, -2553, -3362, -1612, -1834, -6126,
+  -3572, -4067, -2100, -3828, -2474, -2249, -4070, -3635, -3583, -5397, -2103, -3796, -2503, -2491, -3566, -4037,
+  -4893, -1334, -3619, -2239, -64, -4419, -4121, -4753, -4133, -5828, -1438, -2503, -4307, -1384, -979, -5271,
+  -2003, -3569, -2726, -2603, -1683, -2921, -2970, -3824, -2162, -4171, -3127, -783, -2791, -3030, -2121, -2999,
+  -4726, -3168, -924, -187, -2914, -2856, -3408, -7227, -2614, -8302, -1131, -2782, -4980, -1172, -933, -7744,
+  -1408, -3778, -1661, -3773, -791, -2782, -3524, -1375, -1041, -6671, -2539, -1977, -1392, -3062, -1112, -1334,
+  -2265, -4882, -1047, -852, -1169, -3015, -2403, -6027, -2184, -7102, -401, -1340, -5581, -909, -2121, -3783,
+  -1745, -5917, -3116, -5679, -1322, -5755, -5921, -727, -1359, -7248, -6480, -2169, -2954, -3217, -1416, -3846,
+  -3548, -1783, -1752, -2031, -2042, -3765, -2019, -3592, -2174, -4104, -1036, -1986, -6158, -1758, -149, -7121,
+  -263, -3817, -3484, -4247, -571, -4238, -3632, -6992, -590, -8754, -5609, -3391, -3448, -3348, -1074, -3520,
+  -8250, -3041, -3307, -3215, -4662, -5460, -7478, -5460, -5862, -5866, -4296, -5458, -7664, -1202, -5271, -8628,
+  -733, -4540, -4370, -4301, -179, -4378, -4544, -4108, -604, -5871, -5103, -4269, -4484, -2571, -1502, -4511,
+  -5367, -4082, -2571, -2382, -2035, -4893, -2978, -2388, -2263, -6301, -2455, -2575, -4781, -1593, -1841, -5744,
+  -689, -4839, -4668, -2001, -768, -4676, -4842, -426, -625, -6169, -5401, -2174, -4782, -1472, -999, -4809,
+  -5665, -2193, -1595, -2866, -4754, -5192, -2874, -5525, -4905, -6600, -1014, -1859, -5079, -1191, -2768, -6043,
+  -1475, -4207, -960, -3968, -1325, -4045, -4210, -1162, -554, -5537, -4770, -2240, -4150, -3755, -2629, -526,
+  -5033, -2133, -3759, -690, -2642, -1799, -4261, -2243, -1625, -5968, -983, -1763, -4447, -857, -1625, -5411,
+  -2752, -2862, -3261, -3259, -972, -3261, -3011, -3252, -1769, -6157, -2863, -2500, -2322, -3004, -1530, -2111,
+  -5653, -2857, -793, -4209, -4742, -5180, -4881, -3013, -4893, -3269, -161, -1066, -5067, -961, -2419, -6031,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -811, -489, -2325, -2494, -2579, -1075, -1083, -2689, -2075, -4113, -3419, -1078, -2369, -2701, -1057, -2321,
+  -3419, -2308, -1069, -799, -2880, -2796, -1071, -3941, -3109, -4563, -2175, -6849, -2592, -3436, -1082, -831,
+  -1149, -1407, -1405, -245, -1623, -1564, -1824, -1901, -1322, -3118, -2683, -1632, -1550, -1838, -1320, -1373,
+  -2472, -1399, -1296, -954, -2026, -2021, -1386, -3629, -2339, -3630, -1844, -1155, -1977, -2259, -1440, -3630,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -3365, -3593, -3510, -2376, -4098, -3848, -3125, -4435, -3592, -7587, -4698, -3724, -2944, -4434, -4101, -3653,
+  -7083, -3723, -2691, -3135, -4693, -6610, -3482, -6943, -6323, -8018, -6, -2051, -2551, -1974, -2389, -7461,
+  -3043, -3215, -1127, -3324, -1530, -2963, -1525, -3520, -1521, -3800, -3717, -3311, -3162, -1279, -3049, -2669,
+  -1528, -3170, -3138, -2867, -3848, -3116, -3756, -3544, -3848, -4312, -302, -1267, -2324, -360, -2856, -3906,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -6293, -1711, -489, -1688, -6208, -4806, -2211, -6145, -1534, -2129, -4565, -813, -2061, -645, -6397, -2465,
+  -5742, -1202, -2207, -884, -4837, -1723, -1520, -2978, -531, -6215, -2210, -2723, -6215, -2385, -2385, -9571,
+  -909, -3188, -3313, -3633, -979, -4497, -4752, -3689, -535, -2954, -6878, -1000, -4244, -4241, -567, -6286,
+  -4757, -2569, -701, -3423, -2435, -4501, -6370, -3989, -2041, -8076, -703, -4244, -6556, -1420, -3757, -7519,
+  -3293, -4621, -3731, -4675, -406, -5043, -5250, -1440, -1843, -5101, -3461, -387, -7264, -5042, -1961, -5100,
+  -5101, -3630, -1233, -2958, -531, -7673, -7375, -5762, -4739, -9082, -1851, -5249, -7561, -2000, -4560, -5169,
+  -4096, -5441, -5440, -4080, -529, -5546, -4268, -5102, -722, -5186, -5292, -2122, -5235, -2380, -3699, -5695,
+  -5954, -4162, -464, -4300, -4066, -5186, -7566, -8198, -4151, -9273, -500, -1567, -7752, -1056, -4954, -8716,
+  -891, -1682, -1401, -857, -974, -570, -1711, -2894, -2232, -2582, -5671, -2449, -1618, -1303, -1894, -1615,
+  -2057, -1741, -998, -1647, -3300, -2353, -2213, -4865, -2382, -6751, -486, -1424, -9144, -1273, -3300, -7089,
+  -238, -5556, -5301, -6880, -494, -3424, -4420, -5544, -771, -8449, -5155, -3180, -4710, -5543, -937, -7090,
+  -5561, -2779, -4963, -3431, -1806, -7472, -7173, -7805, -4474, -8880, -2387, -3308, -7359, -3891, -4331, -8323,
+  -1295, -6904, -6734, -4683, -136, -5339, -4067, -2626, -691, -8235, -5090, -2876, -4091, -3631, -3334, -6875,
+  -4941, -2809, -3272, -3635, -797, -7257, -6959, -5346, -4535, -8666, -2601, -3499, -7145, -2001, -4130, -8108,
+  -30, -4428, -6329, -4680, -1014, -4427, -4936, -6067, -2006, -4347, -4940, -4221, -3767, -4676, -2344, -4682,
+  -4685, -2737, -3672, -2312, -3124, -6852, -6553, -7185, -3337, -4941, -2004, -2938, -6739, -2783, -3724, -3579,
+  -1518, -1273, -1279, -2008, -1081, -1577, -1009, -2821, -5070, -9527, -1846, -2410, -887, -495, -1012, -1970,
+  -4741, -3871, -494, -1065, -1714, -1540, -8251, -4534, -8263, -1774, -4283, -5153, -6637, -2819, -5409, -5921,
+  -79, -4413, -4243, -4174, -1000, -4251, -4417, -3981, -3930, -5743, -2449, -4142, -4357, -3961, -824, -4384,
+  -5240, -3955, -3966, -2585, -1788, -4766, -4468, -5099, -4479, -6174, -2080, -2850, -4654, -2043, -2598, -5617,
+  -1263, -6188, -4622, -5949, -598, -4622, -6192, -4114, -1440, -7519, -4630, -3683, -1452, -1187, -3743, -4625,
+  -4119, -5730, -1595, -4360, -6104, -6541, -4223, -6875, -4118, -7949, -203, -1007, -6429, -1253, -3630, -7392,
+  -2670, -6970, -4494, -858, -986, -3588, -4388, -6538, -2579, -5157, -4601, -2542, -4023, -4560, -1770, -4069,
+  -7797, -4599, -3245, -3454, -2979, -3615, -4156, -7657, -84, -8731, -1764, -3485, -5155, -1801, -1806, -8174,
+  -1189, -3671, -4734, -5575, -394, -4316, -5177, -5320, -651, -8473, -5328, -1381, -3877, -4187, -961, -3347,
+  -5584, -4771, -1217, -2193, -3433, -5583, -7197, -5328, -3980, -8904, -613, -1530, -5582, -849, -4118, -5585,
+  -699, -7300, -2954, -2553, -621, -3889, -2754, -5725, -592, -5230, -4569, -3892, -1955, -3785, -3091, -5229,
+  -4931, -5144, -711, -2876, -3711, -3959, -4601, -5742, -3498, -9061, -600, -1442, -7540, -930, -1699, -8504,
+  -1221, -1618, -1571, -1288, -2606, -2806, -1338, -5591, -4632, -2456, -1944, -2596, -400, -1075, -1456, -614,
+  -9083, -1836, -1298, -1975, -657, -1509, -1243, -6698, -2143, -6293, -2260, -2605, -6441, -2861, -5592, -9460,
+  -2609, -6907, -5341, -6669, -198, -6745, -5091, -3375, -1265, -8238, -7470, -571, -6851, -4938, -935, -3020,
+  -4538, -1703, -3808, -3267, -985, -7260, -4432, -7594, -6974, -8669, -1726, -4538, -5347, -3597, -3820, -8111,
+  -3977, -4472, -2506, -4234, -2879, -2655, -4476, -4040, -3989, -5803, -2509, -4201, -2908, -2897, -3971, -4443,
+  -5299, -1740, -4025, -2645, -469, -4825, -4527, -5159, -4538, -6234, -398, -2909, -4713, -1790, -381, -5676,
+  -1398, -4197, -3355, -3232, -401, -3549, -3598, -4452, -525, -4800, -3756, -3808, -3419, -3658, -483, -3627,
+  -5355, -3797, -2925, -2911, -1222, -3484, -4037, -7855, -1303, -8930, -2475, -3410, -5608, -1047, -4166, -8373,
+  -2278, -6464, -4347, -6459, -1372, -5469, -6211, -2277, -2087, -9357, -5226, -2429, -2278, -5748, -2668, -1966,
+  -4951, -7568, -3733, -492, -2275, -5701, -5089, -8713, -4870, -9788, -284, -1272, -8267, -602, -2430, -6469,
+  -1176, -8212, -5410, -7973, -1110, -8049, -8215, -744, -515, -9542, -8774, -1700, -5248, -2700, -1751, -6141,
+  -5843, -4077, -590, -4326, -1213, -6059, -4314, -5886, -1613, -6398, -609, -1753, -8452, -1170, -1613, -9416,
+  -3164, -1152, -1553, -1813, -928, -3863, -3256, -6616, -1810, -8378, -5234, -689, -302, -1022, -3828, -1257,
+  -7874, -2003, -1044, -1067, -1259, -5084, -7102, -5084, -5486, -5490, -3920, -5083, -7288, -4246, -4896, -8252,
+  -164, -6668, -6498, -6430, -472, -6506, -6672, -6236, -1175, -7999, -7231, -6397, -6612, -4699, -3630, -6639,
+  -7495, -6210, -4699, -4511, -4163, -7021, -5106, -4516, -4391, -8430, -4583, -4703, -6909, -1466, -1466, -7872,
+  -189, -6418, -6248, -3580, -2347, -6256, -6422, -2006, -346, -7748, -6981, -3754, -6362, -3052, -2578, -6389,
+  -7245, -3772, -3175, -4445, -6334, -6771, -4453, -7104, -6484, -8179, -2594, -3438, -6659, -2770, -4348, -7622,
+  -1475, -4207, -960, -3968, -1325, -4045, -4210, -1162, -554, -5537, -4770, -2240, -4150, -3755, -2629, -526,
+  -5033, -2133, -3759, -690, -2642, -1799, -4261, -2243, -1625, -5968, -983, -1763, -4447, -857, -1625, -5411,
+  -2369, -5231, -5630, -5628, -3341, -5630, -5380, -5622, -1282, -8527, -5233, -4869, -4691, -2369, -3899, -4480,
+  -8023, -5227, -746, -6578, -7112, -7549, -7251, -5382, -7262, -5639, -136, -1006, -7437, -971, -2113, -8400,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -848, -1067, -1051, -1316, -1387, -1253, -1606, -1612, -848, -3136, -2368, -1500, -1276, -1714, -900, -1120,
+  -2542, -1266, -988, -651, -1691, -1606, -1077, -5990, -2136, -6611, -2619, -8898, -1557, -2218, -1933, -3136,
+  -957, -1253, -910, -1283, -1315, -1253, -1794, -1539, -984, -5064, -2201, -1350, -1350, -1606, -997, -910,
+  -4418, -1027, -997, -671, -1795, -1795, -1027, -2202, -4284, -5576, -3789, -3100, -1539, -2200, -1686, -5576,
+  -2537, -4909, -4738, -2403, -3077, -4746, -4912, -4477, -2753, -6239, -2945, -2836, -2837, -2939, -2938, -2465,
+  -3095, -2834, -2835, -1513, -4824, -5261, -4963, -5595, -4975, -6670, -929, -1658, -127, -781, -1108, -1998,
+  -2665, -2260, -5035, -818, -5622, -5373, -4649, -5959, -5116, -9112, -6223, -2666, -2663, -5959, -5625, -2666,
+  -8608, -5248, -1524, -4660, -6217, -8134, -2666, -8468, -7848, -9543, -102, -944, -4075, -2391, -1285, -8985,
+  -2959, -3131, -2852, -3240, -2965, -1444, -2728, -3436, -2616, -3716, -3633, -3227, -3078, -3436, -2965, -2585,
+  -2856, -3086, -3054, -2783, -3764, -3032, -3672, -3460, -3765, -4228, -290, -2423, -2240, -247, -2772, -3822,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -1863, -3877, -2354, -3714, -5604, -4202, -1201, -5541, -1095, -5288, -3961, -734, -208, -1303, -5793, -1712,
+  -5138, -1326, -3258, -937, -4233, -2371, -1401, -4569, -1374, -5611, -3549, -4358, -5611, -4862, -4739, -8967,
+  -1906, -2022, -2147, -2467, -154, -3331, -3586, -2523, -1603, -1788, -5712, -1005, -3078, -3075, -1057, -5120,
+  -3591, -1403, -1409, -2257, -1269, -3335, -5204, -2823, -875, -6910, -2097, -3078, -5390, -2177, -2591, -6353,
+  -650, -4487, -3597, -4541, -708, -4909, -5116, -1453, -1710, -4967, -3327, -1076, -7130, -4908, -448, -4967,
+  -4967, -519, -4604, -2824, -1076, -7540, -7241, -5628, -4605, -8948, -4044, -5116, -7427, -3936, -4426, -5035,
+  -1972, -3317, -3316, -1956, -999, -3422, -2144, -2978, -1000, -3062, -3168, -1992, -3111, -3232, -246, -3571,
+  -3830, -2038, -1690, -2176, -1942, -3062, -5442, -6074, -2027, -7149, -506, -1425, -5628, -1287, -2830, -6592,
+  -2140, -5348, -1024, -1007, -1028, -2730, -2735, -5713, -4463, -6318, -5363, -1299, -1788, -974, -2991, -1555,
+  -1445, -905, -870, -1648, -2586, -1046, -5064, -4557, -4633, -6443, -396, -1277, -8835, -1243, -2736, -6781,
+  -613, -4516, -4262, -5841, -2195, -2385, -3380, -4505, -357, -7410, -4116, -2141, -3671, -4504, -747, -6050,
+  -4521, -1739, -3924, -2391, -1020, -6432, -6134, -6766, -768, -7841, -1348, -2269, -6320, -1021, -3291, -7283,
+  -1783, -5295, -5125, -3074, -1143, -3729, -2458, -1016, -1511, -6626, -3481, -1267, -2481, -2022, -396, -5266,
+  -3332, -1200, -1663, -2026, -1761, -5648, -5350, -3737, -2926, -7057, -991, -1890, -5536, -392, -2520, -6499,
+  -370, -5663, -7563, -5915, -674, -5662, -6171, -7301, -866, -5581, -6175, -5456, -1896, -5911, -861, -5917,
+  -5920, -1813, -4907, -3546, -1267, -8086, -7788, -8420, -4572, -6176, -803, -1895, -7974, -829, -1814, -4813,
+  -4433, -1027, -2020, -566, -2333, -2732, -1568, -6544, -4992, -9449, -4647, -1034, -1568, -579, -850, -4868,
+  -4662, -1635, -1123, -656, -4666, -1249, -8173, -1133, -8185, -1795, -4205, -5074, -6558, -4832, -5330, -5842,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -3430, -5586, -4020, -5348, -947, -4021, -5590, -3513, -335, -6917, -4028, -3081, -3621, -1949, -3141, -4023,
+  -3517, -5128, -2493, -3759, -5502, -5939, -3622, -6273, -744, -7348, -479, -2716, -5827, -834, -3029, -6790,
+  -539, -6973, -4497, -3188, -917, -3590, -4391, -6541, -1084, -5159, -4604, -2545, -4026, -4563, -649, -4072,
+  -7800, -4602, -3248, -3457, -2981, -3618, -4159, -7659, -290, -8734, -2591, -3487, -5158, -3376, -4159, -8177,
+  -698, -3870, -4933, -5774, -2093, -4516, -5377, -5519, -603, -8672, -5527, -4971, -4076, -4386, -1414, -3546,
+  -5783, -4970, -778, -5012, -1982, -5782, -7396, -5528, -4180, -9103, -435, -1392, -5781, -656, -2390, -5784,
+  -2302, -6113, -1768, -1366, -497, -2702, -1567, -4538, -2208, -4043, -3382, -2705, -3787, -2599, -252, -4042,
+  -3744, -3957, -1804, -1689, -2524, -2772, -3414, -4555, -2311, -7874, -1344, -2335, -6353, -755, -3299, -7317,
+  -2010, -4126, -2010, -4194, -1904, -1896, -4503, -5401, -2669, -6103, -4632, -900, -607, -1001, -1416, -1547,
+  -8892, -852, -3871, -3730, -1546, -4388, -3910, -6507, -5533, -6103, -305, -1309, -6251, -1584, -5402, -9270,
+  -594, -7372, -5806, -7133, -331, -7210, -5556, -870, -897, -8702, -7935, -1448, -7316, -5403, -713, -3484,
+  -5003, -1231, -4273, -3732, -1787, -7725, -4896, -8058, -7438, -9133, -3928, -5002, -5812, -4062, -4284, -8576,
+  -5096, -5591, -3625, -5352, -3998, -3773, -5594, -5159, -5108, -6921, -3627, -5320, -4027, -4015, -5090, -5562,
+  -6417, -523, -5143, -3763, -104, -5944, -5645, -6277, -5657, -7352, -2962, -4027, -5831, -2908, -2503, -6795,
+  -815, -2380, -1538, -1415, -494, -1732, -1781, -2635, -973, -2982, -1938, -1990, -1602, -1841, -932, -1810,
+  -3538, -1979, -1108, -1094, -1725, -1667, -2220, -6038, -1425, -7113, -658, -1593, -3791, -1128, -2349, -6555,
+  -1355, -6514, -4397, -6509, -659, -2736, -6260, -4111, -660, -9407, -5275, -2734, -4127, -2736, -1346, -4070,
+  -5001, -7618, -3783, -3588, -1817, -5751, -5139, -8763, -2074, -9838, -334, -1249, -8317, -676, -2735, -6519,
+  -527, -8442, -5641, -8204, -1372, -8280, -8446, -3253, -798, -9773, -9005, -1824, -5479, -5743, -1290, -6371,
+  -6073, -873, -1742, -4556, -1651, -6290, -4545, -6117, -2928, -6629, -353, -1241, -8683, -1122, -2930, -9646,
+  -1010, -800, -526, -2102, -2349, -987, -3800, -7160, -2354, -8922, -5778, -1216, -1526, -707, -4372, -859,
+  -8419, -606, -1694, -3384, -4831, -5628, -7647, -5629, -6030, -2615, -4465, -5627, -7833, -4791, -5440, -8796,
+  -1544, -5352, -5181, -5113, -174, -5189, -5355, -4920, -1415, -6682, -5914, -5081, -5295, -406, -2314, -5323,
+  -6178, -4893, -3382, -3194, -2846, -5705, -3790, -3200, -3075, -7113, -3267, -3386, -5592, -2405, -2652, -6556,
+  -2078, -6228, -6057, -3390, -119, -6065, -6231, -1815, -497, -7558, -6790, -3563, -6171, -2861, -2388, -6199,
+  -7054, -3582, -2984, -4255, -6143, -6581, -4263, -6914, -6294, -7989, -2403, -3248, -6468, -2580, -4158, -7432,
+  -1475, -4207, -960, -3968, -1325, -4045, -4210, -1162, -554, -5537, -4770, -2240, -4150, -3755, -2629, -526,
+  -5033, -2133, -3759, -690, -2642, -1799, -4261, -2243, -1625, -5968, -983, -1763, -4447, -857, -1625, -5411,
+  -4357, -4466, -4865, -4863, -2576, -4865, -4615, -4857, -3374, -7762, -4468, -4104, -942, -1604, -3134, -3715,
+  -7258, -1348, -1327, -5813, -6347, -6784, -6486, -4617, -6497, -4874, -107, -883, -6672, -1578, -4023, -7635,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -808, -1057, -1299, -1396, -1430, -1279, -1736, -1684, -896, -2976, -2464, -1458, -1146, -1427, -594, -1300,
+  -2407, -1380, -1239, -770, -1659, -1759, -993, -2976, -2138, -6857, -2717, -9143, -1544, -2029, -1937, -2976,
+  -885, -991, -1141, -1163, -1356, -1337, -1593, -1558, -1037, -2443, -4870, -1496, -1021, -1376, -758, -1285,
+  -2443, -1163, -1163, -824, -1781, -1675, -907, -5817, -2037, -5818, -2036, -1671, -1632, -1931, -1674, -5818,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -5098, -5325, -2618, -1732, -5830, -5581, -4858, -6167, -5325, -9320, -6431, -5457, -4676, -6167, -5833, -5385,
+  -8816, -5456, -4423, -4868, -6425, -8342, -5215, -8676, -8056, -9751, -65, -796, -4284, -2101, -1270, -9194,
+  -3173, -3345, -3066, -3454, -3179, -3093, -1655, -3650, -2830, -3930, -3847, -3441, -3292, -3650, -3179, -1401,
+  -3070, -3300, -3268, -1405, -3978, -3246, -3886, -3674, -3978, -4442, -372, -1251, -2454, -228, -2986, -4036,
+  -3450, -3945, -3775, -3706, -3235, -3783, -3949, -3513, -2122, -5275, -4508, -3674, -3889, -1025, -2367, -3916,
+  -2131, -1666, -2370, -1385, -3861, -4298, -4000, -4631, -4011, -5706, -1142, -2382, -1793, -1213, -1470, -91,
+  -5928, -1291, -1441, -2605, -5844, -2613, -1764, -5781, -979, -5528, -949, -649, -3951, -281, -6033, -2606,
+  -5378, -1121, -1761, -910, -2613, -4256, -4700, -4809, -2100, -5851, -2099, -4597, -5851, -2615, -2615, -9207,
+  -1650, -1766, -1891, -2211, -421, -3075, -3330, -2267, -1347, -1532, -5456, -749, -2822, -2819, -801, -4864,
+  -3335, -1147, -1153, -2001, -1013, -3079, -4948, -2567, -619, -6654, -1841, -2822, -5134, -1921, -2335, -6097,
+  -2292, -3620, -2730, -3674, -1922, -4042, -4249, -24, -2258, -4100, -2460, -2486, -6263, -4041, -1796, -4099,
+  -4100, -2629, -3737, -1957, -2444, -6672, -6374, -4761, -3738, -8081, -3177, -4248, -6560, -3069, -1255, -4168,
+  -1716, -3061, -3060, -1700, -743, -3166, -1888, -2722, -744, -2806, -2912, -1736, -2855, -2976, -1319, -3315,
+  -3574, -1782, -1434, -1920, -1686, -2806, -5186, -5818, -1771, -6893, -250, -1169, -5372, -1031, -2574, -6336,
+  -1794, -2444, -4367, -472, -1685, -4304, -4955, -5760, -4510, -6365, -5410, -1232, -2187, -1014, -2782, -2632,
+  -4968, -372, -1078, -4351, -6570, -2270, -5110, -2525, -4679, -6489, -750, -1725, -8882, -1238, -5654, -6827,
+  -1181, -3492, -3238, -4817, -1171, -1361, -2356, -3481, -910, -6386, -3092, -1117, -2647, -3480, -800, -5026,
+  -3497, -715, -2900, -1367, -1715, -5408, -5110, -5742, -2410, -6817, -324, -1245, -5296, -1828, -2267, -6259,
+  -1377, -4890, -4719, -2669, -737, -3324, -2052, -611, -1106, -6220, -3075, -861, -2076, -1617, -1319, -4860,
+  -2926, -794, -1258, -1620, -1355, -5242, -4944, -3331, -2520, -6651, -586, -1484, -5130, -1217, -2115, -6094,
+  -868, -6887, -8787, -7139, -124, -6886, -7395, -8525, -1028, -6805, -7399, -3227, -2586, -7135, -1261, -7141,
+  -3632, -1437, -2376, -4770, -2218, -9310, -9012, -9644, -3120, -3632, -1051, -2014, -9198, -1852, -3632, -6038,
+  -2488, -2593, -908, -4248, -1201, -1876, -1842, -6803, -5251, -9708, -4906, -1021, -1042, -643, -264, -2745,
+  -4921, -2000, -1421, -1335, -4925, -1489, -8432, -4715, -8444, -3001, -2742, -5333, -6817, -3000, -5589, -2282,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -2174, -4330, -2764, -4092, -432, -2764, -4334, -2256, -847, -5661, -2772, -1825, -2365, -693, -1885, -2767,
+  -2261, -3872, -1237, -2503, -4246, -4683, -2366, -5017, -2260, -6092, -589, -1460, -4571, -726, -1772, -5534,
+  -3056, -7356, -4880, -3571, -295, -3973, -4774, -6924, -2965, -5542, -4987, -2928, -4409, -4946, -3027, -4455,
+  -8183, -4985, -3631, -3840, -3364, -4001, -4542, -8042, -222, -9117, -2974, -3870, -5541, -3759, -4542, -8560,
+  -2088, -2892, -3955, -4796, -1932, -1413, -4398, -4541, -2269, -7694, -4549, -3993, -3098, -1412, -24, -2568,
+  -4805, -3992, -2730, -4034, -2654, -4804, -6418, -4550, -3202, -8125, -2086, -3080, -4803, -2585, -3340, -4806,
+  -2692, -6503, -2158, -1756, -156, -3092, -1957, -4928, -898, -4433, -3772, -3095, -4177, -2989, -747, -4432,
+  -4134, -4347, -2194, -2079, -2914, -3162, -3804, -4945, -2701, -8264, -1734, -2725, -6743, -895, -3689, -7707,
+  -4908, -4398, -4932, -4465, -5313, -2658, -1258, -5673, -4714, -6374, -4903, -2426, -1687, -1686, -1431, -1499,
+  -9164, -1739, -4142, -1498, -1712, -4660, -1225, -6779, -5805, -6374, -93, -1074, -6523, -2349, -2943, -9542,
+  -1218, -5517, -3951, -5278, -1160, -5354, -3700, -1984, -1915, -6847, -6079, -1556, -5460, -3547, -1263, -1629,
+  -3148, -1296, -2417, -1877, -2049, -5870, -3041, -6203, -5583, -7278, -588, -3147, -3956, -590, -337, -6721,
+  -4422, -4917, -2951, -4678, -3324, -3099, -4920, -4485, -4434, -6247, -2953, -4646, -3353, -3341, -4416, -4888,
+  -5743, -2185, -4469, -3089, -914, -5270, -4971, -5603, -4983, -6678, -591, -850, -5157, -590, -332, -6121,
+  -265, -4957, -4115, -3992, -958, -4309, -4358, -5212, -744, -5560, -4516, -4568, -4179, -4418, -834, -4388,
+  -6115, -4557, -3685, -3671, -659, -4244, -4797, -8615, -1275, -9690, -3235, -4171, -6368, -3705, -4926, -9133,
+  -4016, -6385, -4268, -6380, -2567, -5390, -6132, -3983, -1794, -9279, -5147, -4584, -3999, -5669, -2196, -3941,
+  -4872, -7490, -3655, -3460, -3776, -5622, -5010, -8635, -4791, -9709, -96, -1038, -8189, -690, -2202, -6391,
+  -2068, -7841, -5039, -7602, -395, -7678, -7844, -2651, -966, -9171, -8403, -448, -4877, -5141, -1111, -2329,
+  -5472, -636, -3676, -3955, -3965, -5688, -3943, -5515, -1098, -6027, -2960, -3910, -8081, -3681, -4463, -9045,
+  -913, -1656, -3357, -1063, -1211, -4111, -3505, -6864, -2059, -8627, -5482, -3264, -1431, -1652, -1806, -3393,
+  -8123, -135, -1717, -1037, -2318, -5332, -7351, -5333, -5734, -5739, -4169, -5331, -7537, -4495, -5144, -8500,
+  -1395, -5202, -5032, -4963, -840, -5040, -5205, -4770, -1266, -6532, -5765, -4931, -5146, -3233, -2164, -5173,
+  -6028, -4744, -3233, -3044, -2697, -5555, -3640, -3050, -2925, -6963, -406, -661, -5442, -657, -659, -6406,
+  -1313, -7180, -7009, -4342, -287, -7017, -7183, -2767, -1484, -8510, -7742, -4515, -7123, -3813, -261, -7150,
+  -8006, -4534, -3936, -5207, -7095, -7533, -5215, -7866, -7246, -8941, -3355, -4200, -7420, -3532, -5110, -8384,
+  -2286, -5018, -1771, -4780, -2136, -4856, -5022, -1974, -1365, -6349, -5581, -3051, -4962, -4566, -3440, -1337,
+  -5845, -2944, -4571, -1502, -3454, -2610, -5073, -3055, -2436, -6780, -397, -2575, -5259, -210, -2437, -6222,
+  -4939, -5049, -5448, -5446, -3159, -5448, -5198, -5439, -3956, -8344, -5050, -4687, -4509, -5191, -3717, -4298,
+  -7841, -5044, -2980, -6396, -6929, -7367, -7068, -5200, -7080, -5456, -141, -1162, -7254, -479, -4606, -8218,
+  -1463, -3538, -3367, -1970, -932, -3375, -3541, -3106, -380, -4868, -4100, -1969, -3481, -3086, -979, -3508,
+  -4364, -3079, -3090, -2919, -1721, -3890, -3592, -4224, -1976, -5299, -347, -3499, -3778, -1129, -1723, -4742,
+  -835, -1024, -1338, -1458, -1531, -1257, -1864, -1549, -848, -2811, -2256, -1340, -1299, -1687, -735, -1225,
+  -2120, -1205, -1131, -631, -1754, -1917, -1028, -2256, -1843, -2918, -2806, -9085, -1787, -2473, -1734, -6233,
+  -794, -1082, -1200, -1200, -1327, -1399, -1488, -1606, -1030, -5236, -4801, -1350, -1327, -1711, -984, -1249,
+  -1712, -960, -1011, -655, -1562, -1655, -985, -5748, -1968, -5748, -2369, -3273, -1861, -2372, -1561, -5748,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -4825, -5053, -4970, -3837, -2602, -5308, -1180, -5895, -2090, -9048, -6158, -5184, -1627, -5895, -5561, -2196,
+  -8544, -5184, -1477, -4595, -6153, -8070, -2601, -8403, -7783, -9478, -87, -833, -1751, -2327, -1555, -8921,
+  -3330, -3501, -3222, -3610, -1563, -3250, -1308, -3807, -2987, -4086, -4004, -3598, -3448, -3807, -3336, -2955,
+  -1814, -3456, -3424, -1102, -4135, -1817, -4042, -3830, -4135, -4598, -285, -1304, -2610, -362, -1413, -4192,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -5640, -3829, -3369, -1813, -5556, -4154, -2068, -5493, -2067, -5240, -2322, -129, -3663, -944, -5745, -3695,
+  -5090, -774, -3210, -1136, -4184, -2323, -4412, -4521, -3522, -5563, -1326, -2325, -5563, -4814, -4691, -8919,
+  -3700, -487, -3941, -1076, -1020, -5126, -5381, -4318, -3398, -1455, -7507, -678, -4873, -4870, -2011, -6915,
+  -5386, -1787, -437, -820, -3064, -5129, -6998, -4618, -2670, -8705, -3892, -4873, -7184, -1794, -4386, -8148,
+  -3419, -4747, -664, -4801, -852, -5169, -5375, -177, -945, -5227, -1867, -3613, -7390, -5167, -2922, -5226,
+  -5227, -3756, -4864, -1274, -3571, -7799, -7501, -5888, -4864, -9208, -4303, -5375, -7687, -4195, -4685, -5294,
+  -3339, -4684, -4683, -1028, -216, -4789, -1217, -4345, -1201, -4429, -4535, -3359, -4478, -4599, -1214, -4938,
+  -5197, -3405, -576, -3543, -3309, -4429, -6809, -7441, -1620, -8516, -1283, -2792, -6995, -1601, -4197, -7959,
+  -3567, -4706, -3678, -1207, -2341, -3615, -4267, -5071, -3821, -5677, -4721, -1037, -3948, -770, -2094, -4244,
+  -4280, -1929, -1036, -3663, -5882, -4187, -4422, -3915, -3991, -5801, -338, -1374, -8193, -471, -2350, -6139,
+  -2813, -5124, -4870, -6449, -2803, -4, -3988, -5113, -2542, -8018, -4724, -2749, -4279, -5112, -2432, -6658,
+  -5129, -2347, -4532, -2999, -3347, -7040, -6742, -7374, -4042, -8449, -1956, -2877, -6928, -3460, -3899, -7891,
+  -3612, -7125, -6955, -4904, -1711, -5559, -4287, -10, -3341, -8455, -5311, -3096, -1516, -3852, -3554, -7096,
+  -5161, -3030, -3493, -3855, -3591, -7478, -7179, -5566, -4755, -8886, -2821, -3719, -7365, -3452, -4350, -8329,
+  -820, -3254, -5155, -3506, -225, -3253, -3762, -4893, -832, -3173, -3766, -3047, -2594, -3502, -1170, -3509,
+  -3511, -1563, -2499, -1138, -1950, -5678, -5380, -6011, -2163, -3768, -830, -1764, -5566, -1609, -2550, -2405,
+  -3728, -3564, -571, -735, -1523, -3355, -3145, -5839, -4287, -8744, -3943, -2024, -3369, -1143, -2976, -2037,
+  -3958, -1036, -525, -507, -1525, -3609, -7469, -3751, -7480, -4485, -2031, -4370, -5854, -4127, -2037, -5138,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -2580, -4736, -3170, -4497, -306, -3170, -4740, -2662, -1252, -6066, -3177, -2230, -2771, -1099, -2291, -3173,
+  -2666, -4278, -393, -2908, -4652, -5089, -2771, -5422, -2665, -6497, -994, -1865, -4977, -1132, -2178, -5940,
+  -522, -7639, -2069, -397, -1076, -4257, -1501, -7207, -2432, -5826, -2069, -962, -2474, -2069, -2200, -1162,
+  -8466, -5268, -1663, -951, -876, -2472, -4825, -8326, -1499, -9401, -1702, -4154, -5824, -2470, -4826, -8843,
+  -3093, -752, -4959, -5800, -937, -1175, -5403, -5546, -672, -8698, -5554, -4998, -2161, -1756, -1816, -1902,
+  -5810, -4997, -849, -5039, -3659, -5808, -7422, -5554, -4206, -9129, -480, -1650, -5808, -733, -1188, -5810,
+  -2260, -7864, -1360, -271, -1359, -1751, -2242, -6289, -924, -5794, -1857, -1302, -1857, -1924, -3655, -2263,
+  -5495, -2113, -2106, -1012, -1195, -4523, -5164, -6305, -4062, -9625, -943, -2006, -8104, -751, -5050, -9068,
+  -3630, -3120, -3654, -3188, -4035, -2333, -3497, -4395, -3436, -5097, -3626, -2723, -2736, -2356, -3342, -3035,
+  -7887, -285, -2865, -2724, -352, -3383, -2904, -5502, -4528, -5097, -2497, -3465, -5245, -1665, -748, -8264,
+  -2971, -7269, -5703, -7030, -1011, -7107, -5453, -3737, -1534, -8599, -7832, -1494, -7213, -5300, -181, -669,
+  -4900, -2295, -4170, -1750, -2340, -7622, -1429, -7955, -7335, -9030, -933, -1835, -5709, -1940, -4181, -8473,
+  -3572, -4067, -2100, -3828, -2474, -2249, -4070, -3635, -3583, -5397, -2103, -3796, -2503, -2491, -3566, -4037,
+  -4893, -1334, -3619, -2239, -64, -4419, -4121, -4753, -4133, -5828, -1438, -2503, -4307, -1384, -979, -5271,
+  -1331, -1878, -4363, -4240, -580, -1000, -2419, -5460, -1491, -5808, -4764, -2313, -4427, -1051, -3757, -1301,
+  -6363, -2230, -435, -1403, -4550, -2106, -5045, -8863, -1651, -9938, -728, -1801, -6616, -911, -1975, -9381,
+  -1747, -6337, -1316, -6332, -517, -5342, -6084, -1791, -1153, -9231, -2559, -1060, -3951, -2560, -3671, -1708,
+  -2559, -7442, -1894, -648, -985, -5574, -4962, -8587, -4743, -9661, -482, -1453, -8141, -1137, -1709, -6343,
+  -1526, -8163, -5361, -7924, -922, -8000, -8166, -1390, -1297, -9493, -8725, -4414, -1434, -5463, -3662, -6092,
+  -5794, -1839, -1462, -1448, -1676, -6010, -1651, -5837, -2394, -6349, -143, -1133, -8403, -1271, -4785, -9367,
+  -2311, -2588, -2255, -3019, -2288, -3010, -2403, -5763, -2601, -7525, -4381, -2163, -27, -2119, -2975, -2291,
+  -7021, -1812, -1183, -1986, -3434, -4231, -6249, -4231, -4633, -4637, -3067, -4230, -6435, -3393, -4042, -7399,
+  -1245, -5052, -4882, -4813, -691, -4890, -5056, -4620, -83, -6383, -5615, -4781, -4996, -3083, -2014, -5023,
+  -5879, -4594, -3083, -2894, -2547, -5405, -3490, -2900, -2775, -6813, -2967, -3087, -5293, -2105, -2353, -6256,
+  -689, -4839, -4668, -2001, -768, -4676, -4842, -426, -625, -6169, -5401, -2174, -4782, -1472, -999, -4809,
+  -5665, -2193, -1595, -2866, -4754, -5192, -2874, -5525, -4905, -6600, -1014, -1859, -5079, -1191, -2768, -6043,
+  -1987, -4719, -1472, -4480, -1837, -4557, -4722, -1674, -1066, -6049, -5282, -2752, -4662, -4267, -3141, -1038,
+  -5545, -2645, -4271, -1202, -3154, -2311, -4773, -2755, -2137, -6480, -1495, -2275, -4959, -1369, -105, -5923,
+  -3008, -3118, -3517, -3515, -1228, -3517, -256, -3508, -2025, -6413, -3119, -2756, -2578, -3260, -1786, -2367,
+  -5909, -3113, -1049, -4465, -4998, -5436, -5137, -3269, -5149, -3525, -417, -1322, -5323, -1217, -2675, -6287,
+  -235, -3388, -3218, -1820, -782, -3226, -3391, -2956, -1232, -4718, -3951, -1819, -3331, -2936, -829, -3359,
+  -4214, -2929, -2940, -2769, -1571, -3741, -3442, -4074, -1826, -5149, -907, -3349, -3628, -979, -1573, -4592,
+  -1155, -2634, -1312, -1314, -1568, -1562, -1569, -1316, -1550, -4600, -3906, -1565, -449, -1316, -2474, -977,
+  -3906, -1312, -853, -1046, -3367, -3283, -573, -4428, -3595, -5049, -2662, -7336, -3079, -3923, -3156, -4484,
+  -1405, -1663, -1661, -1804, -1879, -1820, -2080, -2157, -492, -3374, -2939, -503, -1806, -2094, -1576, -1629,
+  -2728, -1655, -1552, -1210, -2282, -2277, -495, -3885, -2595, -3886, -2100, -1411, -2233, -2515, -1696, -3886,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -3480, -3707, -3625, -2491, -4212, -3963, -3240, -4549, -3706, -7702, -4813, -3838, -3058, -4549, -4215, -3767,
+  -7198, -3838, -2805, -3250, -4807, -6724, -3596, -7058, -6438, -8133, -1066, -2166, -2665, -2088, -25, -7575,
+  -2169, -2340, -2061, -2449, -2175, -2089, -1938, -2646, -1826, -2925, -2843, -2437, -2287, -2646, -2175, -1794,
+  -2066, -2295, -2263, -1992, -2974, -2241, -2881, -2669, -2974, -3437, -574, -1633, -1450, -239, -652, -3032,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -5564, -1332, -994, -1842, -5479, -4077, -3816, -5416, -1842, -5163, -3836, -732, -3587, -835, -5668, -897,
+  -5013, -535, -1834, -422, -4108, -3891, -4335, -4445, -3446, -5487, -3425, -4233, -5486, -4737, -4615, -8843,
+  -1650, -1766, -1891, -2211, -421, -3075, -3330, -2267, -1347, -1532, -5456, -749, -2822, -2819, -801, -4864,
+  -3335, -1147, -1153, -2001, -1013, -3079, -4948, -2567, -619, -6654, -1841, -2822, -5134, -1921, -2335, -6097,
+  -1036, -2364, -1474, -2418, -666, -2786, -2992, -712, -1002, -2844, -1204, -1230, -5007, -2785, -539, -2843,
+  -2844, -1373, -2481, -701, -1188, -5416, -5118, -3505, -2482, -6825, -1920, -2992, -5304, -1812, -2302, -2911,
+  -1716, -3061, -3060, -1700, -743, -3166, -1888, -2722, -744, -2806, -2912, -1736, -2855, -2976, -1319, -3315,
+  -3574, -1782, -1434, -1920, -1686, -2806, -5186, -5818, -1771, -6893, -250, -1169, -5372, -1031, -2574, -6336,
+  -2791, -5160, -4132, -1001, -4190, -4069, -1918, -2210, -1953, -6131, -5175, -1190, -2397, -990, -5160, -4698,
+  -4734, -325, -929, -4117, -6336, -4641, -4876, -1352, -2291, -6255, -554, -1406, -8647, -1176, -5420, -6593,
+  -1181, -3492, -3238, -4817, -1171, -1361, -2356, -3481, -910, -6386, -3092, -1117, -2647, -3480, -800, -5026,
+  -3497, -715, -2900, -1367, -1715, -5408, -5110, -5742, -2410, -6817, -324, -1245, -5296, -1828, -2267, -6259,
+  -1377, -4890, -4719, -2669, -737, -3324, -2052, -611, -1106, -6220, -3075, -861, -2076, -1617, -1319, -4860,
+  -2926, -794, -1258, -1620, -1355, -5242, -4944, -3331, -2520, -6651, -586, -1484, -5130, -1217, -2115, -6094,
+  -820, -3254, -5155, -3506, -225, -3253, -3762, -4893, -832, -3173, -3766, -3047, -2594, -3502, -1170, -3509,
+  -3511, -1563, -2499, -1138, -1950, -5678, -5380, -6011, -2163, -3768, -830, -1764, -5566, -1609, -2550, -2405,
+  -1972, -973, -1862, -913, -821, -3697, -1968, -6181, -1462, -9086, -4284, -2116, -3711, -898, -392, -4505,
+  -4299, -1175, -998, -779, -4304, -1660, -7810, -4093, -7822, -1718, -3842, -4711, -6195, -1611, -4967, -5480,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -2174, -4330, -2764, -4092, -432, -2764, -4334, -2256, -847, -5661, -2772, -1825, -2365, -693, -1885, -2767,
+  -2261, -3872, -1237, -2503, -4246, -4683, -2366, -5017, -2260, -6092, -589, -1460, -4571, -726, -1772, -5534,
+  -864, -5164, -2688, -1379, -590, -1781, -2582, -4732, -773, -3350, -2795, -736, -2217, -2754, -836, -2263,
+  -5991, -2793, -1439, -1648, -1173, -1809, -2350, -5850, -994, -6925, -783, -1678, -3349, -1567, -2350, -6368,
+  -674, -1478, -2541, -3382, -518, -2123, -2984, -3127, -855, -6280, -3135, -2579, -1684, -1994, -794, -1154,
+  -3391, -2578, -1316, -2620, -1240, -3390, -5004, -3136, -1788, -6711, -671, -1666, -3389, -1171, -1926, -3392,
+  -2046, -5857, -1512, -1110, -1428, -2446, -1311, -4282, -1952, -3787, -3126, -2449, -3531, -2343, -1648, -3786,
+  -3488, -3701, -1548, -1433, -2268, -2516, -3158, -4299, -2055, -7618, -1088, -2079, -6097, -249, -512, -7061,
+  -3451, -2941, -3475, -3009, -3856, -2153, -3318, -4216, -675, -4917, -3446, -230, -2556, -2176, -3163, -2856,
+  -7707, -1068, -2685, -2545, -633, -3203, -2725, -5322, -4348, -4917, -2318, -3285, -5066, -1080, -4217, -8085,
+  -624, -4922, -3356, -4683, -565, -4760, -3106, -1390, -1321, -6253, -5485, -962, -4866, -2953, -668, -1034,
+  -2553, -702, -1823, -1282, -1455, -5275, -2447, -5609, -4988, -6683, -1479, -2553, -3362, -1612, -1834, -6126,
+  -3572, -4067, -2100, -3828, -2474, -2249, -4070, -3635, -3583, -5397, -2103, -3796, -2503, -2491, -3566, -4037,
+  -4893, -1334, -3619, -2239, -64, -4419, -4121, -4753, -4133, -5828, -1438, -2503, -4307, -1384, -979, -5271,
+  -815, -2380, -1538, -1415, -494, -1732, -1781, -2635, -973, -2982, -1938, -1990, -1602, -1841, -932, -1810,
+  -3538, -1979, -1108, -1094, -1725, -1667, -2220, -6038, -1425, -7113, -658, -1593, -3791, -1128, -2349, -6555,
+  -1920, -4290, -2173, -4285, -1303, -3294, -4036, -1887, -1553, -7183, -3051, -2489, -1904, -3574, -1624, -1846,
+  -2777, -5394, -1559, -1364, -1681, -3527, -2915, -6539, -2696, -7614, -198, -1852, -6093, -482, -2633, -4295,
+  -2001, -6173, -3372, -5935, -1578, -6011, -6177, -983, -1615, -7504, -6736, -2425, -3210, -3473, -1672, -4102,
+  -3804, -2039, -2008, -2287, -2298, -4021, -2275, -406, -2430, -4360, -1292, -2242, -6414, -401, -661, -7377,
+  -2068, -2345, -2012, -2776, -2045, -2767, -2160, -5520, -2358, -7283, -4138, -25, -1977, -1876, -2733, -2049,
+  -6779, -1570, -1835, -1744, -3191, -3988, -6007, -3989, -4390, -4395, -2825, -3987, -6193, -3151, -3800, -7156,
+  -733, -4540, -4370, -4301, -179, -4378, -4544, -4108, -604, -5871, -5103, -4269, -4484, -2571, -1502, -4511,
+  -5367, -4082, -2571, -2382, -2035, -4893, -2978, -2388, -2263, -6301, -2455, -2575, -4781, -1593, -1841, -5744,
+  -945, -5095, -4924, -2257, -1024, -4932, -5098, -682, -881, -6425, -5657, -2430, -5038, -1728, -1255, -5065,
+  -5921, -2449, -1851, -3122, -5010, -5448, -3130, -5781, -5161, -6856, -1270, -2115, -5335, -1447, -256, -6299,
+  -2136, -4869, -1621, -4630, -1986, -4706, -4872, -1824, -1216, -6199, -5431, -2902, -4812, -4417, -3290, -1188,
+  -5695, -2794, -4421, -1352, -3304, -2460, -4923, -2905, -254, -6630, -393, -2425, -5109, -1519, -2287, -6073,
+  -3520, -3630, -4029, -4027, -1740, -4029, -3779, -4020, -2537, -6925, -3631, -3268, -3090, -3772, -2298, -2879,
+  -6421, -3625, -1561, -4977, -5510, -5948, -5649, -3781, -5661, -4037, -409, -1834, -5835, -1729, -173, -6799,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -554, -574, -1832, -2000, -588, -1847, -2188, -2196, -1582, -3620, -2926, -1962, -1876, -2208, -1494, -1828,
+  -2926, -1815, -1684, -531, -2387, -2303, -1728, -3448, -2616, -4069, -1682, -6356, -2099, -2943, -2177, -3504,
+  -480, -1663, -1661, -1804, -1879, -1820, -2080, -2157, -492, -3374, -2939, -1888, -1806, -2094, -1576, -494,
+  -2728, -1655, -1552, -1210, -2282, -2277, -1642, -3885, -2595, -3886, -2100, -1411, -2233, -2515, -1696, -3886,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -3621, -3849, -3766, -546, -4354, -4104, -3381, -4691, -3848, -7843, -4954, -3980, -3200, -4690, -4357, -3909,
+  -7339, -3979, -2947, -3391, -4949, -6866, -3738, -7199, -6579, -8274, -358, -372, -2807, -2230, -1385, -7717,
+  -2665, -2837, -2558, -2946, -2671, -2585, -2434, -3142, -2322, -3422, -3339, -2933, -2784, -3142, -2671, -2291,
+  -2562, -2792, -2760, -2489, -3470, -2738, -3378, -3166, -3470, -3934, -336, -2129, -1946, -207, -2478, -3528,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -5906, -4095, -3635, -3931, -5821, -4420, -4158, -5759, -3992, -5505, -4179, -1279, -3929, -1501, -6011, -3961,
+  -5356, -616, -341, -559, -4450, -1568, -4677, -2592, -752, -5829, -3767, -4575, -5828, -5080, -4957, -9185,
+  -1650, -1766, -1891, -2211, -421, -3075, -3330, -2267, -1347, -1532, -5456, -749, -2822, -2819, -801, -4864,
+  -3335, -1147, -1153, -2001, -1013, -3079, -4948, -2567, -619, -6654, -1841, -2822, -5134, -1921, -2335, -6097,
+  -1036, -2364, -1474, -2418, -666, -2786, -2992, -712, -1002, -2844, -1204, -1230, -5007, -2785, -539, -2843,
+  -2844, -1373, -2481, -701, -1188, -5416, -5118, -3505, -2482, -6825, -1920, -2992, -5304, -1812, -2302, -2911,
+  -3008, -4352, -4352, -2991, -10, -4457, -3180, -4013, -2035, -4098, -4204, -3028, -4146, -4268, -2610, -4607,
+  -4865, -3074, -2725, -3212, -2978, -4097, -6478, -7109, -3062, -8184, -1541, -2460, -6664, -2323, -3865, -7627,
+  -1310, -2513, -3842, -1222, -502, -3779, -4431, -5235, -1389, -5840, -4885, -890, -4112, -1269, -4869, -4407,
+  -4444, -302, -1742, -1627, -6045, -2511, -4586, -4079, -4154, -5964, -1038, -1793, -8357, -3815, -5129, -6303,
+  -1181, -3492, -3238, -4817, -1171, -1361, -2356, -3481, -910, -6386, -3092, -1117, -2647, -3480, -800, -5026,
+  -3497, -715, -2900, -1367, -1715, -5408, -5110, -5742, -2410, -6817, -324, -1245, -5296, -1828, -2267, -6259,
+  -1377, -4890, -4719, -2669, -737, -3324, -2052, -611, -1106, -6220, -3075, -861, -2076, -1617, -1319, -4860,
+  -2926, -794, -1258, -1620, -1355, -5242, -4944, -3331, -2520, -6651, -586, -1484, -5130, -1217, -2115, -6094,
+  -1209, -6109, -8010, -6361, -465, -6108, -6617, -7748, -184, -6028, -6621, -5902, -5449, -6357, -1040, -6364,
+  -6366, -4418, -5354, -3993, -4805, -8533, -8235, -8866, -1638, -6623, -3685, -4619, -8421, -4464, -5405, -5260,
+  -4347, -4182, -2243, -1936, -4017, -1805, -3763, -6458, -4906, -9363, -4561, -471, -2646, -833, -3595, -4782,
+  -4576, -2635, -1322, -207, -4580, -4227, -8087, -4370, -8099, -5104, -4119, -4988, -6472, -4746, -5244, -5756,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -2174, -4330, -2764, -4092, -432, -2764, -4334, -2256, -847, -5661, -2772, -1825, -2365, -693, -1885, -2767,
+  -2261, -3872, -1237, -2503, -4246, -4683, -2366, -5017, -2260, -6092, -589, -1460, -4571, -726, -1772, -5534,
+  -1988, -6288, -3813, -2504, -594, -2906, -3707, -5856, -1898, -4475, -3919, -1860, -3342, -3879, -1960, -3387,
+  -7115, -3917, -2563, -2772, -2297, -2933, -3475, -6975, -99, -8050, -1907, -2803, -4474, -2692, -3475, -7493,
+  -674, -1478, -2541, -3382, -518, -2123, -2984, -3127, -855, -6280, -3135, -2579, -1684, -1994, -794, -1154,
+  -3391, -2578, -1316, -2620, -1240, -3390, -5004, -3136, -1788, -6711, -671, -1666, -3389, -1171, -1926, -3392,
+  -3345, -7157, -2811, -2410, -1782, -3746, -2610, -5582, -3252, -5087, -4425, -3748, -4830, -3642, -2948, -5086,
+  -4788, -5001, -1090, -2733, -3567, -3816, -961, -5598, -3354, -8918, -125, -1149, -7397, -836, -4343, -8361,
+  -4248, -3737, -4272, -3805, -4653, -2950, -4115, -5012, -4053, -5714, -4243, -3341, -3353, -2000, -1564, -3652,
+  -8504, -969, -3482, -3342, -409, -4000, -3521, -6119, -5145, -5714, -253, -1080, -5862, -1472, -5013, -8881,
+  -624, -4922, -3356, -4683, -565, -4760, -3106, -1390, -1321, -6253, -5485, -962, -4866, -2953, -668, -1034,
+  -2553, -702, -1823, -1282, -1455, -5275, -2447, -5609, -4988, -6683, -1479, -2553, -3362, -1612, -1834, -6126,
+  -3572, -4067, -2100, -3828, -2474, -2249, -4070, -3635, -3583, -5397, -2103, -3796, -2503, -2491, -3566, -4037,
+  -4893, -1334, -3619, -2239, -64, -4419, -4121, -4753, -4133, -5828, -1438, -2503, -4307, -1384, -979, -5271,
+  -1921, -3486, -2644, -2521, -1600, -2838, -2887, -3742, -157, -4089, -3045, -3097, -2708, -2947, -440, -2917,
+  -4644, -3086, -2214, -2200, -2831, -2773, -3326, -7144, -2532, -8219, -1764, -2700, -4898, -2234, -3455, -7662,
+  -3098, -5467, -3350, -5462, -2481, -4472, -5214, -3065, -2731, -8361, -4229, -3666, -3081, -4751, -2801, -3023,
+  -3954, -6572, -2737, -2542, -2858, -4704, -4092, -7716, -3873, -8791, -194, -1093, -7271, -397, -1688, -5472,
+  -1851, -6023, -3222, -5785, -1428, -5861, -6027, -834, -1465, -7354, -6586, -2275, -3060, -3324, -98, -3953,
+  -3654, -1889, -1859, -2138, -2148, -3871, -2126, -3698, -2280, -4210, -1143, -2092, -6264, -1864, -2646, -7227,
+  -1094, -1371, -1038, -1802, -1071, -1792, -1186, -4546, -1384, -6308, -3163, -945, -1002, -902, -1758, -1074,
+  -5804, -595, -861, -769, -2216, -3014, -5032, -3014, -3416, -3420, -1850, -3012, -5218, -2176, -2825, -6182,
+  -733, -4540, -4370, -4301, -179, -4378, -4544, -4108, -604, -5871, -5103, -4269, -4484, -2571, -1502, -4511,
+  -5367, -4082, -2571, -2382, -2035, -4893, -2978, -2388, -2263, -6301, -2455, -2575, -4781, -1593, -1841, -5744,
+  -1201, -5351, -5180, -2513, -1280, -5188, -5354, -938, -1137, -6681, -5913, -2686, -5294, -1984, -488, -5321,
+  -6177, -2705, -2107, -3378, -5266, -5704, -512, -6037, -5417, -7112, -1526, -2371, -5591, -498, -3280, -6555,
+  -1475, -4207, -960, -3968, -1325, -4045, -4210, -1162, -554, -5537, -4770, -2240, -4150, -3755, -2629, -526,
+  -5033, -2133, -3759, -690, -2642, -1799, -4261, -2243, -1625, -5968, -983, -1763, -4447, -857, -1625, -5411,
+  -2752, -2862, -3261, -3259, -972, -3261, -3011, -3252, -1769, -6157, -2863, -2500, -2322, -3004, -1530, -2111,
+  -5653, -2857, -793, -4209, -4742, -5180, -4881, -3013, -4893, -3269, -161, -1066, -5067, -961, -2419, -6031,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -774, -999, -1036, -1672, -2008, -987, -1417, -1548, -914, -5293, -4599, -1381, -944, -2009, -964, -1752,
+  -2267, -1498, -1415, -562, -2010, -1548, -1109, -5122, -2266, -5743, -1546, -8030, -1754, -4616, -2263, -5177,
+  -829, -1166, -1414, -1020, -1421, -1020, -2998, -3075, -1017, -4292, -3857, -1021, -915, -3012, -831, -1412,
+  -3646, -1165, -1163, -759, -1427, -3195, -832, -4803, -3513, -4804, -3017, -2328, -3150, -3432, -2614, -4804,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -4315, -4543, -4460, -738, -5047, -4798, -4075, -5385, -4542, -8537, -5648, -4674, -1206, -5384, -5051, -2091,
+  -8033, -4673, -1004, -4085, -5642, -7560, -2091, -7893, -7273, -8968, -156, -887, -3501, -2924, -1829, -8411,
+  -2102, -2273, -1994, -2382, -2107, -2022, -1870, -2579, -1759, -2858, -2776, -2370, -2220, -2579, -2108, -1727,
+  -1999, -2228, -2196, -584, -2906, -2174, -2814, -2602, -2907, -3370, -506, -1565, -1382, -313, -1914, -2964,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -4502, -2691, -336, -2527, -4418, -3016, -2754, -4355, -2588, -4102, -2775, -2090, -213, -1707, -4607, -2557,
+  -3952, -1997, -2072, -1926, -3046, -2829, -3273, -3383, -2384, -4425, -2363, -3171, -4424, -3676, -3553, -7781,
+  -1650, -1766, -1891, -2211, -421, -3075, -3330, -2267, -1347, -1532, -5456, -749, -2822, -2819, -801, -4864,
+  -3335, -1147, -1153, -2001, -1013, -3079, -4948, -2567, -619, -6654, -1841, -2822, -5134, -1921, -2335, -6097,
+  -2729, -4057, -3167, -4111, -113, -4479, -4686, -2405, -504, -4537, -2897, -2924, -6700, -4478, -2233, -4536,
+  -4537, -3066, -4174, -2394, -2881, -7110, -6811, -5198, -4175, -8518, -3614, -4686, -6997, -3506, -3996, -4605,
+  -1716, -3061, -3060, -1700, -743, -3166, -1888, -2722, -744, -2806, -2912, -1736, -2855, -2976, -1319, -3315,
+  -3574, -1782, -1434, -1920, -1686, -2806, -5186, -5818, -1771, -6893, -250, -1169, -5372, -1031, -2574, -6336,
+  -2551, -3689, -2662, -65, -2719, -2599, -3251, -4055, -2805, -4660, -3705, -2816, -2932, -1308, -3689, -3227,
+  -3264, -1055, -1062, -2646, -4865, -3171, -3406, -2899, -2974, -4784, -1740, -2591, -7177, -2635, -3949, -5123,
+  -1181, -3492, -3238, -4817, -1171, -1361, -2356, -3481, -910, -6386, -3092, -1117, -2647, -3480, -800, -5026,
+  -3497, -715, -2900, -1367, -1715, -5408, -5110, -5742, -2410, -6817, -324, -1245, -5296, -1828, -2267, -6259,
+  -1377, -4890, -4719, -2669, -737, -3324, -2052, -611, -1106, -6220, -3075, -861, -2076, -1617, -1319, -4860,
+  -2926, -794, -1258, -1620, -1355, -5242, -4944, -3331, -2520, -6651, -586, -1484, -5130, -1217, -2115, -6094,
+  -639, -4747, -6648, -5000, -1719, -4747, -5255, -6386, -78, -4666, -5260, -4541, -4087, -4996, -2663, -5002,
+  -5005, -3056, -3992, -2631, -3444, -7171, -6873, -7505, -3656, -5261, -2323, -3257, -7059, -3103, -4043, -3898,
+  -3787, -1210, -3118, -3343, -3457, -3414, -3204, -5898, -1840, -8803, -4002, -3296, -3428, -904, -162, -1840,
+  -4016, -3147, -609, -1818, -4021, -1838, -7527, -2093, -7539, -4544, -3559, -4429, -5913, -1840, -4685, -5197,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -2174, -4330, -2764, -4092, -432, -2764, -4334, -2256, -847, -5661, -2772, -1825, -2365, -693, -1885, -2767,
+  -2261, -3872, -1237, -2503, -4246, -4683, -2366, -5017, -2260, -6092, -589, -1460, -4571, -726, -1772, -5534,
+  -1376, -5676, -3200, -1891, -444, -2293, -3094, -5244, -1285, -256, -3307, -1248, -2729, -3266, -1348, -2775,
+  -6503, -3305, -1951, -2160, -1685, -2321, -2862, -6362, -1506, -7437, -1295, -2190, -3861, -2079, -2862, -6880,
+  -674, -1478, -2541, -3382, -518, -2123, -2984, -3127, -855, -6280, -3135, -2579, -1684, -1994, -794, -1154,
+  -3391, -2578, -1316, -2620, -1240, -3390, -5004, -3136, -1788, -6711, -671, -1666, -3389, -1171, -1926, -3392,
+  -1534, -5345, -1000, -598, -916, -1934, -799, -3770, -1440, -3275, -2614, -1937, -3019, -1831, -1136, -3274,
+  -2976, -3189, -1036, -921, -1756, -2004, -2646, -3787, -1543, -7106, -576, -1567, -5585, -1221, -2531, -6549,
+  -2220, -1710, -2244, -1778, -2625, -923, -2087, -2985, -2026, -3687, -2216, -1313, -1326, -946, -1932, -1625,
+  -6477, -1086, -1455, -1314, -1102, -1973, -1494, -4092, -3118, -3687, -1087, -2055, -3835, -255, -2986, -6854,
+  -1120, -7047, -5481, -6808, -117, -6885, -5231, -3514, -2114, -8377, -7610, -631, -6990, -5077, -2793, -3159,
+  -4678, -1202, -3947, -3407, -3580, -7400, -4571, -7733, -7113, -8808, -3603, -4677, -5486, -3737, -3959, -8251,
+  -3572, -4067, -2100, -3828, -2474, -2249, -4070, -3635, -3583, -5397, -2103, -3796, -2503, -2491, -3566, -4037,
+  -4893, -1334, -3619, -2239, -64, -4419, -4121, -4753, -4133, -5828, -1438, -2503, -4307, -1384, -979, -5271,
+  -1409, -2974, -2132, -2009, -1088, -2326, -2375, -3230, -1568, -3577, -2533, -2585, -2196, -2435, -1526, -2405,
+  -4132, -2574, -1702, -1688, -2319, -2261, -2814, -6632, -2020, -7707, -168, -590, -4386, -1722, -2943, -7150,
+  -1408, -3778, -1661, -3773, -791, -2782, -3524, -1375, -1041, -6671, -2539, -1977, -1392, -3062, -1112, -1334,
+  -2265, -4882, -1047, -852, -1169, -3015, -2403, -6027, -2184, -7102, -401, -1340, -5581, -909, -2121, -3783,
+  -3300, -7472, -4671, -7233, -626, -7310, -7475, -780, -1691, -8802, -8035, -3723, -4508, -4772, -2971, -5401,
+  -5103, -1297, -3307, -3586, -328, -5320, -3574, -5146, -1448, -5658, -606, -1365, -7712, -1951, -4095, -8676,
+  -1350, -1627, -1294, -2058, -1327, -2048, -1442, -4802, -1640, -6564, -3419, -1201, -1258, -1158, -2014, -1330,
+  -6060, -851, -1117, -1025, -2472, -3270, -5288, -3270, -3672, -3676, -2106, -3268, -5474, -2432, -256, -6438,
+  -1619, -5426, -5256, -5187, -1064, -5264, -5429, -4994, -457, -6756, -5989, -5155, -5369, -3456, -2388, -5397,
+  -6252, -4967, -3456, -3268, -2920, -5779, -3864, -3274, -3149, -7187, -885, -3461, -5666, -372, -628, -6630,
+  -689, -4839, -4668, -2001, -768, -4676, -4842, -426, -625, -6169, -5401, -2174, -4782, -1472, -999, -4809,
+  -5665, -2193, -1595, -2866, -4754, -5192, -2874, -5525, -4905, -6600, -1014, -1859, -5079, -1191, -2768, -6043,
+  -1987, -4719, -1472, -4480, -1837, -4557, -4722, -1674, -1066, -6049, -5282, -2752, -4662, -4267, -3141, -1038,
+  -5545, -2645, -4271, -1202, -3154, -2311, -4773, -511, -2137, -6480, -1495, -2275, -4959, -238, -2137, -5923,
+  -3799, -3908, -4307, -4306, -2018, -4307, -4057, -4299, -2816, -7204, -3910, -3546, -3368, -4051, -2576, -3158,
+  -6700, -3904, -1839, -5255, -5789, -6226, -5928, -4059, -5939, -1046, -295, -2112, -6114, -275, -3465, -7077,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -1001, -1650, -2907, -1262, -1664, -528, -1665, -1412, -899, -4696, -4001, -1661, -1659, -3284, -601, -1006,
+  -4001, -1260, -900, -1607, -3462, -1666, -1072, -4524, -1668, -5145, -2757, -7432, -1664, -4018, -1665, -4579,
+  -646, -2069, -2066, -907, -2285, -907, -659, -2563, -898, -3780, -3345, -2293, -2212, -2500, -1982, -900,
+  -3134, -2061, -896, -1615, -2688, -2683, -653, -4291, -3001, -4292, -2505, -1816, -2638, -2920, -2102, -4292,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -4018, -4246, -4163, -220, -4751, -4501, -3778, -5088, -4245, -8240, -5351, -4377, -3597, -5087, -4754, -4306,
+  -7737, -4377, -1789, -3788, -5346, -7263, -4135, -7596, -6976, -8671, -375, -941, -3204, -2627, -3042, -8114,
+  -2554, -2725, -2446, -2834, -2559, -2474, -2322, -3031, -2211, -3310, -3228, -2822, -2672, -3031, -2560, -2179,
+  -2451, -2680, -2648, -2377, -3358, -2626, -3266, -3054, -3359, -3822, -510, -2017, -1834, -156, -1036, -3416,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -3908, -2096, -1637, -1933, -3823, -2421, -2160, -3760, -1993, -3507, -2180, -178, -1931, -1113, -4012, -1963,
+  -3357, -1403, -1477, -1332, -2452, -2235, -2679, -2788, -1789, -3830, -1769, -2577, -3830, -594, -2958, -7186,
+  -508, -2278, -2403, -2723, -410, -3587, -3842, -2779, -1859, -2044, -5968, -1261, -3334, -3331, -1313, -5376,
+  -3847, -1659, -1665, -2513, -1525, -3591, -5460, -3079, -1131, -7166, -2353, -3334, -5646, -510, -2847, -6609,
+  -1292, -2620, -1730, -2674, -922, -3042, -3248, -968, -1258, -3100, -1460, -1486, -5263, -3041, -795, -3099,
+  -3100, -1629, -2737, -957, -1444, -5672, -5374, -3761, -2738, -7081, -2176, -3248, -5560, -253, -2558, -3167,
+  -1972, -3317, -3316, -1956, -999, -3422, -2144, -2978, -1000, -3062, -3168, -1992, -3111, -3232, -1575, -3571,
+  -3830, -2038, -1690, -2176, -1942, -3062, -5442, -6074, -2027, -7149, -506, -1425, -5628, -234, -2830, -6592,
+  -1323, -4654, -3627, -1781, -3684, -3564, -2296, -5019, -3770, -5625, -4669, -301, -3896, -3270, -4654, -4192,
+  -4228, -3060, -1190, -612, -5830, -4135, -4370, -3863, -3939, -5749, -760, -1578, -8141, -708, -4914, -6087,
+  -1437, -3748, -3494, -5073, -1427, -1617, -2612, -3737, -1166, -6642, -3348, -1373, -2903, -3736, -1056, -5282,
+  -3753, -971, -3156, -1623, -1971, -5664, -5366, -5998, -2666, -7073, -580, -1501, -5552, -253, -2523, -6515,
+  -1783, -5295, -5125, -3074, -359, -3729, -2458, -1016, -1511, -6626, -3481, -1267, -2481, -2022, -1725, -5266,
+  -3332, -1200, -1663, -2026, -1761, -5648, -5350, -3737, -2926, -7057, -991, -1890, -5536, -392, -2520, -6499,
+  -1076, -3510, -5411, -3762, -481, -3509, -4018, -5149, -1088, -3429, -4022, -3303, -2850, -3758, -1426, -3765,
+  -3767, -1819, -2755, -1394, -2206, -5934, -5636, -6267, -2419, -4024, -1086, -2020, -5822, -251, -2806, -2661,
+  -3197, -3032, -2527, -2752, -693, -2823, -2613, -5308, -3755, -8213, -3411, -2706, -2837, -67, -2445, -3631,
+  -3426, -2556, -2321, -2270, -3430, -3077, -6937, -3219, -6948, -3953, -2968, -3838, -5322, -3595, -4094, -4606,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -2686, -4842, -3276, -4604, -944, -3276, -4846, -256, -1359, -6173, -3284, -2337, -2877, -1205, -2397, -3279,
+  -511, -4384, -1749, -3015, -4758, -5195, -2878, -5529, -2772, -6604, -1101, -1972, -5083, -1238, -2284, -6046,
+  -1675, -5976, -3500, -2191, -382, -2593, -3394, -5544, -208, -4162, -3606, -1548, -3029, -3566, -1647, -3074,
+  -6802, -3604, -2250, -2459, -1984, -2620, -3162, -6662, -1805, -7737, -1594, -2490, -4161, -2379, -3162, -7180,
+  -1649, -2453, -3515, -4356, -1493, -3098, -3959, -4102, -307, -7254, -4110, -3554, -2658, -2969, -934, -310,
+  -4366, -3553, -2291, -3595, -2215, -4365, -5979, -4110, -2762, -7685, -1646, -2641, -4364, -2146, -2900, -4366,
+  -1939, -5751, -1405, -1004, -1322, -2340, -1204, -4176, -1846, -3681, -3019, -2343, -3424, -2236, -1542, -3680,
+  -3382, -3595, -1442, -376, -2161, -2410, -3051, -406, -1949, -7512, -981, -1973, -5991, -1627, -2937, -6955,
+  -3707, -3197, -3731, -3265, -4112, -2409, -3574, -4472, -3513, -5173, -3702, -2800, -2812, -408, -3419, -3112,
+  -7963, -2573, -2941, -2801, -153, -3459, -2981, -5578, -4604, -5173, -2574, -3541, -5322, -3787, -4473, -8341,
+  -1798, -6096, -4530, -5857, -353, -5934, -4280, -2564, -2495, -7426, -6659, -2136, -6040, -4127, -195, -2208,
+  -3727, -1876, -2996, -2456, -2629, -6449, -3620, -6782, -6162, -7857, -2652, -3726, -4536, -2786, -3008, -7300,
+  -3572, -4067, -2100, -3828, -2474, -2249, -4070, -3635, -3583, -5397, -2103, -3796, -2503, -2491, -3566, -4037,
+  -4893, -1334, -3619, -2239, -64, -4419, -4121, -4753, -4133, -5828, -1438, -2503, -4307, -1384, -979, -5271,
+  -473, -2892, -2050, -1927, -1006, -2244, -2293, -3147, -1485, -3494, -2450, -2502, -2114, -2353, -1444, -2322,
+  -4050, -2491, -1620, -1606, -254, -2179, -2732, -6550, -1937, -7625, -1170, -2105, -4303, -1640, -2861, -7067,
+  -3885, -6255, -4138, -6250, -3268, -5259, -6001, -3852, -1624, -9148, -5016, -4454, -3869, -5539, -3589, -3811,
+  -4742, -7359, -3524, -836, -3646, -5492, -4880, -8504, -4661, -9579, -148, -1124, -8058, -662, -4598, -6260,
+  -1339, -5511, -2710, -5273, -916, -5349, -5515, -322, -953, -6842, -6074, -1763, -2548, -2812, -1011, -3441,
+  -3142, -1377, -1347, -1626, -1636, -3359, -1614, -3186, -1768, -3698, -631, -1580, -5752, -1352, -2134, -6715,
+  -1094, -1371, -1038, -1802, -1071, -1792, -1186, -4546, -1384, -6308, -3163, -945, -1002, -902, -1758, -1074,
+  -5804, -595, -861, -769, -2216, -3014, -5032, -3014, -3416, -3420, -1850, -3012, -5218, -2176, -2825, -6182,
+  -733, -4540, -4370, -4301, -179, -4378, -4544, -4108, -604, -5871, -5103, -4269, -4484, -2571, -1502, -4511,
+  -5367, -4082, -2571, -2382, -2035, -4893, -2978, -2388, -2263, -6301, -2455, -2575, -4781, -1593, -1841, -5744,
+  -689, -4839, -4668, -2001, -768, -4676, -4842, -426, -625, -6169, -5401, -2174, -4782, -1472, -999, -4809,
+  -5665, -2193, -1595, -2866, -4754, -5192, -2874, -5525, -4905, -6600, -1014, -1859, -5079, -1191, -2768, -6043,
+  -1880, -4613, -1365, -4374, -1730, -4450, -4616, -1568, -960, -5943, -5175, -2646, -4556, -4161, -3034, -932,
+  -5439, -2538, -4165, -1096, -3048, -2204, -4667, -2649, -2031, -6374, -1388, -2169, -4853, -1263, -147, -5817,
+  -2752, -2862, -3261, -3259, -972, -3261, -3011, -3252, -1769, -6157, -2863, -2500, -2322, -3004, -1530, -2111,
+  -5653, -2857, -793, -4209, -4742, -5180, -4881, -3013, -4893, -3269, -161, -1066, -5067, -961, -2419, -6031,
+  -1313, -3388, -3218, -1820, -782, -3226, -3391, -2956, -1232, -4718, -3951, -1819, -3331, -2936, -829, -3359,
+  -4214, -2929, -2940, -2769, -1571, -3741, -3442, -4074, -1826, -5149, -198, -3349, -3628, -979, -1573, -4592,
+  -861, -955, -1059, -1265, -1438, -1272, -1615, -1499, -1151, -3108, -2340, -1459, -1194, -1518, -888, -1337,
+  -3107, -1023, -1087, -579, -1642, -1615, -1022, -5962, -2851, -6583, -2842, -8870, -2700, -2596, -2108, -6018,
+  -973, -1179, -913, -1136, -1180, -1318, -2199, -1485, -986, -5067, -4631, -1392, -1062, -1542, -1015, -1136,
+  -4421, -851, -1045, -691, -1692, -1692, -1097, -5578, -4287, -5579, -2199, -3103, -3925, -2203, -2190, -5579,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -4533, -4760, -1903, -1262, -5265, -1797, -4292, -5602, -4759, -8755, -5866, -1715, -4111, -5602, -5268, -4820,
+  -8251, -4891, -3858, -4303, -5860, -7777, -4649, -8111, -7490, -9186, -61, -937, -3718, -2034, -1589, -8628,
+  -2393, -2564, -2285, -2673, -2398, -2313, -2162, -2870, -2050, -3149, -3067, -2661, -2511, -2870, -2399, -2018,
+  -2290, -2519, -2487, -2216, -3198, -2465, -3105, -2893, -3198, -3661, -208, -860, -1674, -463, -2206, -3256,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -3908, -2096, -1637, -1933, -3823, -2421, -2160, -3760, -1993, -3507, -2180, -1495, -1931, -513, -4012, -1963,
+  -3357, -1403, -1477, -172, -2452, -2235, -2679, -2788, -1789, -3830, -1769, -2577, -3830, -3081, -2958, -7186,
+  -1650, -1766, -1891, -2211, -421, -3075, -3330, -2267, -1347, -1532, -5456, -749, -2822, -2819, -801, -4864,
+  -3335, -1147, -1153, -2001, -1013, -3079, -4948, -2567, -619, -6654, -1841, -2822, -5134, -1921, -2335, -6097,
+  -1036, -2364, -1474, -2418, -666, -2786, -2992, -712, -1002, -2844, -1204, -1230, -5007, -2785, -539, -2843,
+  -2844, -1373, -2481, -701, -1188, -5416, -5118, -3505, -2482, -6825, -1920, -2992, -5304, -1812, -2302, -2911,
+  -1972, -3317, -3316, -1956, -999, -3422, -2144, -2978, -1000, -3062, -3168, -1992, -3111, -3232, -1575, -3571,
+  -3830, -2038, -1690, -2176, -1942, -3062, -5442, -6074, -2027, -7149, -506, -1425, -5628, -1287, -256, -6592,
+  -2285, -3423, -2396, -1046, -2453, -2333, -2985, -3789, -2539, -4394, -3439, -2550, -2666, -2040, -3423, -2961,
+  -2998, -1829, -179, -2380, -4599, -2905, -3140, -2633, -2708, -4518, -623, -2325, -6911, -806, -3683, -4857,
+  -1181, -3492, -3238, -4817, -1171, -1361, -2356, -3481, -910, -6386, -3092, -1117, -2647, -3480, -800, -5026,
+  -3497, -715, -2900, -1367, -1715, -5408, -5110, -5742, -2410, -6817, -324, -1245, -5296, -1828, -2267, -6259,
+  -1377, -4890, -4719, -2669, -737, -3324, -2052, -611, -1106, -6220, -3075, -861, -2076, -1617, -1319, -4860,
+  -2926, -794, -1258, -1620, -1355, -5242, -4944, -3331, -2520, -6651, -586, -1484, -5130, -1217, -2115, -6094,
+  -820, -3254, -5155, -3506, -225, -3253, -3762, -4893, -832, -3173, -3766, -3047, -2594, -3502, -1170, -3509,
+  -3511, -1563, -2499, -1138, -1950, -5678, -5380, -6011, -2163, -3768, -830, -1764, -5566, -1609, -2550, -2405,
+  -2352, -2188, -639, -1908, -2022, -1979, -1769, -4463, -2911, -7368, -2567, -1861, -1993, -225, -1600, -2787,
+  -2582, -1712, -1477, -1426, -660, -2233, -6093, -2375, -6104, -3109, -2124, -2994, -4478, -2751, -3250, -3762,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -2174, -4330, -2764, -4092, -432, -2764, -4334, -2256, -847, -5661, -2772, -1825, -2365, -693, -1885, -2767,
+  -2261, -3872, -1237, -2503, -4246, -4683, -2366, -5017, -2260, -6092, -589, -1460, -4571, -726, -1772, -5534,
+  -1120, -5420, -2944, -1635, -846, -2037, -2838, -4988, -1029, -3606, -3051, -992, -2473, -3010, -1092, -2519,
+  -6247, -256, -1695, -1904, -1429, -2065, -2606, -6106, -1250, -7181, -1039, -1934, -3605, -1823, -2606, -6624,
+  -674, -1478, -2541, -3382, -518, -2123, -2984, -3127, -855, -6280, -3135, -2579, -1684, -1994, -794, -1154,
+  -3391, -2578, -1316, -2620, -1240, -3390, -5004, -3136, -1788, -6711, -671, -1666, -3389, -1171, -1926, -3392,
+  -1534, -5345, -1000, -598, -916, -1934, -799, -3770, -1440, -3275, -2614, -1937, -3019, -1831, -1136, -3274,
+  -2976, -3189, -1036, -921, -1756, -2004, -2646, -3787, -1543, -7106, -576, -1567, -5585, -1221, -2531, -6549,
+  -2988, -2478, -3012, -2546, -3393, -1691, -2855, -3753, -2794, -4455, -2984, -2081, -2094, -20, -2700, -2393,
+  -7245, -1854, -2223, -2082, -1870, -2741, -2262, -4860, -3886, -4455, -1855, -2823, -4603, -3068, -3754, -7622,
+  -624, -4922, -3356, -4683, -565, -4760, -3106, -1390, -1321, -6253, -5485, -962, -4866, -2953, -668, -1034,
+  -2553, -702, -1823, -1282, -1455, -5275, -2447, -5609, -4988, -6683, -1479, -2553, -3362, -1612, -1834, -6126,
+  -3572, -4067, -2100, -3828, -2474, -2249, -4070, -3635, -3583, -5397, -2103, -3796, -2503, -2491, -3566, -4037,
+  -4893, -1334, -3619, -2239, -64, -4419, -4121, -4753, -4133, -5828, -1438, -2503, -4307, -1384, -979, -5271,
+  -815, -2380, -1538, -1415, -494, -1732, -1781, -2635, -973, -2982, -1938, -1990, -1602, -1841, -932, -1810,
+  -3538, -1979, -1108, -1094, -1725, -1667, -2220, -6038, -1425, -7113, -658, -1593, -3791, -1128, -2349, -6555,
+  -1408, -3778, -1661, -3773, -791, -2782, -3524, -1375, -1041, -6671, -2539, -1977, -1392, -3062, -1112, -1334,
+  -2265, -4882, -1047, -852, -1169, -3015, -2403, -6027, -2184, -7102, -401, -1340, -5581, -909, -2121, -3783,
+  -1339, -5511, -2710, -5273, -916, -5349, -5515, -322, -953, -6842, -6074, -1763, -2548, -2812, -1011, -3441,
+  -3142, -1377, -1347, -1626, -1636, -3359, -1614, -3186, -1768, -3698, -631, -1580, -5752, -1352, -2134, -6715,
+  -1499, -1776, -1443, -2207, -1476, -2198, -1591, -4951, -1789, -6714, -3569, -1351, -1408, -1307, -2164, -1480,
+  -6210, -115, -1267, -1175, -2622, -3419, -5438, -3420, -3821, -3826, -2256, -3418, -5624, -2582, -3231, -6587,
+  -733, -4540, -4370, -4301, -179, -4378, -4544, -4108, -604, -5871, -5103, -4269, -4484, -2571, -1502, -4511,
+  -5367, -4082, -2571, -2382, -2035, -4893, -2978, -2388, -2263, -6301, -2455, -2575, -4781, -1593, -1841, -5744,
+  -689, -4839, -4668, -2001, -768, -4676, -4842, -426, -625, -6169, -5401, -2174, -4782, -1472, -999, -4809,
+  -5665, -2193, -1595, -2866, -4754, -5192, -2874, -5525, -4905, -6600, -1014, -1859, -5079, -1191, -2768, -6043,
+  -1475, -4207, -960, -3968, -1325, -4045, -4210, -1162, -554, -5537, -4770, -2240, -4150, -3755, -2629, -526,
+  -5033, -2133, -3759, -690, -2642, -1799, -4261, -2243, -1625, -5968, -983, -1763, -4447, -857, -1625, -5411,
+  -3008, -3118, -3517, -3515, -1228, -3517, -3267, -3508, -2025, -6413, -3119, -2756, -2578, -3260, -1786, -2367,
+  -5909, -3113, -1049, -4465, -4998, -5436, -5137, -3269, -5149, -3525, -417, -1322, -5323, -230, -2675, -6287,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -1748, -2007, -2184, -939, -2439, -685, -2541, -2549, -923, -3973, -3279, -938, -2229, -2561, -1847, -2181,
+  -3279, -2168, -682, -519, -2740, -2656, -931, -3801, -2968, -4422, -2035, -6709, -2452, -3296, -942, -3857,
+  -893, -1151, -1149, -1292, -1367, -1308, -1568, -1645, -1066, -2862, -2427, -1376, -1294, -1582, -1064, -1117,
+  -2216, -1143, -1040, -698, -1770, -1765, -1130, -3373, -2083, -3374, -1588, -899, -1721, -2003, -1184, -3374,
+  -2281, -4653, -4482, -2147, -2821, -4490, -4656, -4221, -2497, -5983, -2689, -2580, -2581, -2683, -2682, -2209,
+  -2839, -2578, -2579, -1257, -4568, -5005, -4707, -5339, -4719, -6414, -673, -1402, -323, -525, -852, -1742,
+  -3109, -3337, -3254, -2120, -3842, -3592, -2869, -4179, -3336, -7331, -4442, -3468, -2688, -4178, -3845, -3397,
+  -6827, -3467, -2435, -2879, -4437, -6354, -3226, -6687, -6067, -7762, -405, -1795, -2295, -1718, -165, -7205,
+  -1913, -2084, -1805, -2193, -1919, -1833, -1682, -2390, -1570, -2669, -2587, -2181, -2031, -2390, -1919, -1538,
+  -1810, -2039, -2007, -1736, -2718, -1985, -2625, -2413, -2718, -3181, -890, -1377, -1194, -124, -1726, -2776,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -6756, -1277, -1412, -1901, -3037, -1507, -1690, -2848, -1515, -6355, -5029, -1008, -2239, -296, -6861, -1271,
+  -3187, -1017, -920, -998, -2318, -2780, -2212, -1895, -2927, -3187, -820, -1610, -2931, -3037, -2675, -10035,
+  -1630, -4949, -2136, -2777, -328, -2927, -6513, -2333, -1665, -4715, -8639, -985, -2777, -2777, -856, -8047,
+  -3183, -1128, -4336, -5184, -919, -6262, -8131, -2671, -504, -9837, -2332, -3183, -8317, -2371, -2777, -9280,
+  -824, -2120, -4480, -2006, -1183, -2344, -2494, -1138, -1033, -2344, -2743, -1470, -8013, -2287, -156, -2600,
+  -5850, -1214, -5487, -3707, -1726, -8422, -8124, -6511, -2412, -9831, -2194, -5998, -8310, -2194, -2494, -5917,
+  -1009, -2837, -2581, -2834, -515, -6003, -2242, -2118, -258, -2581, -2431, -4573, -5692, -5813, -802, -6153,
+  -6411, -1144, -4271, -4758, -1569, -5643, -8023, -8655, -4608, -9730, -2207, -4006, -8209, -2066, -5411, -9173,
+  -812, -2346, -2032, -1138, -2743, -1408, -2239, -5473, -1006, -6078, -5123, -1338, -1019, -780, -2751, -4645,
+  -887, -1576, -1704, -2491, -6283, -977, -4824, -524, -889, -2752, -1969, -2740, -8595, -1833, -2346, -2496,
+  -834, -2991, -6228, -7807, -1158, -2982, -2073, -2991, -565, -9377, -6083, -1272, -2396, -6471, -449, -8017,
+  -6488, -488, -5891, -4358, -1416, -8399, -8101, -8732, -5401, -9807, -1895, -4236, -8287, -2016, -2272, -9250,
+  -1581, -7539, -7369, -2393, -1175, -2649, -4701, -3260, -1268, -8869, -5725, -426, -1987, -4266, -801, -7510,
+  -2649, -298, -3907, -4269, -1929, -7892, -7593, -2649, -2649, -9300, -1920, -4133, -7779, -1581, -2243, -8743,
+  -297, -5896, -7797, -2642, -586, -2642, -2642, -7535, -923, -2047, -2642, -2642, -5235, -2642, -580, -6151,
+  -2642, -4205, -2641, -3780, -1468, -8320, -8021, -8653, -1595, -6409, -2120, -2639, -8207, -1667, -5192, -5047,
+  -4946, -4781, -2590, -4502, -4616, -1049, -4363, -7057, -1987, -9962, -5160, -1743, -1213, -280, -4194, -5381,
+  -5175, -1755, -724, -637, -5180, -2280, -8686, -2998, -8698, -5703, -934, -1789, -7071, -2052, -3255, -6356,
+  -2234, -4793, -4623, -4555, -1042, -4631, -4797, -4361, -4310, -6124, -2830, -4522, -4737, -4342, -378, -4764,
+  -5620, -4335, -4346, -2966, -459, -5146, -4848, -5480, -4860, -6555, -715, -3230, -5034, -715, -2979, -5997,
+  -4088, -6244, -1914, -6005, -706, -1914, -6248, -4170, -770, -7574, -4685, -1507, -4279, -161, -3799, -4681,
+  -1913, -5786, -3150, -4416, -6160, -6597, -4279, -6930, -4173, -8005, -1305, -1907, -6485, -1633, -3686, -7448,
+  -1030, -8040, -2875, -4255, -461, -4657, -5458, -7608, -219, -6226, -5670, -3612, -2875, -5630, -1025, -5138,
+  -8866, -2619, -4314, -4523, -1382, -2873, -5226, -8726, -1988, -9801, -2353, -2872, -2875, -2362, -2281, -9244,
+  -407, -4440, -2193, -2961, -733, -2960, -2556, -2705, -735, -9241, -6097, -5541, -4645, -1803, -511, -2697,
+  -2961, -2193, -2700, -2449, -873, -6351, -7965, -2705, -1377, -9672, -2290, -2957, -6351, -2297, -2449, -6353,
+  -897, -7974, -3629, -1852, -604, -2628, -2353, -6400, -1232, -5905, -5243, -4566, -5648, -4460, -188, -5903,
+  -5605, -5819, -3666, -3551, -1105, -2373, -5275, -6416, -4172, -9736, -2020, -4197, -8215, -1654, -2117, -9178,
+  -5307, -1086, -2425, -2624, -2831, -194, -2830, -2831, -1863, -6774, -5303, -2621, -3077, -800, -5019, -1569,
+  -9564, -772, -4542, -1130, -1245, -1856, -2367, -3343, -2937, -2937, -2675, -5142, -3343, -2748, -3343, -9941,
+  -417, -7932, -6366, -7693, -968, -7769, -3009, -1516, -1522, -9262, -8494, -768, -7875, -3009, -839, -4044,
+  -2348, -467, -2603, -1497, -1277, -8284, -5456, -8618, -7998, -9693, -2158, -5562, -6371, -2158, -2241, -9136,
+  -5485, -5980, -1508, -5742, -1913, -1657, -5984, -5548, -5497, -7311, -4017, -5709, -1913, -1913, -5479, -5951,
+  -6807, -1904, -5533, -4153, -71, -6333, -6035, -6667, -6046, -7742, -995, -4417, -6221, -1145, -1645, -7184,
+  -540, -5402, -4560, -4437, -172, -4754, -3020, -5658, -910, -6005, -3021, -5013, -4624, -3020, -1340, -4833,
+  -6560, -2616, -2611, -4116, -1453, -4689, -5242, -9060, -4448, -10135, -2204, -3018, -6814, -2209, -2766, -9578,
+  -879, -6931, -1647, -6926, -688, -2897, -2897, -973, -827, -9824, -2179, -1800, -1483, -2559, -622, -887,
+  -1687, -8035, -4201, -1032, -645, -6168, -2153, -9180, -2641, -10255, -2170, -3144, -8734, -2338, -2434, -6936,
+  -1822, -9134, -6333, -8895, -1825, -8972, -9137, -78, -1664, -10464, -9697, -5385, -3622, -3366, -769, -3622,
+  -3028, -1506, -4969, -5248, -2043, -3110, -1526, -2961, -5390, -7320, -2765, -5203, -9374, -2576, -2811, -10338,
+  -3545, -3822, -3489, -4253, -3522, -4244, -3637, -6997, -3835, -8759, -5615, -3397, -3453, -410, -4209, -244,
+  -8255, -1842, -743, -1848, -4668, -5465, -7483, -2046, -5867, -5871, -4301, -5464, -7669, -4627, -2195, -8633,
+  -616, -7075, -6905, -6836, -406, -6913, -7078, -6643, -323, -8405, -7638, -6804, -7018, -5105, -1346, -7046,
+  -7901, -6616, -2129, -2278, -1617, -7428, -5513, -2022, -4798, -8836, -2534, -2534, -7315, -1684, -4376, -8279,
+  -659, -7948, -7778, -5110, -856, -7786, -7952, -296, -524, -9279, -8511, -5284, -7892, -4582, -1196, -7919,
+  -8775, -2086, -4705, -5975, -7864, -8301, -5983, -8635, -8014, -9710, -4124, -4969, -8189, -4301, -5878, -9152,
+  -2872, -5604, -2357, -5366, -2722, -5442, -5608, -2560, -722, -6935, -6167, -1141, -5548, -5153, -4026, -1923,
+  -6431, -3530, -5157, -2088, -4040, -679, -5659, -1397, -450, -7366, -983, -3161, -5845, -582, -1139, -6808,
+  -2223, -2223, -2223, -2223, -111, -2223, -2223, -2223, -1454, -8380, -1967, -4723, -4544, -5227, -670, -4334,
+  -7876, -5080, -3016, -6431, -6965, -7403, -7104, -1967, -7116, -5492, -1258, -3289, -7290, -1500, -4642, -8254,
+  -1869, -3943, -3773, -2376, -1337, -3781, -3947, -3511, -1787, -5274, -4506, -2375, -3887, -3491, -1384, -3914,
+  -4770, -3485, -3496, -3325, -2126, -4296, -3998, -4630, -806, -5705, -84, -3905, -4184, -1534, -2129, -5147,
+  -2736, -2385, -4393, -2747, -4647, -2559, -3151, -2897, -2887, -6182, -5487, -4524, -2746, -4770, -2341, -2893,
+  -5487, -2893, -3137, -2379, -4948, -4865, -2891, -6010, -3154, -6631, -66, -8918, -1071, -5504, -858, -6065,
+  -893, -1151, -1149, -1292, -1367, -1308, -1568, -1645, -1066, -2862, -2427, -1376, -1294, -1582, -1064, -1117,
+  -2216, -1143, -1040, -698, -1770, -1765, -1130, -3373, -2083, -3374, -1588, -899, -1721, -2003, -1184, -3374,
+  -2145, -7392, -7221, -1927, -2483, -7229, -7395, -6960, -2145, -8722, -2333, -2333, -2227, -2333, -2333, -2738,
+  -5578, -2227, -5318, -1459, -7307, -7745, -7446, -8078, -7458, -9153, -1139, -2225, -218, -500, -914, -1651,
+  -755, -1178, -1641, -3132, -1897, -1302, -1895, -5190, -1178, -8342, -5453, -1491, -1384, -1897, -1302, -1385,
+  -7839, -1385, -896, -404, -1897, -7365, -922, -7698, -7078, -8773, -1327, -1867, -1488, -1860, -1176, -8216,
+  -1209, -1472, -1108, -1555, -1686, -1108, -1052, -1714, -1076, -1999, -1942, -1555, -1328, -1811, -1849, -925,
+  -1338, -1328, -1328, -1247, -1999, -1239, -2255, -1850, -1942, -2405, -448, -1043, -1806, -1844, -2065, -2067,
+  -4538, -5033, -4862, -4794, -4323, -4870, -5036, -4601, -3209, -6363, -5595, -4762, -4976, -2112, -3454, -5003,
+  -3219, -2754, -3457, -2473, -4948, -5385, -5087, -5719, -5099, -6794, -2229, -3469, -2880, -2301, -2557, -4,
+  -5795, -1138, -1238, -1669, -5711, -1357, -1340, -5648, -1394, -5395, -4068, -957, -2073, -294, -5900, -1084,
+  -5245, -1044, -1044, -1029, -2225, -4122, -2076, -1507, -3677, -5718, -1148, -4464, -2482, -4969, -2481, -9074,
+  -1561, -3990, -2222, -4434, -339, -5299, -5554, -4491, -1305, -3756, -7680, -920, -5046, -5043, -736, -7088,
+  -5559, -967, -3376, -4225, -801, -5302, -7171, -4791, -704, -8878, -4065, -5046, -7357, -4145, -4559, -8321,
+  -913, -2226, -3700, -4644, -1304, -5012, -5219, -1082, -946, -5070, -3430, -1711, -7233, -5011, -137, -5070,
+  -5070, -1251, -4707, -2927, -1506, -7643, -7344, -5731, -4708, -9051, -4147, -5219, -7530, -2224, -4529, -5138,
+  -1233, -5145, -5144, -3784, -442, -5249, -3972, -4806, -218, -4890, -4996, -3820, -4938, -5060, -942, -5399,
+  -5657, -1571, -3517, -4004, -1571, -4890, -7270, -7902, -3855, -8977, -2333, -3252, -7456, -3115, -4658, -8420,
+  -961, -1496, -1998, -1741, -3394, -1288, -1751, -4730, -1061, -5335, -4380, -1196, -867, -960, -4364, -3902,
+  -921, -1405, -1285, -3321, -5540, -1034, -4081, -390, -1158, -5459, -2415, -3266, -7852, -3310, -4624, -5798,
+  -864, -5560, -5305, -6884, -1066, -3428, -4424, -5548, -594, -8453, -5159, -1346, -1812, -5547, -381, -7094,
+  -5565, -555, -4967, -3435, -1348, -7476, -7177, -7809, -4478, -8884, -2391, -3312, -7364, -2065, -2067, -8327,
+  -1295, -6698, -6528, -4478, -1529, -5133, -3861, -2420, -1211, -8029, -4884, -446, -3885, -3426, -1040, -6669,
+  -4735, -239, -3066, -3429, -1548, -7051, -6753, -5140, -4329, -8460, -1740, -3293, -6939, -1795, -3924, -7903,
+  -398, -4987, -6887, -5239, -495, -4986, -5495, -6626, -960, -4906, -5499, -4780, -4326, -5235, -574, -5241,
+  -5244, -3296, -4231, -1716, -1220, -7411, -7112, -7744, -1071, -5500, -1696, -3497, -7298, -3342, -4283, -4138,
+  -4000, -3835, -2286, -3555, -3669, -1065, -3416, -6111, -2053, -9016, -4214, -1422, -928, -213, -3248, -4434,
+  -4229, -1587, -1005, -724, -4233, -3880, -7740, -4022, -7751, -4756, -1105, -4641, -6125, -2308, -2309, -5409,
+  -1598, -4157, -3987, -3918, -744, -3995, -4161, -3725, -3674, -5487, -2193, -3886, -4101, -3705, -568, -4128,
+  -4984, -3699, -3710, -2329, -179, -4510, -4212, -4843, -4223, -5918, -1824, -2594, -4398, -1787, -2342, -5361,
+  -3149, -5305, -3739, -5066, -1406, -3739, -5308, -3231, -557, -6635, -974, -2799, -3340, -200, -2860, -3742,
+  -974, -4847, -2211, -3477, -5221, -5658, -3340, -5991, -3234, -7066, -1563, -2434, -5546, -1701, -2747, -6509,
+  -952, -7164, -4688, -3380, -435, -3782, -4583, -6732, -229, -5351, -4795, -2736, -4218, -4755, -1111, -4263,
+  -7991, -4793, -3439, -3648, -1336, -3809, -4351, -7851, -2994, -8926, -2783, -3679, -5349, -3568, -4351, -8368,
+  -462, -3559, -4622, -5463, -580, -4204, -5065, -5208, -709, -8361, -5216, -4660, -3765, -2079, -539, -3235,
+  -5472, -2081, -2071, -2081, -863, -5471, -7085, -5217, -1568, -8792, -2753, -3747, -5470, -3252, -4007, -5473,
+  -944, -7140, -2794, -2393, -636, -3729, -1755, -5565, -1199, -5070, -4409, -3732, -4814, -3625, -200, -5069,
+  -4771, -4984, -2831, -2716, -909, -3799, -4440, -5581, -3338, -8901, -2371, -3362, -7380, -3016, -1389, -8344,
+  -4275, -775, -2309, -2305, -4681, -291, -4142, -5040, -1716, -5742, -4271, -2291, -2291, -817, -3987, -1264,
+  -8532, -726, -3510, -1008, -1106, -1798, -3549, -6147, -5173, -5742, -3142, -4110, -5890, -4356, -5041, -8909,
+  -465, -7180, -5614, -6941, -804, -7018, -5364, -1372, -1594, -8511, -7743, -886, -7124, -5211, -933, -3292,
+  -2258, -397, -4081, -1996, -1190, -7533, -4705, -7866, -7246, -8941, -2251, -4810, -5620, -3870, -2001, -8384,
+  -4745, -5240, -3274, -5002, -3647, -3423, -5244, -4808, -4757, -6571, -3277, -4969, -3676, -3665, -4739, -5211,
+  -6067, -2508, -4793, -3413, -18, -5593, -5295, -5927, -5306, -7002, -1166, -3677, -5481, -2558, -2153, -6444,
+  -622, -4612, -3769, -3646, -124, -3963, -4012, -4867, -1013, -5214, -4170, -4222, -3834, -4072, -1378, -4042,
+  -5769, -2230, -3340, -3326, -1974, -3899, -4451, -8269, -3657, -9344, -2174, -3825, -6023, -3360, -4581, -8787,
+  -945, -6112, -1416, -6107, -668, -5117, -5859, -928, -822, -9005, -2334, -2078, -1565, -5396, -711, -711,
+  -2078, -7217, -3382, -1090, -652, -5349, -2078, -8361, -2078, -9436, -2736, -3675, -7916, -3243, -2333, -6117,
+  -1790, -8188, -5387, -7950, -1445, -8026, -8192, -85, -1629, -9519, -8751, -4440, -5225, -5488, -890, -6117,
+  -5819, -1097, -4023, -4302, -1791, -6036, -1535, -5863, -4445, -6375, -2615, -4257, -8429, -4029, -2676, -9392,
+  -2703, -2980, -2647, -3411, -2680, -3401, -2795, -6155, -2993, -7917, -4773, -2554, -2611, -328, -3367, -285,
+  -7413, -1542, -837, -2378, -3826, -4623, -6641, -4623, -5025, -5029, -3459, -4621, -6827, -3785, -4434, -7791,
+  -543, -6154, -5984, -5915, -599, -5992, -6157, -5722, -278, -7484, -6717, -5883, -6098, -4185, -951, -6125,
+  -6980, -5696, -4185, -3996, -1612, -6507, -4592, -1613, -3877, -7915, -4069, -4189, -6394, -3207, -3455, -7358,
+  -680, -7083, -6913, -4245, -963, -6921, -7087, -254, -582, -8414, -7646, -4419, -7027, -3717, -1102, -7054,
+  -7910, -1839, -3840, -5110, -6999, -7436, -5118, -7770, -7149, -8844, -3259, -4104, -7324, -3436, -5013, -8287,
+  -1731, -4463, -1216, -4224, -1581, -4301, -4466, -1418, -810, -5793, -5026, -2496, -4406, -4011, -2885, -782,
+  -5289, -2389, -4015, -946, -2898, -2055, -4517, -2499, -1881, -6224, -1239, -2019, -4703, -221, -1881, -5667,
+  -4055, -4164, -4563, -4562, -113, -4563, -4313, -4555, -1299, -7460, -4166, -3802, -3624, -4307, -583, -3414,
+  -6956, -4160, -2095, -5511, -6045, -6482, -6184, -4315, -6195, -4572, -1464, -2368, -6370, -2264, -3721, -7333,
+  -1313, -3388, -3218, -1820, -782, -3226, -3391, -2956, -1232, -4718, -3951, -1819, -3331, -2936, -829, -3359,
+  -4214, -2929, -2940, -2769, -1571, -3741, -3442, -4074, -1826, -5149, -907, -3349, -3628, -207, -1573, -4592,
+  -2589, -2849, -3026, -1781, -3281, -1777, -3383, -3391, -2777, -4815, -4120, -3157, -3071, -3403, -2689, -3023,
+  -4120, -3010, -2879, -2410, -3581, -3498, -2923, -4643, -3810, -5264, -9, -7551, -3293, -4138, -3371, -4699,
+  -1016, -1334, -3625, -1663, -2467, -1351, -2471, -2069, -1016, -2476, -4903, -1501, -2067, -1259, -1451, -1351,
+  -4692, -3620, -1258, -818, -4246, -4241, -1232, -5850, -2219, -5850, -1963, -723, -2218, -1881, -371, -5850,
+  -3939, -6310, -6140, -3805, -4479, -6148, -6314, -5878, -4154, -7641, -4347, -1657, -4239, -4341, -4340, -1657,
+  -4497, -4236, -4236, -1396, -6226, -6663, -6365, -6997, -6376, -8072, -1373, -3059, -240, -585, -631, -1400,
+  -974, -3831, -3749, -2615, -4336, -4087, -3364, -4674, -3831, -7826, -4937, -3963, -3182, -4673, -4340, -3891,
+  -7322, -1380, -1122, -612, -4931, -6849, -1380, -7182, -6562, -8257, -1527, -2290, -1372, -221, -1118, -7700,
+  -1422, -1305, -1422, -1529, -828, -1595, -1422, -1785, -568, -2190, -2190, -1423, -1596, -1785, -732, -819,
+  -899, -1528, -1340, -888, -2190, -1932, -1679, -2189, -4503, -4967, -2675, -3162, -2979, -2911, -1782, -2190,
+  -3450, -3945, -3775, -3706, -3235, -3783, -3949, -3513, -2122, -5275, -4508, -3674, -3889, -1025, -2367, -3916,
+  -2131, -1666, -2370, -1385, -3861, -4298, -4000, -4631, -4011, -5706, -1142, -2382, -1793, -1213, -1470, -91,
+  -4164, -2352, -1893, -2189, -4079, -2677, -2416, -4016, -2249, -3763, -2436, -1751, -2187, -1369, -4268, -2219,
+  -3613, -1659, -1733, -1588, -2708, -2491, -2935, -3044, -2045, -4086, -253, -2833, -4086, -338, -3214, -7442,
+  -1650, -1766, -1891, -2211, -421, -3075, -3330, -2267, -1347, -1532, -5456, -749, -2822, -2819, -801, -4864,
+  -3335, -1147, -1153, -2001, -1013, -3079, -4948, -2567, -619, -6654, -1841, -2822, -5134, -1921, -2335, -6097,
+  -1036, -2364, -1474, -2418, -666, -2786, -2992, -712, -1002, -2844, -1204, -1230, -5007, -2785, -539, -2843,
+  -2844, -1373, -2481, -701, -1188, -5416, -5118, -3505, -2482, -6825, -1920, -2992, -5304, -1812, -2302, -2911,
+  -2691, -4036, -4035, -2674, -1717, -4140, -2863, -3697, -1718, -3781, -3887, -2711, -3829, -3951, -2293, -4290,
+  -4548, -2757, -2408, -2895, -2661, -3781, -6161, -6793, -2746, -7868, -230, -959, -6347, -376, -3549, -7310,
+  -1623, -2761, -1734, -1438, -1791, -1671, -2323, -3127, -1877, -3732, -2777, -1888, -2004, -1378, -2761, -2299,
+  -2336, -1167, -1316, -1719, -3937, -2243, -2478, -1971, -2047, -3857, -300, -1663, -6249, -395, -3021, -4195,
+  -1181, -3492, -3238, -4817, -1171, -1361, -2356, -3481, -910, -6386, -3092, -1117, -2647, -3480, -800, -5026,
+  -3497, -715, -2900, -1367, -1715, -5408, -5110, -5742, -2410, -6817, -324, -1245, -5296, -1828, -2267, -6259,
+  -1377, -4890, -4719, -2669, -737, -3324, -2052, -611, -1106, -6220, -3075, -861, -2076, -1617, -1319, -4860,
+  -2926, -794, -1258, -1620, -1355, -5242, -4944, -3331, -2520, -6651, -586, -1484, -5130, -1217, -2115, -6094,
+  -820, -3254, -5155, -3506, -225, -3253, -3762, -4893, -832, -3173, -3766, -3047, -2594, -3502, -1170, -3509,
+  -3511, -1563, -2499, -1138, -1950, -5678, -5380, -6011, -2163, -3768, -830, -1764, -5566, -1609, -2550, -2405,
+  -2352, -2188, -1683, -1908, -2022, -1979, -1769, -4463, -2911, -7368, -2567, -648, -1993, -1158, -1600, -2787,
+  -2582, -1712, -1477, -1426, -2586, -2233, -6093, -2375, -6104, -3109, -2124, -2994, -4478, -149, -3250, -3762,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -2686, -4842, -3276, -4604, -944, -3276, -4846, -2768, -1359, -6173, -3284, -2337, -2877, -1205, -2397, -3279,
+  -2773, -4384, -1749, -3015, -4758, -5195, -2878, -5529, -2772, -6604, -1101, -1972, -5083, -89, -2284, -6046,
+  -1458, -5758, -3283, -1974, -1185, -2376, -3177, -5326, -1368, -3945, -3389, -1330, -594, -3349, -1430, -2857,
+  -6585, -3387, -2033, -2242, -1767, -2403, -2945, -6445, -1588, -7520, -1377, -2273, -3944, -187, -2945, -6962,
+  -1268, -2073, -3135, -3976, -1112, -2718, -3579, -3722, -1449, -6874, -3730, -3174, -2278, -2588, -554, -1749,
+  -3986, -3173, -1910, -3215, -1835, -3984, -5598, -3730, -2382, -7305, -1266, -2260, -3984, -184, -2520, -3986,
+  -2046, -5857, -1512, -1110, -1428, -2446, -1311, -4282, -1952, -3787, -3126, -2449, -3531, -2343, -1648, -3786,
+  -3488, -3701, -1548, -1433, -2268, -2516, -3158, -4299, -2055, -7618, -1088, -2079, -6097, -102, -3043, -7061,
+  -2476, -1966, -2500, -2034, -2881, -1179, -2343, -3241, -2282, -3943, -2472, -1569, -1582, -1202, -2188, -503,
+  -6733, -1342, -1711, -1570, -1358, -2229, -1750, -4348, -3374, -3943, -1343, -2311, -4091, -255, -3242, -7110,
+  -1542, -5840, -4274, -5601, -1483, -5678, -4024, -2308, -2239, -7170, -6403, -1880, -5784, -3871, -1586, -1952,
+  -3471, -866, -2740, -2200, -2373, -6193, -3364, -6526, -5906, -7601, -149, -917, -4280, -2530, -915, -7044,
+  -3977, -4472, -2506, -4234, -2879, -2655, -4476, -4040, -3989, -5803, -2509, -4201, -2908, -2897, -3971, -4443,
+  -5299, -1740, -4025, -2645, -469, -4825, -4527, -5159, -4538, -6234, -1844, -2909, -4713, -145, -1385, -5676,
+  -1409, -2974, -2132, -2009, -1088, -2326, -2375, -3230, -1568, -3577, -2533, -2585, -2196, -2435, -1526, -2405,
+  -4132, -2574, -1702, -1688, -2319, -2261, -2814, -6632, -2020, -7707, -67, -2188, -4386, -1722, -2943, -7150,
+  -2003, -4372, -2255, -4367, -1386, -3377, -4119, -1970, -1636, -7265, -3134, -2571, -1986, -3656, -1706, -1928,
+  -2859, -5477, -1642, -73, -1763, -3609, -2997, -6621, -2778, -7696, -996, -1934, -6176, -1503, -2716, -4377,
+  -3180, -7352, -4551, -7113, -2756, -7190, -7356, -28, -2794, -8682, -7915, -3604, -4389, -4652, -2851, -5281,
+  -4983, -3218, -3187, -3466, -3476, -5200, -3454, -5026, -3609, -5539, -1779, -3421, -7593, -3193, -1029, -8556,
+  -1094, -1371, -1038, -1802, -1071, -1792, -1186, -4546, -1384, -6308, -3163, -945, -1002, -902, -1758, -1074,
+  -5804, -595, -861, -769, -2216, -3014, -5032, -3014, -3416, -3420, -1850, -3012, -5218, -2176, -2825, -6182,
+  -733, -4540, -4370, -4301, -179, -4378, -4544, -4108, -604, -5871, -5103, -4269, -4484, -2571, -1502, -4511,
+  -5367, -4082, -2571, -2382, -2035, -4893, -2978, -2388, -2263, -6301, -2455, -2575, -4781, -1593, -1841, -5744,
+  -689, -4839, -4668, -2001, -768, -4676, -4842, -426, -625, -6169, -5401, -2174, -4782, -1472, -999, -4809,
+  -5665, -2193, -1595, -2866, -4754, -5192, -2874, -5525, -4905, -6600, -1014, -1859, -5079, -1191, -2768, -6043,
+  -1475, -4207, -960, -3968, -1325, -4045, -4210, -1162, -554, -5537, -4770, -2240, -4150, -3755, -2629, -526,
+  -5033, -2133, -3759, -690, -2642, -1799, -4261, -2243, -1625, -5968, -983, -1763, -4447, -857, -1625, -5411,
+  -2752, -2862, -3261, -3259, -972, -3261, -3011, -3252, -1769, -6157, -2863, -2500, -2322, -3004, -1530, -2111,
+  -5653, -2857, -793, -4209, -4742, -5180, -4881, -3013, -4893, -3269, -161, -1066, -5067, -961, -2419, -6031,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -1296, -2402, -3659, -875, -2163, -1297, -1760, -4024, -1016, -2422, -4754, -2413, -1109, -2417, -916, -1397,
+  -4754, -2159, -2010, -618, -4214, -2164, -2158, -2422, -2421, -5897, -363, -8184, -3926, -2421, -1398, -1828,
+  -974, -1681, -1433, -977, -3064, -1436, -1290, -3342, -927, -4559, -4124, -1688, -1034, -1692, -1032, -1680,
+  -3913, -1681, -1284, -922, -3467, -3462, -2828, -5071, -1696, -5071, -523, -2596, -3418, -722, -1434, -5071,
+  -2772, -7425, -7255, -2260, -5594, -7263, -7429, -6993, -5269, -8756, -5462, -5353, -5354, -5456, -5455, -4982,
+  -2517, -5351, -2261, -1054, -7341, -7778, -7480, -8111, -7491, -9186, -505, -1183, -394, -488, -1419, -1772,
+  -2569, -5021, -4939, -3805, -5526, -5277, -4554, -5863, -5021, -9016, -6127, -5153, -4372, -5863, -5529, -5081,
+  -8512, -2058, -4120, -4564, -6121, -8038, -4911, -8372, -7752, -9447, -248, -1052, -441, -1501, -831, -8890,
+  -3751, -3922, -3643, -4032, -3757, -3671, -3520, -4228, -3408, -4508, -4425, -4019, -3869, -4228, -3757, -1728,
+  -3648, -3878, -3845, -1729, -4556, -3823, -4464, -4251, -4556, -5020, -2728, -1829, -10, -2964, -3564, -4614,
+  -4557, -5051, -4881, -4813, -4342, -4889, -5055, -4619, -3228, -6382, -5614, -4780, -4995, -2131, -3473, -5022,
+  -3238, -2773, -3476, -2492, -4967, -5404, -5106, -5738, -5118, -6813, -2248, -3488, -2899, -2320, -2576, -4,
+  -4657, -2846, -826, -2682, -4572, -1341, -1338, -4509, -2742, -4256, -2929, -2244, -2680, -1262, -4761, -2712,
+  -4106, -675, -217, -1296, -3201, -2984, -3428, -3537, -1329, -4580, -2518, -3326, -4579, -1343, -3708, -7935,
+  -2774, -2891, -3015, -3335, -1546, -4200, -4455, -3392, -2471, -2657, -6580, -1874, -3946, -3943, -270, -5988,
+  -4459, -2271, -2277, -3126, -711, -4203, -6072, -3692, -396, -7779, -2966, -3947, -6258, -3046, -3460, -7222,
+  -790, -3567, -2677, -3621, -1869, -3989, -4196, -1915, -2206, -4047, -2407, -2434, -6210, -3988, -197, -4046,
+  -4047, -795, -3684, -1904, -688, -6620, -6321, -4708, -3685, -8028, -3124, -4196, -6507, -3016, -3506, -4115,
+  -4040, -5385, -5384, -4023, -3066, -5489, -4212, -5046, -1402, -5130, -5236, -4060, -5178, -5300, -3642, -5639,
+  -5897, -4106, -3757, -4244, -4010, -5130, -7510, -8142, -4095, -9217, -108, -1134, -7696, -626, -4898, -8659,
+  -1879, -3017, -1990, -640, -2047, -1927, -2579, -3383, -2133, -3988, -3033, -2144, -657, -636, -3017, -2555,
+  -2592, -1423, -1572, -1975, -4193, -659, -2734, -656, -2303, -4113, -1068, -1919, -6505, -1963, -3277, -4451,
+  -2067, -4378, -4123, -5702, -2056, -2246, -3242, -4366, -614, -7271, -3977, -2002, -3532, -4365, -161, -5912,
+  -4383, -1601, -3785, -2253, -882, -6294, -5995, -6627, -3296, -7702, -1209, -2130, -6181, -2713, -3153, -7145,
+  -2957, -6469, -6299, -4248, -1299, -4903, -3631, -2190, -2685, -7799, -4655, -26, -3655, -3196, -1569, -6440,
+  -4506, -1539, -2837, -3200, -2935, -6822, -6524, -4911, -4100, -8230, -2165, -3063, -6710, -2796, -3694, -7673,
+  -1226, -3660, -5561, -3912, -631, -3659, -4168, -5299, -1238, -3579, -4172, -3453, -2999, -3908, -142, -3914,
+  -3917, -1969, -2904, -1544, -2356, -6084, -5785, -6417, -2569, -4173, -1236, -2170, -5971, -2015, -2956, -2811,
+  -2815, -2650, -2146, -2371, -2485, -863, -2232, -4926, -612, -7831, -3029, -2324, -2456, -170, -2063, -3250,
+  -1122, -2175, -1940, -1889, -3049, -2695, -6555, -2838, -6567, -3572, -2587, -3456, -4940, -3214, -3712, -4225,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -2430, -4586, -3020, -4348, -688, -3020, -4590, -2512, -220, -5917, -3028, -2081, -2621, -949, -2141, -3023,
+  -2517, -4128, -1493, -2759, -4502, -4939, -2622, -5273, -2516, -6348, -845, -1716, -4827, -982, -2028, -5790,
+  -1864, -6164, -3688, -2379, -1590, -2782, -3582, -5732, -22, -4351, -3795, -1736, -3217, -3754, -1836, -3263,
+  -6991, -3793, -2439, -2648, -2173, -2809, -3350, -6851, -1994, -7925, -1783, -2679, -4349, -2567, -3350, -7368,
+  -109, -3237, -4299, -5140, -512, -3882, -4743, -4886, -2614, -8039, -4894, -4338, -3443, -3753, -2552, -2913,
+  -5150, -4337, -3075, -4379, -2999, -5149, -6763, -4894, -3546, -8469, -2430, -3425, -5148, -2930, -3684, -5151,
+  -400, -5751, -1405, -1004, -376, -2340, -1204, -4176, -1846, -3681, -3019, -2343, -3424, -2236, -1542, -3680,
+  -3382, -3595, -1442, -1327, -2161, -2410, -3051, -4192, -1949, -7512, -981, -1973, -5991, -1627, -2937, -6955,
+  -2626, -2116, -2650, -2184, -3031, -1328, -2493, -3391, -2432, -4092, -2622, -1719, -1731, -609, -2338, -2031,
+  -6882, -140, -1861, -1720, -1508, -2378, -1900, -4497, -3523, -4093, -1493, -2461, -4241, -2706, -3392, -7260,
+  -1691, -5990, -4424, -5751, -636, -5827, -1067, -2457, -2388, -7320, -6552, -2029, -5933, -4020, -340, -2102,
+  -3621, -1770, -2890, -2350, -659, -6343, -3514, -6676, -6056, -7751, -2546, -3620, -4429, -660, -2902, -7194,
+  -3572, -4067, -2100, -3828, -2474, -2249, -4070, -3635, -3583, -5397, -2103, -3796, -2503, -2491, -3566, -4037,
+  -4893, -1334, -3619, -2239, -64, -4419, -4121, -4753, -4133, -5828, -1438, -2503, -4307, -1384, -979, -5271,
+  -1815, -3380, -2538, -2415, -387, -2732, -2781, -3635, -975, -3983, -2939, -2991, -2602, -2841, -585, -2811,
+  -1000, -488, -2108, -2094, -2725, -2667, -3220, -7038, -2425, -8113, -1658, -2593, -4791, -2128, -3349, -7556,
+  -2002, -5788, -3671, -5783, -2801, -4792, -5534, -836, -676, -8681, -4549, -3987, -3402, -5072, -1598, -3344,
+  -2009, -6892, -3057, -1489, -942, -5025, -4413, -8037, -4194, -9112, -209, -1197, -7591, -1980, -2009, -5793,
+  -2908, -7081, -4279, -6842, -1539, -6918, -7084, -346, -255, -8411, -7643, -3332, -4117, -4381, -970, -5010,
+  -4712, -2946, -2916, -3195, -3205, -4928, -1564, -4755, -3337, -5267, -2200, -3150, -7321, -2921, -3703, -8285,
+  -1350, -1627, -1294, -2058, -1327, -2048, -1442, -4802, -1640, -6564, -3419, -1201, -1258, -1158, -2014, -1330,
+  -6060, -851, -222, -1025, -2472, -3270, -5288, -3270, -3672, -3676, -2106, -3268, -5474, -2432, -3081, -6438,
+  -733, -4540, -4370, -4301, -179, -4378, -4544, -4108, -604, -5871, -5103, -4269, -4484, -2571, -1502, -4511,
+  -5367, -4082, -2571, -2382, -2035, -4893, -2978, -2388, -2263, -6301, -2455, -2575, -4781, -1593, -1841, -5744,
+  -413, -6069, -5899, -3231, -1999, -5907, -6073, -248, -1168, -7400, -6632, -3405, -6013, -2703, -817, -6040,
+  -6896, -3423, -2826, -4096, -5985, -6422, -4104, -6756, -6135, -7831, -2245, -3090, -6310, -2422, -3999, -7273,
+  -1475, -4207, -960, -3968, -1325, -4045, -4210, -1162, -554, -5537, -4770, -2240, -4150, -3755, -2629, -526,
+  -5033, -2133, -3759, -690, -2642, -1799, -4261, -2243, -1625, -5968, -983, -1763, -4447, -857, -1625, -5411,
+  -2752, -2862, -3261, -3259, -972, -3261, -3011, -3252, -1769, -6157, -2863, -2500, -2322, -3004, -1530, -2111,
+  -5653, -2857, -793, -4209, -4742, -5180, -4881, -3013, -4893, -3269, -161, -1066, -5067, -961, -2419, -6031,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -434, -959, -1693, -1623, -1771, -1165, -1762, -1807, -934, -3006, -3006, -1666, -1579, -1682, -1170, -1696,
+  -3006, -1775, -1218, -707, -1864, -1906, -975, -2464, -1730, -6887, -1938, -9174, -1222, -1998, -1355, -2644,
+  -697, -1155, -1623, -1836, -1648, -1506, -1762, -2053, -1285, -5511, -2648, -2134, -1700, -1836, -1474, -1647,
+  -4865, -1984, -1368, -828, -1880, -2053, -1079, -6022, -1837, -6023, -1880, -334, -1431, -1798, -1490, -6023,
+  -2149, -6802, -6632, -4296, -4970, -6640, -6806, -6370, -4646, -8132, -4838, -4730, -4731, -4833, -4832, -4358,
+  -4988, -4728, -4728, -3406, -6718, -7155, -6857, -7488, -6868, -8563, -1724, -3551, -490, -1616, -127, -3892,
+  -4949, -5177, -5094, -3961, -5682, -5432, -4709, -6019, -5176, -9171, -2726, -5308, -4528, -6018, -5685, -5237,
+  -8668, -2725, -4275, -4719, -6277, -8194, -5066, -8527, -7907, -9602, -1299, -1494, -2718, -38, -1112, -9045,
+  -2305, -2307, -2051, -2054, -2052, -3738, -2300, -2309, -3475, -2310, -2310, -2308, -2053, -4295, -3824, -1795,
+  -3715, -2307, -3913, -3642, -4623, -2306, -4531, -4319, -4624, -5087, -230, -481, -2034, -726, -1902, -4681,
+  -3194, -3689, -3519, -3450, -2979, -3527, -3693, -3257, -1866, -5019, -4252, -3418, -3633, -769, -2111, -3660,
+  -1875, -1410, -2114, -1129, -3605, -4042, -3744, -4375, -3755, -5450, -886, -2126, -1537, -957, -1214, -212,
+  -4843, -811, -2572, -1520, -1274, -1018, -762, -4696, -2929, -4443, -3116, -1258, -2866, -671, -4948, -2898,
+  -506, -1491, -1498, -2268, -3388, -1526, -3615, -1529, -2725, -4766, -2704, -3513, -4766, -4017, -762, -8122,
+  -1104, -3129, -1360, -3573, -1052, -4438, -4693, -594, -2709, -2895, -6818, -546, -4184, -4181, -840, -6226,
+  -4697, -1346, -2515, -3364, -2376, -4441, -6310, -1362, -754, -8017, -1360, -4184, -6496, -3284, -768, -7460,
+  -915, -1636, -3110, -4054, -2303, -4422, -4629, -2348, -865, -4480, -2840, -2867, -6643, -4421, -1025, -4480,
+  -4480, -1628, -4117, -2337, -2824, -7053, -6754, -5141, -4118, -8461, -1230, -4629, -6940, -207, -825, -1636,
+  -2972, -4317, -4316, -2956, -207, -4422, -1254, -3978, -1210, -4062, -850, -2992, -4111, -4232, -2575, -4572,
+  -4830, -3038, -2690, -3177, -1252, -4062, -6442, -7074, -3027, -8149, -1104, -2425, -6628, -2287, -662, -7592,
+  -2742, -3880, -2853, -2557, -2910, -1115, -3441, -4246, -1265, -4851, -3895, -1116, -3123, -925, -3880, -3418,
+  -3454, -1480, -2434, -2837, -5056, -1522, -3596, -211, -3165, -4975, -1211, -2782, -7368, -2826, -713, -5313,
+  -796, -5102, -4847, -6426, -1345, -2970, -3965, -5090, -179, -7995, -1609, -2726, -1203, -5089, -1332, -6635,
+  -5106, -2324, -4509, -2976, -3324, -7017, -6719, -7351, -4019, -8426, -1933, -2854, -6905, -1606, -723, -7868,
+  -1750, -6648, -6478, -4427, -2496, -5083, -3811, -2370, -2864, -7979, -4834, -1341, -1097, -3375, -3078, -6619,
+  -4685, -65, -3016, -3379, -3114, -7001, -6703, -5090, -4279, -8410, -2345, -3243, -6889, -1745, -1040, -7852,
+  -792, -4322, -6222, -4574, -1293, -4321, -4830, -5961, -793, -4241, -4834, -4115, -3661, -4570, -470, -4576,
+  -4579, -2631, -3566, -2205, -473, -6746, -6447, -7079, -3231, -4835, -1897, -2831, -6633, -2677, -662, -3473,
+  -3560, -1864, -2891, -3116, -3230, -1273, -1605, -5671, -4119, -8576, -3775, -334, -3201, -289, -2809, -1869,
+  -1868, -2920, -1594, -2634, -3794, -3441, -7301, -3583, -7312, -4317, -1863, -4202, -5686, -1613, -1208, -4970,
+  -788, -4374, -4204, -4136, -961, -4212, -4378, -3942, -3891, -5705, -2411, -4103, -4318, -3922, -1769, -4345,
+  -5201, -3916, -3927, -2546, -211, -4727, -4429, -5061, -4440, -6135, -2041, -2811, -4615, -2004, -554, -5578,
+  -3060, -5216, -3650, -4977, -1317, -3650, -5219, -629, -1732, -6546, -3657, -883, -3251, -1579, -2771, -3653,
+  -885, -4758, -2122, -3388, -5131, -5569, -3251, -5902, -3145, -6977, -1474, -2345, -5456, -1612, -223, -6420,
+  -414, -6432, -3956, -2647, -838, -3050, -3850, -6000, -599, -4619, -4063, -2004, -3486, -4023, -747, -3531,
+  -7259, -1268, -2707, -2916, -2441, -3077, -3619, -7119, -2262, -8194, -2051, -2947, -4617, -2836, -606, -7636,
+  -1359, -2892, -1158, -4796, -635, -3537, -4398, -4541, -812, -7694, -1414, -3993, -3098, -602, -2208, -2568,
+  -4805, -3992, -1153, -1414, -817, -1414, -6418, -4550, -3202, -8125, -1358, -3080, -4803, -2585, -602, -4806,
+  -2601, -6412, -2067, -1665, -1984, -3002, -545, -4838, -2507, -4343, -3681, -3004, -4086, -2898, -1051, -811,
+  -811, -811, -2104, -1989, -2823, -1066, -3713, -4854, -2610, -8174, -1643, -2635, -6653, -2289, -473, -7616,
+  -3489, -72, -1267, -3046, -3894, -1468, -3356, -4254, -3294, -4955, -3484, -2582, -2594, -2214, -3200, -1515,
+  -7745, -1106, -2723, -1504, -2370, -3241, -2762, -5360, -4386, -4955, -2355, -3323, -5103, -3569, -1268, -8122,
+  -668, -6823, -1901, -6585, -1171, -6661, -5007, -1641, -3222, -8154, -7386, -2863, -6767, -4854, -2570, -2935,
+  -1901, -566, -1644, -538, -1493, -7176, -4348, -7510, -6889, -8585, -1894, -4454, -5263, -1239, -512, -8027,
+  -5204, -5699, -3732, -5460, -4106, -3881, -5702, -5267, -5215, -7029, -1631, -5428, -4135, -4123, -5198, -5669,
+  -6525, -1371, -5251, -1376, -354, -6051, -5753, -6385, -5765, -7460, -3070, -4135, -5939, -3016, -217, -6903,
+  -987, -3786, -2944, -2820, -451, -3138, -3187, -4041, -2379, -4388, -3344, -3396, -3008, -3247, -1377, -3216,
+  -1406, -3385, -2514, -2500, -1402, -743, -3625, -7444, -2831, -8519, -2064, -2999, -5197, -2534, -318, -7961,
+  -1029, -5215, -924, -5210, -460, -4220, -4962, -2813, -1171, -8108, -3977, -3414, -2829, -4499, -550, -1428,
+  -3702, -6320, -2485, -1402, -2606, -4452, -3840, -7464, -3621, -8539, -1839, -2777, -7018, -2346, -520, -5220,
+  -3044, -7216, -1704, -6977, -2620, -7054, -7219, -408, -2657, -8546, -7779, -3467, -4252, -4516, -1291, -1448,
+  -1192, -3082, -3051, -3330, -1191, -1704, -3318, -4890, -3472, -5402, -1277, -3285, -7456, -1296, -290, -8420,
+  -1862, -2139, -1806, -2570, -1839, -2560, -1954, -5314, -2152, -7076, -3931, -168, -1770, -1670, -2526, -1842,
+  -6572, -1363, -1629, -1537, -2984, -3782, -5800, -3782, -4184, -4188, -2618, -3780, -5986, -2944, -512, -6950,
+  -432, -5999, -5829, -5761, -985, -5837, -6003, -5567, -331, -7330, -6562, -5728, -5943, -4030, -2962, -5970,
+  -6826, -5541, -4030, -3842, -3494, -6352, -1459, -3847, -3723, -7761, -3914, -4034, -6240, -3053, -609, -7203,
+  -1539, -5689, -5519, -2851, -1618, -5527, -5693, -233, -788, -7019, -6252, -3025, -5633, -2322, -1849, -5660,
+  -6516, -3043, -2446, -3716, -5605, -6042, -850, -6375, -5755, -7450, -1865, -2709, -5930, -2041, -594, -6893,
+  -2521, -5253, -2006, -5014, -2371, -5091, -5257, -2209, -751, -6584, -5816, -3286, -5197, -4801, -3675, -1572,
+  -6080, -3179, -4806, -1737, -3689, -1044, -5308, -3290, -2671, -7014, -2029, -2810, -5494, -379, -327, -6457,
+  -3520, -3630, -4029, -4027, -168, -4029, -3779, -4020, -2537, -6925, -768, -3268, -3090, -3772, -2298, -2879,
+  -6421, -3625, -1561, -4977, -5510, -5948, -5649, -3781, -5661, -4037, -929, -1834, -5835, -1729, -767, -6799,
+  -1463, -3538, -3367, -1970, -932, -3375, -3541, -3106, -1382, -4868, -4100, -400, -3481, -3086, -979, -3508,
+  -4364, -3079, -3090, -2919, -1721, -3890, -3592, -4224, -1976, -5299, -1057, -3499, -3778, -1129, -395, -4742,
+  -968, -1304, -1884, -1736, -1953, -1480, -1780, -2035, -1018, -5574, -4880, -1952, -1630, -2141, -1279, -1884,
+  -4880, -1304, -1547, -1223, -2291, -1736, -1185, -2292, -2547, -6023, -453, -8310, -481, -1886, -1480, -2548,
+  -1395, -2046, -2046, -2051, -3429, -1547, -2057, -2058, -1796, -4924, -4489, -3438, -3357, -3644, -1248, -2045,
+  -4278, -1798, -1795, -1536, -1805, -3827, -1798, -5436, -4145, -5436, -453, -232, -1400, -4065, -3246, -5436,
+  -1988, -6897, -6727, -4392, -5066, -6735, -6901, -6465, -4741, -8228, -4934, -4825, -4826, -4928, -4927, -1433,
+  -5083, -4823, -4823, -1581, -6813, -7250, -6952, -7584, -6963, -8658, -382, -1138, -426, -532, -3097, -1838,
+  -4536, -4764, -4681, -3547, -5269, -5019, -4296, -5606, -2312, -8758, -5869, -4895, -1718, -5605, -5272, -4824,
+  -8254, -2312, -2307, -4306, -5864, -7781, -4653, -8114, -7494, -9189, -108, -906, -2305, -698, -3560, -8632,
+  -3222, -3394, -3115, -3503, -3228, -1455, -1119, -3700, -1700, -3979, -3897, -3491, -3341, -3700, -3228, -2848,
+  -3120, -3349, -3317, -3046, -4027, -3295, -1714, -3723, -4028, -4491, -1627, -1301, -2503, -1111, -74, -4085,
+  -3913, -4408, -4237, -4169, -3698, -4245, -4411, -3976, -2584, -5738, -4971, -4137, -4351, -1487, -2830, -4379,
+  -2594, -2129, -2832, -1848, -4323, -4761, -4462, -5094, -4474, -6169, -1604, -2844, -2255, -1676, -1932, -24,
+  -3313, -1502, -1042, -1338, -3229, -1827, -1565, -3166, -1399, -2913, -1586, -901, -1336, -518, -3418, -1368,
+  -2763, -808, -883, -737, -1857, -1640, -2084, -2194, -1195, -3236, -1174, -1982, -3235, -2487, -2364, -6592,
+  -1650, -1766, -1891, -2211, -421, -3075, -3330, -2267, -1347, -1532, -5456, -749, -2822, -2819, -801, -4864,
+  -3335, -1147, -1153, -2001, -1013, -3079, -4948, -2567, -619, -6654, -1841, -2822, -5134, -1921, -2335, -6097,
+  -1036, -2364, -1474, -2418, -666, -2786, -2992, -712, -1002, -2844, -1204, -1230, -5007, -2785, -539, -2843,
+  -2844, -1373, -2481, -701, -1188, -5416, -5118, -3505, -2482, -6825, -1920, -2992, -5304, -1812, -2302, -2911,
+  -1716, -3061, -3060, -1700, -743, -3166, -1888, -2722, -744, -2806, -2912, -1736, -2855, -2976, -1319, -3315,
+  -3574, -1782, -1434, -1920, -1686, -2806, -5186, -5818, -1771, -6893, -250, -1169, -5372, -1031, -2574, -6336,
+  -1217, -2356, -1328, -1032, -1386, -1265, -1917, -2721, -1471, -3327, -2371, -1482, -1598, -972, -2355, -1893,
+  -1930, -762, -910, -1313, -3532, -1837, -2072, -1565, -1641, -3451, -407, -1258, -5843, -1301, -2615, -3789,
+  -1181, -3492, -3238, -4817, -1171, -1361, -2356, -3481, -910, -6386, -3092, -1117, -2647, -3480, -800, -5026,
+  -3497, -715, -2900, -1367, -1715, -5408, -5110, -5742, -2410, -6817, -324, -1245, -5296, -1828, -2267, -6259,
+  -1377, -4890, -4719, -2669, -737, -3324, -2052, -611, -1106, -6220, -3075, -861, -2076, -1617, -1319, -4860,
+  -2926, -794, -1258, -1620, -1355, -5242, -4944, -3331, -2520, -6651, -586, -1484, -5130, -1217, -2115, -6094,
+  -820, -3254, -5155, -3506, -225, -3253, -3762, -4893, -832, -3173, -3766, -3047, -2594, -3502, -1170, -3509,
+  -3511, -1563, -2499, -1138, -1950, -5678, -5380, -6011, -2163, -3768, -830, -1764, -5566, -1609, -2550, -2405,
+  -2096, -1932, -1427, -1652, -1766, -1723, -1513, -4207, -2655, -7112, -404, -1605, -1737, -902, -1344, -2531,
+  -2326, -1456, -1221, -1170, -2330, -1977, -5837, -2119, -5848, -2853, -1868, -2738, -4222, -2495, -405, -3506,
+  -1004, -3563, -3392, -3324, -150, -3400, -3566, -3131, -3079, -4893, -1599, -3292, -3506, -3111, -958, -3534,
+  -4389, -3104, -3115, -1735, -937, -3916, -3617, -4249, -3629, -5324, -1229, -1999, -3803, -1193, -1748, -4767,
+  -2174, -4330, -2764, -4092, -432, -2764, -4334, -2256, -847, -5661, -2772, -1825, -2365, -693, -1885, -2767,
+  -2261, -3872, -1237, -2503, -4246, -4683, -2366, -5017, -2260, -6092, -589, -1460, -4571, -726, -1772, -5534,
+  -864, -5164, -2688, -1379, -590, -1781, -2582, -4732, -773, -3350, -2795, -736, -2217, -2754, -836, -2263,
+  -5991, -2793, -1439, -1648, -1173, -1809, -2350, -5850, -994, -6925, -783, -1678, -3349, -1567, -2350, -6368,
+  -674, -1478, -2541, -3382, -518, -2123, -2984, -3127, -855, -6280, -3135, -2579, -1684, -1994, -794, -1154,
+  -3391, -2578, -1316, -2620, -1240, -3390, -5004, -3136, -1788, -6711, -671, -1666, -3389, -1171, -1926, -3392,
+  -2905, -6716, -2371, -1969, -2288, -3306, -2170, -5142, -2811, -4647, -3985, -3308, -4390, -3202, -9, -4645,
+  -4347, -4561, -2408, -2293, -3127, -3376, -4017, -5158, -2914, -8478, -1947, -2939, -6957, -2593, -3903, -7920,
+  -2220, -1710, -2244, -1778, -2625, -923, -2087, -2985, -2026, -3687, -2216, -235, -1326, -946, -1932, -1625,
+  -6477, -1086, -1455, -1314, -1102, -1973, -1494, -4092, -3118, -3687, -1087, -2055, -3835, -2300, -2986, -6854,
+  -624, -4922, -3356, -4683, -565, -4760, -3106, -1390, -1321, -6253, -5485, -962, -4866, -2953, -668, -1034,
+  -2553, -702, -1823, -1282, -1455, -5275, -2447, -5609, -4988, -6683, -1479, -2553, -3362, -1612, -1834, -6126,
+  -3977, -4472, -2506, -4234, -2879, -2655, -4476, -4040, -3989, -5803, -2509, -4201, -2908, -2897, -3971, -4443,
+  -5299, -1740, -4025, -2645, -20, -4825, -4527, -5159, -4538, -6234, -1844, -2909, -4713, -1790, -1385, -5676,
+  -1583, -3148, -2306, -2183, -1262, -2500, -2549, -3403, -46, -3750, -2706, -2758, -2370, -2609, -1700, -2578,
+  -4306, -2747, -1876, -1862, -2493, -2435, -2988, -6806, -2193, -7881, -1426, -2361, -4559, -1896, -3117, -7323,
+  -1664, -4034, -1917, -4029, -1047, -3038, -3780, -1631, -1297, -6927, -2795, -2233, -1648, -3318, -1368, -1590,
+  -2521, -5138, -1303, -1108, -1425, -3271, -2659, -6283, -2440, -7358, -149, -1596, -5837, -1165, -2377, -4039,
+  -2363, -6535, -3734, -6297, -994, -6373, -6539, -38, -1977, -7866, -7098, -2787, -3572, -3836, -2035, -4465,
+  -4166, -2401, -2371, -2650, -2660, -4383, -2638, -4210, -2792, -4722, -1655, -2604, -6776, -2376, -3158, -7739,
+  -1094, -1371, -1038, -1802, -1071, -1792, -1186, -4546, -1384, -6308, -3163, -945, -1002, -902, -1758, -1074,
+  -5804, -595, -861, -769, -2216, -3014, -5032, -3014, -3416, -3420, -1850, -3012, -5218, -2176, -2825, -6182,
+  -733, -4540, -4370, -4301, -179, -4378, -4544, -4108, -604, -5871, -5103, -4269, -4484, -2571, -1502, -4511,
+  -5367, -4082, -2571, -2382, -2035, -4893, -2978, -2388, -2263, -6301, -2455, -2575, -4781, -1593, -1841, -5744,
+  -689, -4839, -4668, -2001, -768, -4676, -4842, -426, -625, -6169, -5401, -2174, -4782, -1472, -999, -4809,
+  -5665, -2193, -1595, -2866, -4754, -5192, -2874, -5525, -4905, -6600, -1014, -1859, -5079, -1191, -2768, -6043,
+  -1475, -4207, -960, -3968, -1325, -4045, -4210, -1162, -554, -5537, -4770, -2240, -4150, -3755, -2629, -526,
+  -5033, -2133, -3759, -690, -2642, -1799, -4261, -2243, -1625, -5968, -983, -1763, -4447, -857, -1625, -5411,
+  -2752, -2862, -3261, -3259, -972, -3261, -3011, -3252, -1769, -6157, -2863, -2500, -2322, -3004, -1530, -2111,
+  -5653, -2857, -793, -4209, -4742, -5180, -4881, -3013, -4893, -3269, -161, -1066, -5067, -961, -2419, -6031,
+  -1057, -3132, -2962, -1564, -526, -2970, -3135, -2700, -976, -4462, -3695, -1563, -3075, -2680, -573, -3103,
+  -3958, -2673, -2684, -2513, -1315, -3485, -3186, -3818, -1570, -4893, -651, -3093, -3372, -723, -1317, -4336,
+  -2056, -2316, -659, -996, -2748, -2509, -2850, -2858, -988, -4282, -3588, -2624, -2538, -2870, -840, -2490,
+  -3588, -2477, -1237, -1877, -3048, -2965, -2390, -4110, -3277, -4731, -2343, -7018, -281, -1256, -2838, -1256,
+  -1149, -1407, -1405, -1548, -1623, -1564, -1824, -1901, -1322, -3118, -2683, -1632, -1550, -1838, -1320, -1373,
+  -2472, -1399, -1296, -954, -2026, -2021, -1386, -3629, -2339, -3630, -1844, -1155, -253, -2259, -1440, -3630,
+  -2943, -5314, -5144, -2809, -3483, -5152, -5318, -4882, -3158, -6645, -3351, -3242, -3243, -3345, -3344, -2871,
+  -3501, -3240, -3240, -1919, -5230, -5667, -5369, -6001, -5380, -7076, -1335, -2063, -984, -50, -1514, -2404,
+  -3412, -3640, -3557, -2424, -4145, -3895, -3172, -4482, -3639, -7634, -4745, -3771, -2991, -4481, -4148, -3700,
+  -7131, -3771, -2738, -3182, -4740, -6657, -3529, -6990, -6370, -8065, -5, -2098, -2598, -2021, -2436, -7508,
+  -2454, -2626, -2347, -2735, -2460, -2375, -2223, -2932, -2112, -3211, -3129, -2723, -2573, -2932, -2460, -2080,
+  -2352, -2581, -2549, -2278, -3259, -2527, -3167, -946, -3260, -3723, -411, -922, -1735, -277, -2267, -3317,
+  -5116, -5611, -5441, -5372, -4901, -5449, -5615, -5179, -1665, -6941, -6174, -5340, -5555, -558, -1921, -5582,
+  -1665, -1202, -1921, -921, -5527, -5964, -5666, -6297, -5677, -7372, -677, -1921, -1326, -747, -1003, -537
+};
+
+#endif
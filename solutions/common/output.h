@@ -0,0 +1,142 @@
+#ifndef CRYPTOPALS_OUTPUT_H
+#define CRYPTOPALS_OUTPUT_H
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "bytes.h"
+#include "encoding.h"
+
+#define OUTPUT_BUFFER_SIZE (4ul << 20)
+// input bytes encoded per step by write_hex and write_base64; a multiple of 3 so only the
+// last step of a base64 encoding can carry padding
+#define OUTPUT_ENCODE_CHUNK (3ul << 16)
+
+// writes to a file descriptor through a fixed size buffer, so output memory stays bounded
+// and the kernel sees a few large write() calls instead of one per byte. Data that does not
+// fit in what is left of the buffer goes out together with the buffer in one writev()
+// without being copied.
+class Output {
+public:
+  explicit Output(int fd = STDOUT_FILENO, size_t buffer_size = OUTPUT_BUFFER_SIZE)
+    : fd(fd), buffer(buffer_size), used(0), total(0) {}
+  // errors on the last flush are lost here; call flush() first to see them
+  ~Output() {
+    try {
+      flush();
+    } catch (const std::runtime_error&) {
+    }
+  }
+  Output(const Output&) = delete;
+  Output& operator=(const Output&) = delete;
+
+  // reserve size bytes, at most the buffer size, at the end of the buffer and return where
+  // to write them
+  char* reserve(size_t size);
+  void write(const char* data, size_t size);
+  // strings convert to ByteSpan
+  void write(ByteSpan bytes) { write((const char*) bytes.data(), bytes.size()); }
+  void put(char ch) { *reserve(1) = ch; }
+  // encode straight into the buffer, a chunk at a time
+  void write_hex(ByteSpan bytes);
+  void write_base64(ByteSpan bytes);
+  void flush();
+  size_t bytes_written() const { return total + used; }
+
+private:
+  // write iovecs out completely, retrying short writes
+  void write_all(iovec* iov, int count);
+
+  int fd;
+  std::vector<char> buffer;
+  size_t used;
+  size_t total;
+};
+
+inline char* Output::reserve(size_t size)
+{
+  if (size > buffer.size()) {
+    throw std::length_error("reservation is larger than the output buffer");
+  }
+  if (used + size > buffer.size()) {
+    flush();
+  }
+  char* p = buffer.data() + used;
+  used += size;
+  return p;
+}
+
+inline void Output::write(const char* data, size_t size)
+{
+  if (used + size <= buffer.size()) {
+    memcpy(buffer.data() + used, data, size);
+    used += size;
+    return;
+  }
+
+  iovec iov[2] = {{buffer.data(), used}, {const_cast<char*>(data), size}};
+  write_all(iov, 2);
+  total += used + size;
+  used = 0;
+}
+
+inline void Output::write_hex(ByteSpan bytes)
+{
+  size_t chunk = std::min(OUTPUT_ENCODE_CHUNK, buffer.size() / 2);
+  for (size_t i = 0; i < bytes.size(); i += chunk) {
+    ByteSpan part = bytes.subspan(i, std::min(chunk, bytes.size() - i));
+    hex_encode(part, reserve(part.size() * 2));
+  }
+}
+
+inline void Output::write_base64(ByteSpan bytes)
+{
+  size_t chunk = std::min(OUTPUT_ENCODE_CHUNK, buffer.size() / 4 * 3);
+  for (size_t i = 0; i < bytes.size(); i += chunk) {
+    ByteSpan part = bytes.subspan(i, std::min(chunk, bytes.size() - i));
+    base64_encode(part, reserve(base64_encoded_size(part.size())));
+  }
+}
+
+inline void Output::flush()
+{
+  if (used == 0) {
+    return;
+  }
+  iovec iov = {buffer.data(), used};
+  write_all(&iov, 1);
+  total += used;
+  used = 0;
+}
+
+inline void Output::write_all(iovec* iov, int count)
+{
+  while (count > 0) {
+    ssize_t n = ::writev(fd, iov, count);
+    if (n < 0) {
+      if (errno == EINTR) {
+	continue;
+      }
+      throw std::runtime_error(std::string("write failed: ") + strerror(errno));
+    }
+    // skip what was written, which may end part way through an iovec
+    while (count > 0 && (size_t) n >= iov->iov_len) {
+      n -= iov->iov_len;
+      iov++;
+      count--;
+    }
+    if (count > 0) {
+      iov->iov_base = (char*) iov->iov_base + n;
+      iov->iov_len -= n;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,254 @@
+#ifndef CRYPTOPALS_PLAINTEXT_H
+#define CRYPTOPALS_PLAINTEXT_H
+
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "bytes.h"
+#include "instrument.h"
+#include "ngram.h"
+#include "output.h"
+#include "xor.h"
+
+// a candidate key and the score of the plaintext it decrypts to
+struct KeyScore {
+  byte key;
+  double score;
+};
+
+// keeps the k best keys offered, in a min-heap on score so the worst kept key is at the front
+// and each offer costs O(log k). Only the keys and scores are stored; plaintexts are decrypted
+// afterwards for the winners alone.
+class TopKeys {
+public:
+  explicit TopKeys(size_t k) : k(k) {
+    if (k == 0) {
+      throw std::invalid_argument("top keys needs k > 0");
+    }
+    heap.reserve(k);
+  }
+
+  void offer(byte key, double score) {
+    KeyScore candidate = {key, score};
+    if (heap.size() < k) {
+      heap.push_back(candidate);
+      std::push_heap(heap.begin(), heap.end(), better);
+    } else if (better(candidate, heap.front())) {
+      std::pop_heap(heap.begin(), heap.end(), better);
+      heap.back() = candidate;
+      std::push_heap(heap.begin(), heap.end(), better);
+    }
+  }
+
+  // the kept keys, best first
+  std::vector<KeyScore> sorted() const {
+    std::vector<KeyScore> keys(heap);
+    std::sort_heap(keys.begin(), keys.end(), better);
+    return keys;
+  }
+
+private:
+  // higher score first, ties to the lower key so results do not depend on offer order
+  static bool better(const KeyScore& k1, const KeyScore& k2) {
+    return k1.score > k2.score || (k1.score == k2.score && k1.key < k2.key);
+  }
+
+  size_t k;
+  std::vector<KeyScore> heap;
+};
+
+// read a wordlist file into a set of strings
+inline std::set<std::string> read_wordlist(const std::string& filename)
+{
+  INSTRUMENT_STAGE("wordlist");
+  std::ifstream word_file(filename);
+
+  if (!word_file.is_open()) {
+    throw std::invalid_argument("unable to open wordlist file");
+  }
+
+  std::string word;
+  std::set<std::string> wordlist;
+  while (getline(word_file, word)) {
+    wordlist.insert(word);
+  }
+  word_file.close();
+
+  return wordlist;
+}
+
+// return true if text is > 70% alpha characters
+inline bool is_reasonable_plaintext(const std::string& text)
+{
+  int num_letters = 0;
+  for (auto ch : text) {
+    ch = tolower(ch);
+    if (ch >= 'a' && ch <= 'z') {
+      num_letters++;
+    }
+  }
+
+  float percent_letters = (float) num_letters / text.length();
+  return (percent_letters >= 0.7);
+}
+
+// return a value 0 <= score <= 1 that based on the percentage of real words in text, 0 if there are none
+inline double score_plaintext(const std::set<std::string>& wordlist, const std::string& text)
+{
+  INSTRUMENT_STAGE("scoring");
+  int num_words = 0;
+  int num_real_words = 0;
+  std::istringstream iss(text);
+  std::string word;
+
+  while (iss >> word) {
+    std::transform(word.begin(), word.end(), word.begin(), ::tolower);
+    if (wordlist.find(word) != wordlist.end()) {
+      num_real_words++;
+    }
+    num_words++;
+  }
+  INSTRUMENT_COUNT("wordlist_lookups", num_words);
+  if (num_words == 0) {
+    return 0;
+  }
+  return (double) num_real_words / num_words;
+}
+
+// try every single byte key and return the k best reasonable ones by wordlist score, best first
+inline std::vector<KeyScore> rank_single_byte_keys(const std::set<std::string>& wordlist, ByteSpan encrypted,
+						    size_t k = 1)
+{
+  INSTRUMENT_STAGE("key_search");
+  INSTRUMENT_COUNT("keys_tried", CHAR_MAX - CHAR_MIN + 1);
+  TopKeys top(k);
+  Bytes decrypted(encrypted.size());
+  std::string text;
+
+  for (int key = CHAR_MIN; key <= CHAR_MAX; key++) {
+    single_byte_xor(encrypted, (byte) key, decrypted);
+    text.assign((const char*) decrypted.data(), decrypted.size());
+
+    // only consider reasonable plaintexts
+    if (is_reasonable_plaintext(text)) {
+      top.offer((byte) key, score_plaintext(wordlist, text));
+    } else {
+      INSTRUMENT_COUNT("keys_pruned", 1);
+    }
+  }
+
+  return top.sorted();
+}
+
+// try every single byte key and return the k best the n-gram model takes for english, best first
+inline std::vector<KeyScore> rank_single_byte_keys(ByteSpan encrypted, size_t k = 1)
+{
+  INSTRUMENT_STAGE("key_search");
+  INSTRUMENT_COUNT("keys_tried", CHAR_MAX - CHAR_MIN + 1);
+  TopKeys top(k);
+  Bytes decrypted(encrypted.size());
+
+  for (int key = CHAR_MIN; key <= CHAR_MAX; key++) {
+    single_byte_xor(encrypted, (byte) key, decrypted);
+
+    double score;
+    {
+      INSTRUMENT_STAGE("scoring");
+      score = ngram_score(decrypted);
+    }
+
+    if (score < NGRAM_ENGLISH_THRESHOLD) {
+      INSTRUMENT_COUNT("keys_pruned", 1);
+      continue;
+    }
+    top.offer((byte) key, score);
+  }
+
+  return top.sorted();
+}
+
+// a repeating xor key and the average byte model log2 probability of its decryption
+struct RepeatingKey {
+  Bytes key;
+  double score;
+};
+
+// break repeating key xor under each of the num_keysizes keysizes with the smallest hamming
+// distance and return the distinct keys, best first, each cut to its shortest period
+inline std::vector<RepeatingKey> rank_repeating_keys(ByteSpan encrypted, size_t num_keysizes)
+{
+  INSTRUMENT_STAGE("key_search");
+  std::vector<KEY_EVALUATION> key_evaluations = evaluate_key_lengths(encrypted);
+  if (key_evaluations.empty()) {
+    throw std::invalid_argument("input is too short to find a key length");
+  }
+
+  std::vector<RepeatingKey> keys;
+  for (size_t i = 0; i < key_evaluations.size() && i < num_keysizes; i++) {
+    RepeatingKey candidate;
+    int64_t total = 0;
+
+    // every column of the transposed ciphertext is single byte xor under one key byte;
+    // columns have no word context, so only the byte model scores them
+    for (auto& block : generate_blocks(encrypted, key_evaluations[i].first)) {
+      Bytes decrypted(block.size());
+      byte best_key = 0;
+      int32_t best_score = INT32_MIN;
+      for (unsigned k = 0; k <= UINT8_MAX; k++) {
+	single_byte_xor(block, k, decrypted);
+	int32_t score = ngram_byte_log_prob(decrypted);
+	if (score > best_score) {
+	  best_score = score;
+	  best_key = k;
+	}
+      }
+      candidate.key.push_back(best_key);
+      total += best_score;
+    }
+    INSTRUMENT_COUNT("keys_tried", 256 * key_evaluations[i].first);
+    candidate.score = (double) total / NGRAM_SCALE / encrypted.size();
+
+    // a multiple of the keysize recovers the key repeated; keep one period of it
+    Bytes& key = candidate.key;
+    for (size_t period = 1; period < key.size(); period++) {
+      if (key.size() % period == 0 && memcmp(key.data(), key.data() + period, key.size() - period) == 0) {
+	key.resize(period);
+	break;
+      }
+    }
+
+    bool seen = false;
+    for (auto& other : keys) {
+      seen = seen || (other.key.size() == key.size() && memcmp(other.key.data(), key.data(), key.size()) == 0);
+    }
+    if (!seen) {
+      keys.push_back(std::move(candidate));
+    }
+  }
+
+  std::stable_sort(keys.begin(), keys.end(),
+		   [](const RepeatingKey& k1, const RepeatingKey& k2) { return k1.score > k2.score; });
+  return keys;
+}
+
+// print a key and the plaintext it decrypts to
+inline void print_plaintext(Output& output, byte key, ByteSpan text)
+{
+  char* p = output.reserve(3);
+  p[0] = (char) key;
+  p[1] = ':';
+  p[2] = ' ';
+  output.write(text);
+  output.put('\n');
+}
+
+#endif
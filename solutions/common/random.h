@@ -0,0 +1,72 @@
+#ifndef CRYPTOPALS_RANDOM_H
+#define CRYPTOPALS_RANDOM_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "bytes.h"
+
+// deterministic, seeded pseudo random generator (splitmix64) for reproducible
+// synthetic data; not suitable for keys that have to stay secret
+class Prng {
+public:
+  explicit Prng(uint64_t seed) : state(seed) {}
+
+  uint64_t next() {
+    uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+  }
+
+  // uniform value in [0, n)
+  uint64_t uniform(uint64_t n) {
+    return (uint64_t) (((unsigned __int128) next() * n) >> 64);
+  }
+
+  void fill(MutableByteSpan out) {
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= out.size(); i += sizeof(uint64_t)) {
+      uint64_t z = next();
+      memcpy(out.data() + i, &z, sizeof(z));
+    }
+    if (i < out.size()) {
+      uint64_t z = next();
+      memcpy(out.data() + i, &z, out.size() - i);
+    }
+  }
+
+private:
+  uint64_t state;
+};
+
+// size pseudo random bytes from seed
+inline Bytes random_bytes(size_t size, uint64_t seed)
+{
+  Bytes bytes(size);
+  Prng(seed).fill(bytes);
+  return bytes;
+}
+
+// size characters of text made of space separated words from the wordlist
+inline std::string random_text(const std::vector<std::string>& words, size_t size, Prng& prng)
+{
+  std::string text;
+  text.reserve(size + 32);
+  while (text.size() < size) {
+    text.append(words[prng.uniform(words.size())]);
+    text.push_back(' ');
+  }
+  text.resize(size);
+  return text;
+}
+
+inline std::string random_text(const std::vector<std::string>& words, size_t size, uint64_t seed)
+{
+  Prng prng(seed);
+  return random_text(words, size, prng);
+}
+
+#endif
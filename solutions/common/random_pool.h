@@ -0,0 +1,82 @@
+#ifndef CRYPTOPALS_RANDOM_POOL_H
+#define CRYPTOPALS_RANDOM_POOL_H
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include <openssl/crypto.h>
+#include <openssl/rand.h>
+
+#include "bytes.h"
+
+// bytes a pool fetches from RAND_bytes at a time
+#define RANDOM_POOL_SIZE (64ul << 10)
+
+// serves random bytes out of a buffer that is refilled from RAND_bytes in large
+// blocks; each thread has its own pool so serving bytes never takes a lock
+class RandomPool {
+public:
+  RandomPool() : pool(RANDOM_POOL_SIZE), pos(RANDOM_POOL_SIZE) {}
+  ~RandomPool() { OPENSSL_cleanse(pool.data(), pool.size()); }
+  RandomPool(const RandomPool&) = delete;
+  RandomPool& operator=(const RandomPool&) = delete;
+
+  void bytes(byte* out, size_t size);
+  // uniform value in [low, high], which may span at most 256 values
+  unsigned uniform(unsigned low, unsigned high);
+
+  // the calling thread's pool
+  static RandomPool& local() {
+    static thread_local RandomPool pool;
+    return pool;
+  }
+
+  // when false, every request goes straight to RAND_bytes
+  static inline bool buffered = true;
+
+private:
+  void refill();
+
+  std::vector<byte> pool;
+  size_t pos;
+};
+
+inline void RandomPool::refill()
+{
+  if (RAND_bytes(pool.data(), (int) pool.size()) != 1)
+    throw std::runtime_error("RAND_bytes failed");
+  pos = 0;
+}
+
+inline void RandomPool::bytes(byte* out, size_t size)
+{
+  if (!buffered || size > pool.size()) {
+    if (RAND_bytes(out, (int) size) != 1)
+      throw std::runtime_error("RAND_bytes failed");
+    return;
+  }
+
+  if (pool.size() - pos < size) {
+    refill();
+  }
+
+  // bytes are wiped as they are handed out so they are never served twice
+  memcpy(out, &pool[pos], size);
+  OPENSSL_cleanse(&pool[pos], size);
+  pos += size;
+}
+
+inline unsigned RandomPool::uniform(unsigned low, unsigned high)
+{
+  // rejection sampling keeps the distribution unbiased
+  unsigned range = high - low + 1;
+  unsigned limit = 256 - 256 % range;
+  byte b;
+  do {
+    bytes(&b, 1);
+  } while (b >= limit);
+  return low + b % range;
+}
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef CRYPTOPALS_SIZE_H
+#define CRYPTOPALS_SIZE_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+// parse a size with an optional K, M or G suffix
+inline size_t parse_size(const std::string& str)
+{
+  size_t pos;
+  size_t size = std::stoul(str, &pos);
+  if (pos < str.size()) {
+    switch (str[pos]) {
+    case 'k': case 'K': size <<= 10; break;
+    case 'm': case 'M': size <<= 20; break;
+    case 'g': case 'G': size <<= 30; break;
+    default: throw std::invalid_argument("bad size suffix");
+    }
+  }
+  return size;
+}
+
+#endif
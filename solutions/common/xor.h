@@ -0,0 +1,133 @@
+#ifndef CRYPTOPALS_XOR_H
+#define CRYPTOPALS_XOR_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "bytes.h"
+
+// a candidate repeating key length and its normalized hamming distance
+typedef std::pair<int, double> KEY_EVALUATION;
+
+// xor two equal length buffers
+inline Bytes fixed_xor(ByteSpan s1, ByteSpan s2)
+{
+  if (s1.size() != s2.size()) {
+    throw std::invalid_argument("buffers must be equal length");
+  }
+
+  Bytes output(s1.size());
+  for (size_t i = 0; i < s1.size(); i++) {
+    output[i] = s1[i] ^ s2[i];
+  }
+  return output;
+}
+
+// xor every byte of input with key into output, which must be the same size as input
+inline void single_byte_xor(ByteSpan input, byte key, MutableByteSpan output)
+{
+  for (size_t i = 0; i < input.size(); i++) {
+    output[i] = input[i] ^ key;
+  }
+}
+
+// encrypt or decrypt text using repeating key xor
+inline Bytes repeating_key_xor(ByteSpan text, ByteSpan key)
+{
+  if (key.empty()) {
+    throw std::invalid_argument("key must not be empty");
+  }
+
+  Bytes output(text.size());
+  size_t key_pos = 0;
+  for (size_t i = 0; i < text.size(); i++) {
+    output[i] = text[i] ^ key[key_pos];
+    if (++key_pos == key.size()) {
+      key_pos = 0;
+    }
+  }
+  return output;
+}
+
+// number of differing bits between two equal length buffers
+inline unsigned hamming_distance(ByteSpan s1, ByteSpan s2)
+{
+  if (s1.size() != s2.size()) {
+    throw std::invalid_argument("strings must be equal length");
+  }
+
+  unsigned distance = 0;
+  size_t i = 0;
+
+  // popcount a word at a time, then finish the tail byte by byte
+  for (; i + sizeof(uint64_t) <= s1.size(); i += sizeof(uint64_t)) {
+    uint64_t w1, w2;
+    memcpy(&w1, s1.data() + i, sizeof(w1));
+    memcpy(&w2, s2.data() + i, sizeof(w2));
+    distance += __builtin_popcountll(w1 ^ w2);
+  }
+  for (; i < s1.size(); i++) {
+    distance += __builtin_popcount(s1[i] ^ s2[i]);
+  }
+
+  return distance;
+}
+
+// compare key evaluations so the smallest normalized distance comes first
+inline bool compare_key_evaluations(const KEY_EVALUATION &ke1, const KEY_EVALUATION &ke2)
+{
+  return ke1.second < ke2.second;
+}
+
+// score keysizes 2 to 40 by the normalized hamming distance between the first blocks, best first;
+// empty for input under 8 bytes, which has no four whole blocks of any keysize, so callers must check
+inline std::vector<KEY_EVALUATION> evaluate_key_lengths(ByteSpan encrypted)
+{
+  std::vector<KEY_EVALUATION> key_evaluations;
+
+  // only keysizes with four whole blocks of input can be measured
+  for (int keysize = 2; keysize <= 40 && keysize * 4 <= (int) encrypted.size(); keysize++) {
+    // the first four keysize blocks, viewed in place
+    ByteSpan block1 = encrypted.subspan(0, keysize);
+    ByteSpan block2 = encrypted.subspan(keysize, keysize);
+    ByteSpan block3 = encrypted.subspan(keysize * 2, keysize);
+    ByteSpan block4 = encrypted.subspan(keysize * 3, keysize);
+
+    int d1 = hamming_distance(block1, block2);
+    int d2 = hamming_distance(block3, block4);
+    int d3 = hamming_distance(block1, block3);
+    int d4 = hamming_distance(block2, block4);
+    int d5 = hamming_distance(block2, block3);
+    int d6 = hamming_distance(block1, block4);
+    double average_distance = (double) (d1 + d2 + d3 + d4 + d5 + d6) / 6;
+    double normalized_distance = average_distance / keysize;
+
+    KEY_EVALUATION key_evaluation(keysize, normalized_distance);
+    key_evaluations.push_back(key_evaluation);
+  }
+
+  std::sort(key_evaluations.begin(), key_evaluations.end(), compare_key_evaluations);
+
+  return key_evaluations;
+}
+
+// transpose ciphertext into keylength blocks, block i holding every byte encrypted with key byte i
+inline std::vector<Bytes> generate_blocks(ByteSpan encrypted, const int keylength)
+{
+  std::vector<Bytes> blocks;
+  for (size_t i = 0; i < (size_t) keylength; i++) {
+    Bytes block;
+    block.reserve(encrypted.size() / keylength + 1);
+    for (size_t j = i; j < encrypted.size(); j += keylength) {
+      block.push_back(encrypted[j]);
+    }
+    blocks.push_back(std::move(block));
+  }
+  return blocks;
+}
+
+#endif